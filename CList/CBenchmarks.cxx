@@ -0,0 +1,562 @@
+#include "CBenchmarks.h"
+#include "CPerfCounters.h"
+#include "CBlockingList.h"
+#include "CRcuList.h"
+#include "CTimerWheel.h"
+#include "CList.h"
+#include "CStaticList.h"
+#include "CTestClass.h"
+#include "CValueProvider.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nsBench;
+using namespace nsTests;
+using namespace nsSdD;
+using namespace std;
+
+namespace
+{
+    /*!
+        @brief Keeps the results of the measured regions alive, so that the compiler doesn't remove them.
+     */
+    volatile size_t g_sink = 0;
+
+    void PrintHeader (const string &title, size_t elementCount, const CPerfCounters &counters) noexcept
+    {
+        cout << endl << title << ", " << elementCount << " elements" << endl
+             << left << setw (34) << "operation" << right << setw (10) << "ops" << setw (12) << "ns/op";
+
+        for (int i = 0; i < CPerfCounters::CounterCount; ++i)
+            cout << setw (12) << CPerfCounters::name (static_cast<CPerfCounters::ECounter> (i));
+
+        cout << endl;
+
+        if (!counters.anyAvailable ())
+            cout << "(hardware counters unavailable, wall-clock time only)" << endl;
+    }
+
+    /*!
+        @brief Prints the counts of @p sample divided by the @p ops operations it measured.
+     */
+    void Report (const char *operation, size_t ops, const CPerfCounters::CSample &sample) noexcept
+    {
+        cout << left << setw (34) << operation << right << setw (10) << ops
+             << fixed << setprecision (2) << setw (12) << sample.nanoseconds / ops;
+
+        for (int i = 0; i < CPerfCounters::CounterCount; ++i)
+            if (sample.available[i])
+                cout << setw (12) << sample.values[i] / ops;
+            else
+                cout << setw (12) << "n/a";
+
+        cout << endl;
+    }
+
+    template<typename T>
+    void RunTemplatedBenchmarks (const char *typeName, size_t elementCount) noexcept
+    {
+        CPerfCounters counters;
+        CCollection<T> data = CValueProvider<T> () (elementCount);
+
+        PrintHeader (string ("CList<") + typeName + ">", elementCount, counters);
+
+        CList<T> list;
+        Report ("push_back", elementCount, counters.measure ([&] ()
+        {
+            for (const T &x : data)
+                list.push_back (x);
+        }));
+
+        CList<T> front;
+        Report ("push_front", elementCount, counters.measure ([&] ()
+        {
+            for (const T &x : data)
+                front.push_front (x);
+        }));
+
+        Report ("traverse", elementCount, counters.measure ([&] ()
+        {
+            g_sink = g_sink + count (list.cbegin (), list.cend (), data[0]);
+        }));
+
+        Report ("copy", elementCount, counters.measure ([&] ()
+        {
+            CList<T> copy (list.cbegin (), list.cend ());
+            g_sink = g_sink + copy.size ();
+        }));
+
+        typename CList<T>::iterator middle = list.begin ();
+        advance (middle, elementCount / 2);
+        Report ("insert (middle)", elementCount, counters.measure ([&] ()
+        {
+            for (const T &x : data)
+                list.insert (middle, x);
+        }));
+
+        Report ("remove_if", list.size (), counters.measure ([&] ()
+        {
+            bool odd = false;
+            list.remove_if ([&odd] (const T &)
+            {
+                return odd = !odd;
+            });
+        }));
+
+        CList<T> spliced;
+        size_t splicedCount = front.size ();
+        Report ("splice (element)", splicedCount, counters.measure ([&] ()
+        {
+            while (!front.empty ())
+                spliced.splice (spliced.end (), front, front.begin ());
+        }));
+
+        // Back and forth, the nodes are moved without allocating
+        Report ("extract + insert", splicedCount, counters.measure ([&] ()
+        {
+            while (!spliced.empty ())
+                front.insert (front.end (), spliced.extract (spliced.begin ()));
+            spliced.swap (front);
+        }));
+
+        Report ("reverse", 1, counters.measure ([&] ()
+        {
+            spliced.reverse ();
+        }));
+
+        Report ("materialize_reverse", splicedCount, counters.measure ([&] ()
+        {
+            spliced.materialize_reverse ();
+        }));
+
+        Report ("erase (front)", splicedCount, counters.measure ([&] ()
+        {
+            while (!spliced.empty ())
+                spliced.erase (spliced.begin ());
+        }));
+
+        for (EDistribution distribution : { EDistribution::Random, EDistribution::Sorted, EDistribution::ReverseSorted,
+                                            EDistribution::NearlySorted, EDistribution::ManyDuplicates,
+                                            EDistribution::Zipfian, EDistribution::AllEqual })
+        {
+            CCollection<T> shaped = CValueProvider<T> () (elementCount, distribution);
+            string suffix = string (" (") + distributionName (distribution) + ")";
+
+            CList<T> sorted (shaped.cbegin (), shaped.cend ());
+            Report (("sort" + suffix).c_str (), elementCount, counters.measure ([&] ()
+            {
+                sorted.sort ();
+            }));
+
+            Report (("unique" + suffix).c_str (), elementCount, counters.measure ([&] ()
+            {
+                sorted.unique ();
+            }));
+
+            CList<T> deduped (shaped.cbegin (), shaped.cend ());
+            Report (("dedup" + suffix).c_str (), elementCount, counters.measure ([&] ()
+            {
+                g_sink = g_sink + deduped.dedup ();
+            }));
+        }
+
+        // Linear by relinking, on all the elements
+        CList<T> selected (data.cbegin (), data.cend ());
+        const T pivot = data[elementCount / 2];
+        Report ("stable_partition", elementCount, counters.measure ([&] ()
+        {
+            g_sink = g_sink + distance (selected.begin (), selected.stable_partition ([&pivot] (const T &x)
+            {
+                return x < pivot;
+            }));
+        }));
+
+        Report ("nth_element (median)", elementCount, counters.measure ([&] ()
+        {
+            g_sink = g_sink + (*selected.nth_element (elementCount / 2) == pivot);
+        }));
+
+        Report ("partial_sort (100)", elementCount, counters.measure ([&] ()
+        {
+            selected.partial_sort (100);
+        }));
+    }
+
+    /*!
+        @brief Measures lists filled by a thread and emptied by another one, whose nodes are freed by the
+               consumer. Only the wall-clock time is reported, the counters follow the calling thread alone.
+     */
+    void RunHandoffBenchmark (size_t elementCount) noexcept
+    {
+        const int rounds = 10;
+        CCollection<int> data = CValueProvider<int> () (elementCount);
+        CList<int> list;
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now ();
+        for (int round = 0; round < rounds; ++round)
+        {
+            thread producer ([&list, &data] ()
+            {
+                for (int x : data)
+                    list.push_back (x);
+            });
+            producer.join ();
+
+            thread consumer ([&list] ()
+            {
+                while (!list.empty ())
+                    list.pop_front ();
+            });
+            consumer.join ();
+        }
+
+        CPerfCounters::CSample sample = CPerfCounters::CSample ();
+        sample.nanoseconds = chrono::duration<double, nano> (chrono::steady_clock::now () - start).count ();
+
+        cout << endl << "CList<int> handoff between threads, " << elementCount << " elements" << endl;
+        Report ("push_back + pop_front", rounds * elementCount, sample);
+    }
+    /*!
+        @brief Runs @p readerCount threads calling @p read @p traversals times each, while the calling thread
+               calls @p write until they are done, and returns the wall-clock time of the readers.
+     */
+    template<class Read, class Write>
+    CPerfCounters::CSample MeasureReaders (size_t readerCount, size_t traversals, Read read, Write write) noexcept
+    {
+        atomic<size_t> running (readerCount);
+        vector<thread> readers;
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now ();
+        for (size_t i = 0; i < readerCount; ++i)
+            readers.emplace_back ([&running, &read, traversals] ()
+            {
+                read (traversals);
+                --running;
+            });
+
+        for (size_t i = 0; running; ++i)
+        {
+            write (i);
+            this_thread::yield ();
+        }
+
+        for (thread &reader : readers)
+            reader.join ();
+
+        CPerfCounters::CSample sample = CPerfCounters::CSample ();
+        sample.nanoseconds = chrono::duration<double, nano> (chrono::steady_clock::now () - start).count ();
+
+        return sample;
+    }
+
+    /*!
+        @brief Measures 1 to 8 threads traversing a list while a writer replaces its first element: a CRcuList
+               read without locks, then a CList whose readers and writer share a mutex. The time is per element
+               read by all the readers together, so it goes down as long as the readers scale.
+     */
+    void RunRcuReadersBenchmark (size_t elementCount) noexcept
+    {
+        const size_t traversals = 20;
+        CCollection<int> data = CValueProvider<int> () (elementCount);
+
+        cout << endl << "Readers of a list being written, " << elementCount << " elements, "
+             << thread::hardware_concurrency () << " hardware threads" << endl;
+
+        for (size_t readerCount : { 1, 2, 4, 8 })
+        {
+            CRcuList<int> rcu (readerCount);
+            for (int x : data)
+                rcu.push_back (x);
+
+            string operation = "CRcuList traverse (" + to_string (readerCount) + " readers)";
+            Report (operation.c_str (), readerCount * traversals * elementCount, MeasureReaders (readerCount, traversals,
+                    [&rcu, &data] (size_t count)
+                    {
+                        CRcuList<int>::CReader reader = rcu.reader ();
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            CRcuList<int>::CReadGuard guard (reader);
+                            g_sink = g_sink + std::count (rcu.cbegin (), rcu.cend (), data[0]);
+                        }
+                    },
+                    [&rcu, &data] (size_t i)
+                    {
+                        rcu.replace (rcu.begin (), data[i % data.size ()]);
+                        rcu.reclaim ();
+                    }));
+        }
+
+        for (size_t readerCount : { 1, 2, 4, 8 })
+        {
+            CList<int> list (data.cbegin (), data.cend ());
+            mutex listMutex;
+
+            string operation = "CList + mutex traverse (" + to_string (readerCount) + " readers)";
+            Report (operation.c_str (), readerCount * traversals * elementCount, MeasureReaders (readerCount, traversals,
+                    [&list, &listMutex, &data] (size_t count)
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            lock_guard<mutex> lock (listMutex);
+                            g_sink = g_sink + std::count (list.cbegin (), list.cend (), data[0]);
+                        }
+                    },
+                    [&list, &listMutex, &data] (size_t i)
+                    {
+                        lock_guard<mutex> lock (listMutex);
+                        *list.begin () = data[i % data.size ()];
+                    }));
+        }
+    }
+
+    /*!
+        @brief Measures a CBlockingList between a producer and a consumer thread, element by element and in
+               batches of @p batchSize, and reports the locks and wakeups per element.
+     */
+    void RunBlockingListBenchmark (size_t elementCount, size_t batchSize) noexcept
+    {
+        CCollection<int> data = CValueProvider<int> () (elementCount);
+        CBlockingList<int> queue (1024);
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now ();
+        thread consumer ([&queue, batchSize] ()
+        {
+            CList<int> batch;
+            int x;
+            if (batchSize == 1)
+                while (queue.pop (x))
+                    g_sink = g_sink + 1;
+            else
+                while (queue.pop_batch (batch, batchSize))
+                {
+                    g_sink = g_sink + batch.size ();
+                    batch.clear ();
+                }
+        });
+
+        CList<int> batch;
+        for (int x : data)
+            if (batchSize == 1)
+                queue.push (x);
+            else
+            {
+                batch.push_back (x);
+                if (batch.size () == batchSize)
+                    queue.push_batch (batch);
+            }
+        queue.push_batch (batch);
+        queue.close ();
+        consumer.join ();
+
+        CPerfCounters::CSample sample = CPerfCounters::CSample ();
+        sample.nanoseconds = chrono::duration<double, nano> (chrono::steady_clock::now () - start).count ();
+
+        string operation = "push + pop (batch " + to_string (batchSize) + ")";
+        Report (operation.c_str (), elementCount, sample);
+
+        CBlockingList<int>::CStats stats = queue.stats ();
+        cout << "    locks/element " << fixed << setprecision (3) << double (stats.locks) / elementCount
+             << ", wakeups/element " << double (stats.wakeups) / elementCount
+             << ", parks/element " << double (stats.parks) / elementCount << endl;
+    }
+    /*!
+        @brief Measures a CTimerWheel against a std::multimap ordered by deadline: scheduling @p elementCount
+               timers, cancelling half of them through their stored position, then expiring the others.
+     */
+    void RunTimerBenchmark (size_t elementCount) noexcept
+    {
+        const CTimerWheel<int>::tick_type maxDelay = 65536;
+        CPerfCounters counters;
+        vector<CTimerWheel<int>::tick_type> delays;
+        for (size_t i = 0; i < elementCount; ++i)
+            delays.push_back (rand (1, int (maxDelay)));
+
+        PrintHeader ("CTimerWheel<int>", elementCount, counters);
+
+        CTimerWheel<int> wheel;
+        vector<CTimerWheel<int>::iterator> timers;
+        timers.reserve (elementCount);
+        Report ("schedule", elementCount, counters.measure ([&] ()
+        {
+            for (size_t i = 0; i < elementCount; ++i)
+                timers.push_back (wheel.schedule (delays[i], int (i)));
+        }));
+
+        Report ("cancel", elementCount / 2, counters.measure ([&] ()
+        {
+            for (size_t i = 0; i < elementCount; i += 2)
+                wheel.cancel (timers[i]);
+        }));
+        timers.clear ();
+
+        Report ("expire", elementCount - elementCount / 2, counters.measure ([&] ()
+        {
+            g_sink = g_sink + wheel.advance (maxDelay, [] (const CTimerWheel<int>::CTimer &timer)
+            {
+                g_sink = g_sink + timer.value;
+            });
+        }));
+
+        PrintHeader ("std::multimap<tick, int>", elementCount, counters);
+
+        typedef multimap<CTimerWheel<int>::tick_type, int> CTimerMap;
+        CTimerMap map;
+        vector<CTimerMap::iterator> positions;
+        positions.reserve (elementCount);
+        Report ("schedule", elementCount, counters.measure ([&] ()
+        {
+            for (size_t i = 0; i < elementCount; ++i)
+                positions.push_back (map.emplace (delays[i], int (i)));
+        }));
+
+        Report ("cancel", elementCount / 2, counters.measure ([&] ()
+        {
+            for (size_t i = 0; i < elementCount; i += 2)
+                map.erase (positions[i]);
+        }));
+
+        Report ("expire", elementCount - elementCount / 2, counters.measure ([&] ()
+        {
+            for (CTimerWheel<int>::tick_type now = 1; now <= maxDelay; ++now)
+                while (!map.empty () && map.begin ()->first <= now)
+                {
+                    g_sink = g_sink + map.begin ()->second;
+                    map.erase (map.begin ());
+                }
+        }));
+    }
+    /*!
+        @brief Measures a bounded queue kept full while @p elementCount elements go through it, in a CStaticList
+               whose nodes are in the object, then in a CList.
+     */
+    void RunStaticListBenchmark (size_t elementCount) noexcept
+    {
+        const size_t capacity = 1024;
+        CPerfCounters counters;
+        CCollection<int> data = CValueProvider<int> () (elementCount);
+
+        PrintHeader ("CStaticList<int, 1024> (bounded queue)", elementCount, counters);
+
+        CStaticList<int, capacity> bounded;
+        Report ("pop_front + push_back", elementCount, counters.measure ([&] ()
+        {
+            for (const int &x : data)
+            {
+                if (bounded.full ())
+                    bounded.pop_front ();
+                bounded.push_back (x);
+            }
+        }));
+
+        Report ("traverse", bounded.size (), counters.measure ([&] ()
+        {
+            g_sink = g_sink + count (bounded.cbegin (), bounded.cend (), data[0]);
+        }));
+
+        PrintHeader ("CList<int> (bounded queue)", elementCount, counters);
+
+        CList<int> list;
+        Report ("pop_front + push_back", elementCount, counters.measure ([&] ()
+        {
+            for (const int &x : data)
+            {
+                if (list.size () == capacity)
+                    list.pop_front ();
+                list.push_back (x);
+            }
+        }));
+
+        Report ("traverse", list.size (), counters.measure ([&] ()
+        {
+            g_sink = g_sink + count (list.cbegin (), list.cend (), data[0]);
+        }));
+    }
+    /*!
+        @brief Measures the traversal of a list whose nodes are linked in a random order, with the slabs from
+               operator new then from the CHugePageArena, and reports the huge page coverage obtained. Each list
+               is built by a new thread, so that its caches allocate new slabs.
+     */
+    void RunHugePageBenchmark (size_t elementCount) noexcept
+    {
+        CCollection<int> data = CValueProvider<int> () (elementCount);
+
+        for (bool huge : { false, true })
+        {
+            CHugePageArena::setEnabled (huge);
+
+            thread user ([&data, elementCount, huge] ()
+            {
+                CPerfCounters counters;
+                CList<int> list (data.cbegin (), data.cend ());
+
+                // Shuffles the order of the nodes, so that the traversal jumps between pages
+                vector<CList<int>::iterator> nodes;
+                for (CList<int>::iterator itr = list.begin (); itr != list.end (); ++itr)
+                    nodes.push_back (itr);
+                for (size_t i = nodes.size (); i > 1; --i)
+                    swap (nodes[i - 1], nodes[rand (0, int (i - 1))]);
+
+                CList<int> shuffled;
+                for (CList<int>::iterator &node : nodes)
+                    shuffled.splice (shuffled.end (), list, node);
+                nodes.clear ();
+
+                PrintHeader (huge ? "CList<int> (huge page arena)" : "CList<int> (operator new slabs)", elementCount, counters);
+                Report ("traverse (shuffled)", elementCount, counters.measure ([&] ()
+                {
+                    g_sink = g_sink + count (shuffled.cbegin (), shuffled.cend (), data[0]);
+                }));
+
+                if (huge)
+                {
+                    CHugePageArena::CStats stats = CHugePageArena::instance ().stats ();
+                    cout << "huge page arena: " << stats.regions << " regions, " << (stats.mappedBytes >> 20)
+                         << " MiB mapped (" << (stats.hugetlbBytes >> 20) << " MiB MAP_HUGETLB, "
+                         << (stats.advisedBytes >> 20) << " MiB MADV_HUGEPAGE), " << (stats.usedBytes >> 20)
+                         << " MiB used, coverage " << fixed << setprecision (1) << 100 * stats.coverage () << "%" << endl;
+                }
+            });
+            user.join ();
+        }
+
+        CHugePageArena::setEnabled (false);
+    }
+}
+
+void CBenchmarks::RunBenchmarks (size_t elementCount) noexcept
+{
+    cout << "Starting benchmarks..." << endl;
+
+    seedValues (time (NULL));
+
+    RunTemplatedBenchmarks<int> ("int", elementCount);
+    RunTemplatedBenchmarks<shared_ptr<int>> ("shared_ptr<int>", elementCount);
+    RunTemplatedBenchmarks<TestClass> ("TestClass", elementCount);
+
+    RunHandoffBenchmark (elementCount);
+
+    RunRcuReadersBenchmark (elementCount);
+
+    cout << endl << "CBlockingList<int> between threads, " << elementCount << " elements" << endl;
+    for (size_t batchSize : { 1, 16, 64 })
+        RunBlockingListBenchmark (elementCount, batchSize);
+
+    RunTimerBenchmark (elementCount);
+
+    RunStaticListBenchmark (elementCount);
+
+    RunHugePageBenchmark (elementCount);
+
+    cout << endl << "Benchmarks done..." << endl;
+}
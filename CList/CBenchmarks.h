@@ -0,0 +1,29 @@
+/*!
+@file CBenchmarks.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CList benchmarks runner
+*/
+#pragma once
+
+#include <cstddef>
+
+namespace nsBench
+{
+    /*!
+        @brief Benchmark caller runnable. Each operation of CList is measured for each element type, and reported
+               per operation: wall-clock time, and the hardware counters of CPerfCounters when available.
+     */
+    class CBenchmarks
+    {
+    public:
+        /*!
+            @brief Run all the benchmarks on lists of @p elementCount elements.
+         */
+        static void RunBenchmarks (std::size_t elementCount) noexcept;
+
+    private:
+        CBenchmarks () = delete;
+    };
+}
@@ -0,0 +1,242 @@
+/*!
+@file CBlockingList.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CBlockingList class.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+#include "CList.h"
+
+namespace nsSdD
+{
+    template<typename T>
+    /*!
+       @brief CBlockingList is a bounded queue shared by producer and consumer threads, holding its elements in
+              a CList.
+
+              The batch operations move whole chains of nodes between the queue and the CList of the caller
+              by splicing them: a batch takes the lock once and wakes the other side at most once, whatever
+              its size, and no element is copied nor allocated under the lock. A thread which has to wait first
+              spins briefly on the number of elements, then parks on a condition variable. Threads are only
+              notified when some of them are parked.
+
+              Once closed, pushes fail and pops drain the remaining elements, then fail instead of waiting.
+    */
+    class CBlockingList
+    {
+    public:
+        /*!
+            @typedef size_type
+            @brief This define a @p size_t.
+         */
+        typedef size_t size_type;
+
+        /*!
+            @brief The counts of the synchronizations of a CBlockingList, since its construction.
+         */
+        struct CStats
+        {
+            /*!
+                @var locks
+                @brief The number of acquisitions of the lock by the operations.
+             */
+            size_type locks;
+
+            /*!
+                @var wakeups
+                @brief The number of notifications sent to parked threads.
+             */
+            size_type wakeups;
+
+            /*!
+                @var parks
+                @brief The number of times a thread parked on a condition variable.
+             */
+            size_type parks;
+        };
+
+        /*!
+            @brief  This is the constructor of an empty CBlockingList.
+            @param[in] capacity The maximum number of elements, at least 1.
+            @param[in] spinCount The number of checks of the elements before parking a waiting thread.
+         */
+        explicit CBlockingList (size_type capacity, size_type spinCount = 128) noexcept;
+
+        CBlockingList (const CBlockingList &) = delete;
+
+        CBlockingList &operator= (const CBlockingList &) = delete;
+
+        // Producers
+        /*!
+            @brief  This function adds @p x at the end, waiting while the CBlockingList is full.
+            @return True if added, false if the CBlockingList is closed.
+         */
+        bool push (const T &x) noexcept;
+
+        /*!
+            @brief  This function moves all the elements of @p batch at the end, waiting while the CBlockingList is
+                    full. The elements which fit are moved at once, a batch larger than the room left is moved in
+                    several parts.
+            @return True if all moved, false if the CBlockingList was closed: the elements not moved stay in @p batch.
+         */
+        bool push_batch (CList<T> &batch) noexcept;
+
+        /*!
+            @brief  Same as @p push_batch, waiting at most @p timeout.
+            @return True if all moved, false on timeout or closing: the elements not moved stay in @p batch.
+         */
+        template<class Rep, class Period>
+        bool push_batch (CList<T> &batch, const std::chrono::duration<Rep, Period> &timeout) noexcept;
+
+        // Consumers
+        /*!
+            @brief  This function removes the first element into @p x, waiting while the CBlockingList is empty.
+            @return True if removed, false if the CBlockingList is closed and drained.
+         */
+        bool pop (T &x) noexcept;
+
+        /*!
+            @brief  This function moves up to @p maxCount elements at the end of @p batch, waiting while the
+                    CBlockingList is empty. All the elements there are, up to @p maxCount, are moved at once.
+            @return The number of elements moved, 0 if the CBlockingList is closed and drained.
+         */
+        size_type pop_batch (CList<T> &batch, size_type maxCount) noexcept;
+
+        /*!
+            @brief  Same as @p pop_batch, waiting at most @p timeout.
+            @return The number of elements moved, 0 on timeout or if the CBlockingList is closed and drained.
+         */
+        template<class Rep, class Period>
+        size_type pop_batch (CList<T> &batch, size_type maxCount, const std::chrono::duration<Rep, Period> &timeout) noexcept;
+
+        // State
+        /*!
+            @brief  This function closes the CBlockingList and wakes all the parked threads. Pushes fail from now
+                    on, pops take the remaining elements then fail.
+         */
+        void close () noexcept;
+
+        /*!
+            @brief  This function return true if the CBlockingList is closed, false otherwise.
+         */
+        bool closed () const noexcept;
+
+        /*!
+            @brief  This function return the number of elements.
+         */
+        size_type size () const noexcept;
+
+        /*!
+            @brief  This function return the maximum number of elements.
+         */
+        size_type capacity () const noexcept;
+
+        /*!
+            @brief  This function return the counts of the synchronizations.
+         */
+        CStats stats () const noexcept;
+
+    private:
+        typedef std::chrono::steady_clock clock;
+
+        /*!
+            @brief  Waits until @p ready, spinning then parking on @p condition until @p deadline if @p timed.
+                    @p lock is acquired on return.
+            @return The value of @p ready, false on timeout or if the CBlockingList is closed.
+         */
+        template<class Ready>
+        bool wait (std::unique_lock<std::mutex> &lock, std::condition_variable &condition, size_type &waiting,
+                   Ready ready, bool timed, clock::time_point deadline) noexcept;
+
+        bool pushBatch (CList<T> &batch, bool timed, clock::time_point deadline) noexcept;
+
+        size_type popBatch (CList<T> &batch, size_type maxCount, bool timed, clock::time_point deadline) noexcept;
+
+        /*!
+            @brief  Moves the first @p count elements of @p from at the end of @p to, at once if they are all moved.
+         */
+        static void moveFront (CList<T> &to, CList<T> &from, size_type count) noexcept;
+
+        /*!
+            @brief  Wakes a thread parked on @p condition, if any. @p waiting is read under the lock.
+         */
+        void notify (std::condition_variable &condition, size_type waiting) noexcept;
+
+        /*!
+          @var     m_list
+          @brief  The elements.
+       */
+        CList<T> m_list;
+
+        /*!
+          @var     m_count
+          @brief  The number of elements, read without the lock by the spinning threads.
+       */
+        std::atomic<size_type> m_count;
+
+        /*!
+          @var     m_capacity
+          @brief  The maximum number of elements.
+       */
+        const size_type m_capacity;
+
+        /*!
+          @var     m_spinCount
+          @brief  The number of checks of m_count before parking.
+       */
+        const size_type m_spinCount;
+
+        /*!
+          @var     m_closed
+          @brief  If the CBlockingList was closed.
+       */
+        std::atomic<bool> m_closed;
+
+        /*!
+          @var     m_mutex
+          @brief  Protects m_list and the fields below.
+       */
+        mutable std::mutex m_mutex;
+
+        /*!
+          @var     m_notEmpty
+          @brief  The consumers park on it.
+       */
+        std::condition_variable m_notEmpty;
+
+        /*!
+          @var     m_notFull
+          @brief  The producers park on it.
+       */
+        std::condition_variable m_notFull;
+
+        /*!
+          @var     m_waitingConsumers
+          @brief  The number of parked consumers.
+       */
+        size_type m_waitingConsumers = 0;
+
+        /*!
+          @var     m_waitingProducers
+          @brief  The number of parked producers.
+       */
+        size_type m_waitingProducers = 0;
+
+        /*!
+          @var     m_stats
+          @brief  The counts of the synchronizations.
+       */
+        CStats m_stats = CStats ();
+    };
+}
+
+#include "CBlockingList.hxx"
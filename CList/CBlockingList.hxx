@@ -0,0 +1,224 @@
+/*!
+@file CBlockingList.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CBlockingList class implementation.
+*/
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+
+#include "CBlockingList.h"
+
+template<typename T>
+nsSdD::CBlockingList<T>::CBlockingList (size_type capacity, size_type spinCount /*= 128*/) noexcept
+        : m_count (0), m_capacity (std::max<size_type> (capacity, 1)), m_spinCount (spinCount), m_closed (false)
+{
+}
+
+template<typename T>
+bool nsSdD::CBlockingList<T>::push (const T &x) noexcept
+{
+    // The node is allocated before taking the lock
+    CList<T> batch;
+    batch.push_back (x);
+
+    return pushBatch (batch, false, clock::time_point ());
+}
+
+template<typename T>
+bool nsSdD::CBlockingList<T>::push_batch (CList<T> &batch) noexcept
+{
+    return pushBatch (batch, false, clock::time_point ());
+}
+
+template<typename T>
+template<class Rep, class Period>
+bool nsSdD::CBlockingList<T>::push_batch (CList<T> &batch, const std::chrono::duration<Rep, Period> &timeout) noexcept
+{
+    return pushBatch (batch, true, clock::now () + std::chrono::duration_cast<clock::duration> (timeout));
+}
+
+template<typename T>
+bool nsSdD::CBlockingList<T>::pop (T &x) noexcept
+{
+    CList<T> batch;
+    if (!popBatch (batch, 1, false, clock::time_point ()))
+        return false;
+
+    x = batch.front ();
+    return true;
+}
+
+template<typename T>
+typename nsSdD::CBlockingList<T>::size_type nsSdD::CBlockingList<T>::pop_batch (CList<T> &batch, size_type maxCount) noexcept
+{
+    return popBatch (batch, maxCount, false, clock::time_point ());
+}
+
+template<typename T>
+template<class Rep, class Period>
+typename nsSdD::CBlockingList<T>::size_type nsSdD::CBlockingList<T>::pop_batch (CList<T> &batch, size_type maxCount,
+                                                                               const std::chrono::duration<Rep, Period> &timeout) noexcept
+{
+    return popBatch (batch, maxCount, true, clock::now () + std::chrono::duration_cast<clock::duration> (timeout));
+}
+
+template<typename T>
+void nsSdD::CBlockingList<T>::close () noexcept
+{
+    std::lock_guard<std::mutex> lock (m_mutex);
+    ++m_stats.locks;
+
+    m_closed = true;
+
+    m_stats.wakeups += m_waitingConsumers + m_waitingProducers;
+    m_notEmpty.notify_all ();
+    m_notFull.notify_all ();
+}
+
+template<typename T>
+bool nsSdD::CBlockingList<T>::closed () const noexcept
+{
+    return m_closed;
+}
+
+template<typename T>
+typename nsSdD::CBlockingList<T>::size_type nsSdD::CBlockingList<T>::size () const noexcept
+{
+    return m_count.load (std::memory_order_acquire);
+}
+
+template<typename T>
+typename nsSdD::CBlockingList<T>::size_type nsSdD::CBlockingList<T>::capacity () const noexcept
+{
+    return m_capacity;
+}
+
+template<typename T>
+typename nsSdD::CBlockingList<T>::CStats nsSdD::CBlockingList<T>::stats () const noexcept
+{
+    std::lock_guard<std::mutex> lock (m_mutex);
+    return m_stats;
+}
+
+template<typename T>
+template<class Ready>
+bool nsSdD::CBlockingList<T>::wait (std::unique_lock<std::mutex> &lock, std::condition_variable &condition,
+                                    size_type &waiting, Ready ready, bool timed, clock::time_point deadline) noexcept
+{
+    if (ready (m_list.size ()))
+        return true;
+
+    if (m_closed)
+        return false;
+
+    // Spins without the lock, the other side may be about to make room or add elements
+    lock.unlock ();
+    for (size_type i = 0; i < m_spinCount && !ready (m_count.load (std::memory_order_acquire)) && !m_closed; ++i)
+        if (i >= m_spinCount / 2)
+            std::this_thread::yield ();
+    lock.lock ();
+    ++m_stats.locks;
+
+    while (!ready (m_list.size ()))
+    {
+        if (m_closed)
+            return false;
+
+        ++waiting;
+        ++m_stats.parks;
+        bool timeout = false;
+        if (timed)
+            timeout = condition.wait_until (lock, deadline) == std::cv_status::timeout;
+        else
+            condition.wait (lock);
+        --waiting;
+
+        if (timeout)
+            return ready (m_list.size ());
+    }
+
+    return true;
+}
+
+template<typename T>
+bool nsSdD::CBlockingList<T>::pushBatch (CList<T> &batch, bool timed, clock::time_point deadline) noexcept
+{
+    while (!batch.empty ())
+    {
+        std::unique_lock<std::mutex> lock (m_mutex);
+        ++m_stats.locks;
+
+        if (!wait (lock, m_notFull, m_waitingProducers, [this] (size_type count)
+        {
+            return count < m_capacity;
+        }, timed, deadline) || m_closed)
+            return false;
+
+        moveFront (m_list, batch, std::min (batch.size (), m_capacity - m_list.size ()));
+        m_count.store (m_list.size (), std::memory_order_release);
+
+        notify (m_notEmpty, m_waitingConsumers);
+        // Another producer may use the room left
+        if (m_list.size () < m_capacity)
+            notify (m_notFull, m_waitingProducers);
+    }
+
+    return true;
+}
+
+template<typename T>
+typename nsSdD::CBlockingList<T>::size_type nsSdD::CBlockingList<T>::popBatch (CList<T> &batch, size_type maxCount,
+                                                                              bool timed, clock::time_point deadline) noexcept
+{
+    if (maxCount == 0)
+        return 0;
+
+    std::unique_lock<std::mutex> lock (m_mutex);
+    ++m_stats.locks;
+
+    if (!wait (lock, m_notEmpty, m_waitingConsumers, [] (size_type count)
+    {
+        return count > 0;
+    }, timed, deadline))
+        return 0;
+
+    size_type moved = std::min (maxCount, m_list.size ());
+    moveFront (batch, m_list, moved);
+    m_count.store (m_list.size (), std::memory_order_release);
+
+    notify (m_notFull, m_waitingProducers);
+    // Another consumer may take the elements left
+    if (!m_list.empty ())
+        notify (m_notEmpty, m_waitingConsumers);
+
+    return moved;
+}
+
+template<typename T>
+void nsSdD::CBlockingList<T>::moveFront (CList<T> &to, CList<T> &from, size_type count) noexcept
+{
+    if (count == from.size ())
+    {
+        to.splice (to.end (), from);
+        return;
+    }
+
+    typename CList<T>::iterator last = from.begin ();
+    std::advance (last, count);
+    to.splice (to.end (), from, from.begin (), last);
+}
+
+template<typename T>
+void nsSdD::CBlockingList<T>::notify (std::condition_variable &condition, size_type waiting) noexcept
+{
+    if (waiting == 0)
+        return;
+
+    ++m_stats.wakeups;
+    condition.notify_one ();
+}
@@ -18,8 +18,8 @@ template<typename T> using CConstIterBase = std::iterator<std::bidirectional_ite
 /*!
     @brief Sister const class to CIterator
  */
-template<typename T>
-struct nsSdD::CList<T>::CConstIterator : public CConstIterBase<T>
+template<typename T, class Policy>
+struct nsSdD::CList<T, Policy>::CConstIterator : public CConstIterBase<T>
 {
 private:
     /*!
@@ -28,13 +28,28 @@ private:
    */
     CNodePtr node;
 
+    /*!
+       @var reversed
+       @brief If the CList of the iterator is reversed, the iterator then moves against the links of the nodes.
+   */
+    bool reversed;
+
 public:
     /*!
-        @fn             CConstIterator (CNodePtr p = nullptr) noexcept
+        @fn             CConstIterator (CNodePtr p = nullptr, bool r = false) noexcept
         @brief          The default constructor of the const_iterator for the CList class.
         @param[in] p    The the node we want to use to construct the iterator.
+        @param[in] r    If the CList of the node is reversed.
+    */
+    CConstIterator (CNodePtr p = nullptr, bool r = false) noexcept : node (std::move (p)), reversed (r)
+    {
+    }
+
+    /*!
+        @fn             CConstIterator (const CIterator &other) noexcept
+        @brief          The constructor of the const_iterator on the same node, in the same direction, as @p other.
     */
-    CConstIterator (CNodePtr p = nullptr) noexcept : node (p)
+    CConstIterator (const CIterator &other) noexcept : node (other.getNode ()), reversed (other.isReversed ())
     {
     }
 
@@ -80,7 +95,7 @@ public:
     */
     CConstIterator &operator++ () noexcept
     {
-        node = node->getNext ();
+        node = reversed ? node->getPrevious () : node->getNext ();
         return *this;
     }
 
@@ -91,7 +106,7 @@ public:
     */
     CConstIterator &operator-- () noexcept
     {
-        node = node->getPrevious ();
+        node = reversed ? node->getNext () : node->getPrevious ();
         return *this;
     }
 
@@ -103,7 +118,7 @@ public:
     CConstIterator operator++ (int) noexcept
     {
         CConstIterator temp = *this;
-        node = node->getNext ();
+        node = reversed ? node->getPrevious () : node->getNext ();
         return temp;
     }
 
@@ -115,7 +130,7 @@ public:
     CConstIterator operator-- (int) noexcept
     {
         CConstIterator temp = *this;
-        node = node->getPrevious ();
+        node = reversed ? node->getNext () : node->getPrevious ();
         return temp;
     }
 
@@ -144,7 +159,7 @@ public:
        @brief The function return the node of the pointer.
        @return  CNodePtr The node of the pointer.
     */
-    CNodePtr getNode () const noexcept
+    const CNodePtr &getNode () const noexcept
     {
         return node;
     }
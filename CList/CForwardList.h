@@ -0,0 +1,381 @@
+/*!
+@file CForwardList.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CForwardList class.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace nsSdD
+{
+    template<typename T>
+    /*!
+       @brief CForwardList is the singly linked sibling of CList, for lists only used as one-directional queues:
+              push_back, pop_front and forward iteration. A node holds the value and a single raw link, and
+              updating the links writes one pointer instead of two.
+              As with std::forward_list, positions are given by the element before them: insert_after,
+              erase_after and splice_after. Unlike std::forward_list, the last node is tracked, so that
+              push_back and back are O(1), and so is the size.
+    */
+    class CForwardList
+    {
+        // Types
+    private:
+        struct CIterator;
+
+        struct CConstIterator;
+
+        /*!
+            @brief The link of a node, alone in the sentinel before the first node.
+         */
+        struct CNodeBase
+        {
+            CNodeBase *m_next;
+        };
+
+        /*!
+            @brief A node, holding a value of type T.
+         */
+        struct CNode : public CNodeBase
+        {
+            T m_info;
+
+            template<typename... Args>
+            explicit CNode (CNodeBase *next, Args &&... args) noexcept : CNodeBase {next}, m_info (std::forward<Args> (args)...)
+            {
+            }
+        };
+
+    public:
+        /*!
+            @typedef size_type
+            @brief This define a @p size_t.
+         */
+        typedef size_t size_type;
+
+        /*!
+            @typedef iterator
+            @brief This define a @p CIterator, a forward iterator.
+         */
+        typedef CIterator iterator;
+
+        /*!
+            @typedef const_iterator
+            @brief This define a @p CConstIterator, a forward const iterator.
+         */
+        typedef CConstIterator const_iterator;
+
+        /*!
+            @brief This is the default constructor of the class CForwardList.
+         */
+        CForwardList () noexcept;
+
+        /*!
+            @brief  This is the constructor of a CForwardList of @p n elements equal to @p val.
+            @param[in] n The size of the CForwardList we want.
+            @param[in] val The value we want to insert in each element.
+         */
+        explicit CForwardList (size_type n, const T &val = T ()) noexcept;
+
+        /*!
+            @brief  This is the constructor copying the elements from @p first to @p last.
+                    Only iterators take this overload, so that (n, val) of integers isn't a range.
+            @param[in] first The first element we want to copy.
+            @param[in] last The element following the last one we want to copy.
+         */
+        template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        CForwardList (InputIterator first, InputIterator last) noexcept;
+
+        /*!
+            @brief This is the copy-constructor of the class CForwardList.
+            @param[in] x The CForwardList we want to copy.
+         */
+        CForwardList (const CForwardList &x) noexcept;
+
+        /*!
+            @brief This is the move-constructor, the nodes of @p x are taken as they are and @p x is left empty.
+            @param[in] x The CForwardList we take the nodes of.
+         */
+        CForwardList (CForwardList &&x) noexcept;
+
+        /*!
+            @brief This is the operator= copying the elements of @p x.
+         */
+        CForwardList &operator= (const CForwardList &x) noexcept;
+
+        /*!
+            @brief This is the operator= taking the nodes of @p x, which is left empty.
+         */
+        CForwardList &operator= (CForwardList &&x) noexcept;
+
+        /*!
+            @brief The destructor frees the nodes iteratively, so that long lists don't overflow the stack.
+         */
+        ~CForwardList () noexcept;
+
+        // iterators
+        /*!
+            @brief  This function return an iterator to the position before the first element,
+                    to insert at the beginning with the *_after functions.
+         */
+        iterator before_begin () noexcept;
+
+        /*!
+            @brief  This function return an iterator to the begin of the CForwardList.
+         */
+        iterator begin () noexcept;
+
+        /*!
+            @brief  This function return an iterator to the end of the CForwardList.
+         */
+        iterator end () noexcept;
+
+        /*!
+            @brief  This function return an iterator to the last element, or before_begin () if the list is empty,
+                    to insert at the end with the *_after functions.
+         */
+        iterator before_end () noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the position before the first element.
+         */
+        const_iterator cbefore_begin () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the begin of the CForwardList.
+         */
+        const_iterator cbegin () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the end of the CForwardList.
+         */
+        const_iterator cend () const noexcept;
+
+        // Capacity
+        /*!
+            @brief  This function return true if the CForwardList is empty, false otherwise.
+         */
+        bool empty () const noexcept;
+
+        /*!
+            @brief  This function return the number of elements, in O(1).
+         */
+        size_type size () const noexcept;
+
+        // Element access
+        /*!
+            @brief  This function return a reference to the first element.
+         */
+        T &front () noexcept;
+
+        /*!
+            @brief  This function return a reference to the last element, in O(1).
+         */
+        T &back () noexcept;
+
+        // Modifiers
+        /*!
+            @brief  This function replaces the content by @p n elements equal to @p val.
+         */
+        void assign (size_type n, const T &val) noexcept;
+
+        /*!
+            @brief  This function replaces the content by the elements from @p first to @p last.
+         */
+        template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        void assign (InputIterator first, InputIterator last) noexcept;
+
+        /*!
+            @brief  This function adds @p x at the beginning.
+         */
+        void push_front (const T &x) noexcept;
+
+        /*!
+            @brief  This function adds @p x at the end, in O(1).
+         */
+        void push_back (const T &x) noexcept;
+
+        /*!
+            @brief  This function removes the first element.
+         */
+        void pop_front () noexcept;
+
+        /*!
+            @brief  This function constructs an element at the beginning from @p args.
+            @return An iterator to the new element.
+         */
+        template<class... Args>
+        iterator emplace_front (Args &&... args) noexcept;
+
+        /*!
+            @brief  This function constructs an element at the end from @p args, in O(1).
+            @return An iterator to the new element.
+         */
+        template<class... Args>
+        iterator emplace_back (Args &&... args) noexcept;
+
+        /*!
+            @brief  This function constructs an element after @p position from @p args.
+            @param[in] position The element after which we want to insert.
+            @param[in] args The arguments of the constructor of T.
+            @return An iterator to the new element.
+         */
+        template<class... Args>
+        iterator emplace_after (const_iterator position, Args &&... args) noexcept;
+
+        /*!
+            @brief  This function inserts @p val after @p position.
+            @return An iterator to the new element.
+         */
+        iterator insert_after (const_iterator position, const T &val) noexcept;
+
+        /*!
+            @brief  This function inserts @p n elements equal to @p val after @p position.
+            @return An iterator to the last inserted element, @p position if @p n is 0.
+         */
+        iterator insert_after (const_iterator position, size_type n, const T &val) noexcept;
+
+        /*!
+            @brief  This function inserts the elements from @p first to @p last after @p position.
+            @return An iterator to the last inserted element, @p position if the range is empty.
+         */
+        template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        iterator insert_after (const_iterator position, InputIterator first, InputIterator last) noexcept;
+
+        /*!
+            @brief  This function erases the element following @p position.
+            @return An iterator to the element following the erased one.
+         */
+        iterator erase_after (const_iterator position) noexcept;
+
+        /*!
+            @brief  This function erases the elements between @p position and @p last, both excluded.
+            @return @p last
+         */
+        iterator erase_after (const_iterator position, const_iterator last) noexcept;
+
+        /*!
+            @brief  This function swaps the elements of the two CForwardList in O(1).
+         */
+        void swap (CForwardList &x) noexcept;
+
+        /*!
+            @brief  This function resizes the CForwardList to @p n elements, adding copies of @p val if needed.
+         */
+        void resize (size_type n, const T &val = T ()) noexcept;
+
+        /*!
+            @brief  This function erases all the elements.
+         */
+        void clear () noexcept;
+
+        // Operations
+        /*!
+            @brief  This function moves all the elements of @p x after @p position, in O(1).
+            @param[in] position The element after which we want to move the elements.
+            @param[in] x The CForwardList we take the elements of, empty afterwards.
+         */
+        void splice_after (const_iterator position, CForwardList &x) noexcept;
+
+        /*!
+            @brief  This function moves the element following @p i in @p x after @p position, in O(1).
+         */
+        void splice_after (const_iterator position, CForwardList &x, const_iterator i) noexcept;
+
+        /*!
+            @brief  This function moves the elements of @p x between @p first and @p last, both excluded,
+                    after @p position. Linear in the number of moved elements when @p x is another list,
+                    to keep both sizes.
+         */
+        void splice_after (const_iterator position, CForwardList &x, const_iterator first, const_iterator last) noexcept;
+
+        /*!
+            @brief  This function removes the elements equal to @p val.
+         */
+        void remove (const T &val) noexcept;
+
+        /*!
+            @brief  This function removes the elements for which @p pred is true.
+         */
+        template<class Predicate>
+        void remove_if (Predicate pred) noexcept;
+
+        /*!
+            @brief  This function removes the elements equal to the one before them.
+         */
+        void unique () noexcept;
+
+        /*!
+            @brief  This function removes the elements for which @p pred is true with the one before them.
+         */
+        template<class Compare>
+        void unique (Compare pred) noexcept;
+
+        /*!
+            @brief  This function merges the sorted @p x into the sorted CForwardList, in linear time.
+         */
+        void merge (CForwardList &x) noexcept;
+
+        /*!
+            @brief  This function merges @p x, sorted by @p comp, into the CForwardList sorted by @p comp.
+         */
+        template<class Compare>
+        void merge (CForwardList &x, Compare comp) noexcept;
+
+        /*!
+            @brief  This function sorts the CForwardList in ascending order, in O(n log n), by relinking. Stable.
+         */
+        void sort () noexcept;
+
+        /*!
+            @brief  This function sorts the CForwardList with @p comp, in O(n log n), by relinking. Stable.
+         */
+        template<class Compare>
+        void sort (Compare comp) noexcept;
+
+        /*!
+            @brief  This function reverses the order of the elements by relinking.
+         */
+        void reverse () noexcept;
+
+    private:
+        /*!
+            @brief  Merges the null-terminated sorted chains @p a and @p b, @p a going first among equal elements.
+            @param[out] last The last node of the merged chain.
+            @return The first node of the merged chain.
+         */
+        template<class Compare>
+        static CNodeBase *mergeChains (CNodeBase *a, CNodeBase *b, Compare comp, CNodeBase *&last) noexcept;
+
+        /*!
+            @brief  Links the new node @p node after @p position, updating the tail and the size.
+         */
+        iterator linkAfter (CNodeBase *position, CNode *node) noexcept;
+
+        /*!
+          @var     m_beforeBegin
+          @brief  The sentinel before the first node, holding no value.
+       */
+        CNodeBase m_beforeBegin;
+
+        /*!
+          @var     m_tail
+          @brief  The last node, &m_beforeBegin if the CForwardList is empty.
+       */
+        CNodeBase *m_tail;
+
+        /*!
+          @var     m_size
+          @brief  The number of elements.
+       */
+        size_type m_size;
+    };
+}
+
+#include "CForwardList.hxx"
@@ -0,0 +1,651 @@
+/*!
+@file CForwardList.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CForwardList class and iterators implementation.
+*/
+#pragma once
+
+#include "CForwardList.h"
+
+/*!
+    @brief Forward iterator of CForwardList.
+ */
+template<typename T>
+struct nsSdD::CForwardList<T>::CIterator : public std::iterator<std::forward_iterator_tag, T>
+{
+private:
+    /*!
+        @var node
+        @brief The current node of the iterator, nullptr at the end.
+    */
+    CNodeBase *node;
+
+public:
+    CIterator (CNodeBase *p = nullptr) noexcept : node (p)
+    {
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return node == other.node;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return node != other.node;
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        node = node->m_next;
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        node = node->m_next;
+        return temp;
+    }
+
+    T *operator-> () const noexcept
+    {
+        return &static_cast<CNode *> (node)->m_info;
+    }
+
+    T &operator* () const noexcept
+    {
+        return static_cast<CNode *> (node)->m_info;
+    }
+
+    /*!
+      @brief The function return the node the iterator is on.
+   */
+    CNodeBase *getNode () const noexcept
+    {
+        return node;
+    }
+};
+
+/*!
+    @brief Sister const class to CIterator
+ */
+template<typename T>
+struct nsSdD::CForwardList<T>::CConstIterator : public std::iterator<std::forward_iterator_tag, const T, std::ptrdiff_t, const T *, const T &>
+{
+private:
+    /*!
+        @var node
+        @brief The current node of the iterator, nullptr at the end.
+    */
+    const CNodeBase *node;
+
+public:
+    CConstIterator (const CNodeBase *p = nullptr) noexcept : node (p)
+    {
+    }
+
+    CConstIterator (const CIterator &other) noexcept : node (other.getNode ())
+    {
+    }
+
+    bool operator== (const CConstIterator &other) const noexcept
+    {
+        return node == other.node;
+    }
+
+    bool operator!= (const CConstIterator &other) const noexcept
+    {
+        return node != other.node;
+    }
+
+    CConstIterator &operator++ () noexcept
+    {
+        node = node->m_next;
+        return *this;
+    }
+
+    CConstIterator operator++ (int) noexcept
+    {
+        CConstIterator temp = *this;
+        node = node->m_next;
+        return temp;
+    }
+
+    const T *operator-> () const noexcept
+    {
+        return &static_cast<const CNode *> (node)->m_info;
+    }
+
+    const T &operator* () const noexcept
+    {
+        return static_cast<const CNode *> (node)->m_info;
+    }
+
+    /*!
+      @brief The function return the node the iterator is on, writable: only the list hands out const_iterator.
+   */
+    CNodeBase *getNode () const noexcept
+    {
+        return const_cast<CNodeBase *> (node);
+    }
+};
+
+template<typename T>
+nsSdD::CForwardList<T>::CForwardList () noexcept : m_beforeBegin {nullptr}, m_tail (&m_beforeBegin), m_size (0)
+{
+}
+
+template<typename T>
+nsSdD::CForwardList<T>::CForwardList (size_type n, const T &val) noexcept : CForwardList ()
+{
+    insert_after (cbefore_begin (), n, val);
+}
+
+template<typename T>
+template<class InputIterator, class>
+nsSdD::CForwardList<T>::CForwardList (InputIterator first, InputIterator last) noexcept : CForwardList ()
+{
+    insert_after (cbefore_begin (), first, last);
+}
+
+template<typename T>
+nsSdD::CForwardList<T>::CForwardList (const CForwardList &x) noexcept : CForwardList ()
+{
+    insert_after (cbefore_begin (), x.cbegin (), x.cend ());
+}
+
+template<typename T>
+nsSdD::CForwardList<T>::CForwardList (CForwardList &&x) noexcept : CForwardList ()
+{
+    swap (x);
+}
+
+template<typename T>
+nsSdD::CForwardList<T> &nsSdD::CForwardList<T>::operator= (const CForwardList &x) noexcept
+{
+    if (this != &x)
+        assign (x.cbegin (), x.cend ());
+
+    return *this;
+}
+
+template<typename T>
+nsSdD::CForwardList<T> &nsSdD::CForwardList<T>::operator= (CForwardList &&x) noexcept
+{
+    if (this != &x)
+    {
+        clear ();
+        swap (x);
+    }
+
+    return *this;
+}
+
+template<typename T>
+nsSdD::CForwardList<T>::~CForwardList () noexcept
+{
+    clear ();
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::before_begin () noexcept
+{
+    return iterator (&m_beforeBegin);
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::begin () noexcept
+{
+    return iterator (m_beforeBegin.m_next);
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::end () noexcept
+{
+    return iterator ();
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::before_end () noexcept
+{
+    return iterator (m_tail);
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::const_iterator nsSdD::CForwardList<T>::cbefore_begin () const noexcept
+{
+    return const_iterator (&m_beforeBegin);
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::const_iterator nsSdD::CForwardList<T>::cbegin () const noexcept
+{
+    return const_iterator (m_beforeBegin.m_next);
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::const_iterator nsSdD::CForwardList<T>::cend () const noexcept
+{
+    return const_iterator ();
+}
+
+template<typename T>
+bool nsSdD::CForwardList<T>::empty () const noexcept
+{
+    return m_size == 0;
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::size_type nsSdD::CForwardList<T>::size () const noexcept
+{
+    return m_size;
+}
+
+template<typename T>
+T &nsSdD::CForwardList<T>::front () noexcept
+{
+    return *begin ();
+}
+
+template<typename T>
+T &nsSdD::CForwardList<T>::back () noexcept
+{
+    return *before_end ();
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::assign (size_type n, const T &val) noexcept
+{
+    clear ();
+    insert_after (cbefore_begin (), n, val);
+}
+
+template<typename T>
+template<class InputIterator, class>
+void nsSdD::CForwardList<T>::assign (InputIterator first, InputIterator last) noexcept
+{
+    clear ();
+    insert_after (cbefore_begin (), first, last);
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::push_front (const T &x) noexcept
+{
+    emplace_front (x);
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::push_back (const T &x) noexcept
+{
+    emplace_back (x);
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::pop_front () noexcept
+{
+    erase_after (cbefore_begin ());
+}
+
+template<typename T>
+template<class... Args>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::emplace_front (Args &&... args) noexcept
+{
+    return emplace_after (cbefore_begin (), std::forward<Args> (args)...);
+}
+
+template<typename T>
+template<class... Args>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::emplace_back (Args &&... args) noexcept
+{
+    return emplace_after (const_iterator (m_tail), std::forward<Args> (args)...);
+}
+
+template<typename T>
+template<class... Args>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::emplace_after (const_iterator position, Args &&... args) noexcept
+{
+    CNodeBase *previous = position.getNode ();
+    return linkAfter (previous, new CNode (previous->m_next, std::forward<Args> (args)...));
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::insert_after (const_iterator position, const T &val) noexcept
+{
+    return emplace_after (position, val);
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::insert_after (const_iterator position, size_type n, const T &val) noexcept
+{
+    iterator last (position.getNode ());
+    for (; n; --n)
+        last = emplace_after (last, val);
+
+    return last;
+}
+
+template<typename T>
+template<class InputIterator, class>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::insert_after (const_iterator position, InputIterator first, InputIterator last) noexcept
+{
+    iterator inserted (position.getNode ());
+    for (; first != last; ++first)
+        inserted = emplace_after (inserted, *first);
+
+    return inserted;
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::erase_after (const_iterator position) noexcept
+{
+    CNodeBase *previous = position.getNode ();
+    CNodeBase *erased = previous->m_next;
+
+    previous->m_next = erased->m_next;
+    if (erased == m_tail)
+        m_tail = previous;
+
+    delete static_cast<CNode *> (erased);
+    --m_size;
+
+    return iterator (previous->m_next);
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::erase_after (const_iterator position, const_iterator last) noexcept
+{
+    while (std::next (position) != last)
+        erase_after (position);
+
+    return iterator (last.getNode ());
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::swap (CForwardList &x) noexcept
+{
+    std::swap (m_beforeBegin.m_next, x.m_beforeBegin.m_next);
+    std::swap (m_size, x.m_size);
+    std::swap (m_tail, x.m_tail);
+
+    // An empty list's tail is its own sentinel, which doesn't move.
+    if (m_tail == &x.m_beforeBegin)
+        m_tail = &m_beforeBegin;
+    if (x.m_tail == &m_beforeBegin)
+        x.m_tail = &x.m_beforeBegin;
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::resize (size_type n, const T &val) noexcept
+{
+    if (n >= m_size)
+    {
+        insert_after (const_iterator (m_tail), n - m_size, val);
+        return;
+    }
+
+    const_iterator last = cbefore_begin ();
+    std::advance (last, n);
+    erase_after (last, cend ());
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::clear () noexcept
+{
+    for (CNodeBase *node = m_beforeBegin.m_next; node;)
+    {
+        CNodeBase *next = node->m_next;
+        delete static_cast<CNode *> (node);
+        node = next;
+    }
+
+    m_beforeBegin.m_next = nullptr;
+    m_tail = &m_beforeBegin;
+    m_size = 0;
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::splice_after (const_iterator position, CForwardList &x) noexcept
+{
+    if (&x == this || x.empty ())
+        return;
+
+    // The whole of x moves: its ends and its size are known, nothing is walked.
+    CNodeBase *target = position.getNode ();
+    x.m_tail->m_next = target->m_next;
+    target->m_next = x.m_beforeBegin.m_next;
+    if (target == m_tail)
+        m_tail = x.m_tail;
+
+    m_size += x.m_size;
+    x.m_beforeBegin.m_next = nullptr;
+    x.m_tail = &x.m_beforeBegin;
+    x.m_size = 0;
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::splice_after (const_iterator position, CForwardList &x, const_iterator i) noexcept
+{
+    CNodeBase *moved = i.getNode ()->m_next;
+    if (!moved || position.getNode () == i.getNode () || position.getNode () == moved)
+        return;
+
+    splice_after (position, x, i, const_iterator (moved->m_next));
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::splice_after (const_iterator position, CForwardList &x, const_iterator first, const_iterator last) noexcept
+{
+    CNodeBase *before = first.getNode ();
+    CNodeBase *begin = before->m_next;
+    if (begin == last.getNode ())
+        return;
+
+    // The last moved node is needed to relink, the count only if the elements change of list.
+    size_type count = 1;
+    CNodeBase *end = begin;
+    while (end->m_next != last.getNode ())
+    {
+        end = end->m_next;
+        ++count;
+    }
+
+    before->m_next = end->m_next;
+    if (end == x.m_tail)
+        x.m_tail = before;
+
+    CNodeBase *target = position.getNode ();
+    end->m_next = target->m_next;
+    target->m_next = begin;
+    if (target == m_tail)
+        m_tail = end;
+
+    if (&x != this)
+    {
+        x.m_size -= count;
+        m_size += count;
+    }
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::remove (const T &val) noexcept
+{
+    remove_if ([&val] (const T &x)
+    {
+        return x == val;
+    });
+}
+
+template<typename T>
+template<class Predicate>
+void nsSdD::CForwardList<T>::remove_if (Predicate pred) noexcept
+{
+    for (const_iterator previous = cbefore_begin (); previous.getNode ()->m_next;)
+    {
+        if (pred (static_cast<CNode *> (previous.getNode ()->m_next)->m_info))
+            erase_after (previous);
+        else
+            ++previous;
+    }
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::unique () noexcept
+{
+    unique ([] (const T &a, const T &b)
+    {
+        return a == b;
+    });
+}
+
+template<typename T>
+template<class Compare>
+void nsSdD::CForwardList<T>::unique (Compare pred) noexcept
+{
+    if (empty ())
+        return;
+
+    for (const_iterator previous = cbegin (); previous.getNode ()->m_next;)
+    {
+        if (pred (*previous, static_cast<CNode *> (previous.getNode ()->m_next)->m_info))
+            erase_after (previous);
+        else
+            ++previous;
+    }
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::merge (CForwardList &x) noexcept
+{
+    merge (x, [] (const T &a, const T &b)
+    {
+        return a < b;
+    });
+}
+
+template<typename T>
+template<class Compare>
+void nsSdD::CForwardList<T>::merge (CForwardList &x, Compare comp) noexcept
+{
+    if (&x == this || x.empty ())
+        return;
+
+    CNodeBase *last;
+    m_beforeBegin.m_next = mergeChains (m_beforeBegin.m_next, x.m_beforeBegin.m_next, comp, last);
+    m_tail = last;
+    m_size += x.m_size;
+
+    x.m_beforeBegin.m_next = nullptr;
+    x.m_tail = &x.m_beforeBegin;
+    x.m_size = 0;
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::sort () noexcept
+{
+    sort ([] (const T &a, const T &b)
+    {
+        return a < b;
+    });
+}
+
+template<typename T>
+template<class Compare>
+void nsSdD::CForwardList<T>::sort (Compare comp) noexcept
+{
+    if (m_size < 2)
+        return;
+
+    // Bottom-up merge sort: buckets[i] holds a sorted chain of 2^i nodes, older than any node carried in.
+    CNodeBase *buckets[64] = {};
+    size_t fill = 0;
+    CNodeBase *last;
+
+    for (CNodeBase *node = m_beforeBegin.m_next; node;)
+    {
+        CNodeBase *carry = node;
+        node = node->m_next;
+        carry->m_next = nullptr;
+
+        size_t i = 0;
+        for (; i < fill && buckets[i]; ++i)
+        {
+            carry = mergeChains (buckets[i], carry, comp, last);
+            buckets[i] = nullptr;
+        }
+
+        buckets[i] = carry;
+        if (i == fill)
+            ++fill;
+    }
+
+    CNodeBase *sorted = nullptr;
+    for (size_t i = 0; i < fill; ++i)
+        if (buckets[i])
+            sorted = mergeChains (buckets[i], sorted, comp, last);
+
+    m_beforeBegin.m_next = sorted;
+    m_tail = last;
+}
+
+template<typename T>
+void nsSdD::CForwardList<T>::reverse () noexcept
+{
+    CNodeBase *reversed = nullptr;
+    CNodeBase *first = m_beforeBegin.m_next;
+
+    for (CNodeBase *node = first; node;)
+    {
+        CNodeBase *next = node->m_next;
+        node->m_next = reversed;
+        reversed = node;
+        node = next;
+    }
+
+    m_beforeBegin.m_next = reversed;
+    if (first)
+        m_tail = first;
+}
+
+template<typename T>
+template<class Compare>
+typename nsSdD::CForwardList<T>::CNodeBase *nsSdD::CForwardList<T>::mergeChains (CNodeBase *a, CNodeBase *b, Compare comp, CNodeBase *&last) noexcept
+{
+    CNodeBase head {nullptr};
+    CNodeBase *tail = &head;
+
+    while (a && b)
+    {
+        if (comp (static_cast<CNode *> (b)->m_info, static_cast<CNode *> (a)->m_info))
+        {
+            tail->m_next = b;
+            b = b->m_next;
+        }
+        else
+        {
+            tail->m_next = a;
+            a = a->m_next;
+        }
+        tail = tail->m_next;
+    }
+
+    tail->m_next = a ? a : b;
+    while (tail->m_next)
+        tail = tail->m_next;
+
+    last = tail;
+    return head.m_next;
+}
+
+template<typename T>
+typename nsSdD::CForwardList<T>::iterator nsSdD::CForwardList<T>::linkAfter (CNodeBase *position, CNode *node) noexcept
+{
+    position->m_next = node;
+    if (position == m_tail)
+        m_tail = node;
+    ++m_size;
+
+    return iterator (node);
+}
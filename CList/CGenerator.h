@@ -0,0 +1,89 @@
+/*!
+@file CGenerator.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CGenerator class.
+*/
+
+#pragma once
+
+#include <functional>
+#include <iterator>
+#include <memory>
+
+namespace nsSdD
+{
+    template<typename T>
+    /*!
+       @brief CGenerator is a view producing its elements on demand, one at a time, from a producer function:
+              @code
+              int n = 0;
+              CList<int> firsts = generate<int> ([&n] (int &x) { x = n++; return true; }) | filter (isPrime) | take (10) | to ();
+              @endcode
+              The producer stores the next element in its argument and returns true, or returns false once
+              there is none left; an infinite generator is ended by a @p take.
+
+              A CGenerator is an input view: it is walked only once, and its copies share its position.
+    */
+    class CGenerator
+    {
+        struct CIterator;
+
+        /*!
+            @brief The state shared by the copies of a CGenerator and their iterators.
+         */
+        struct CState
+        {
+            std::function<bool (T &)> producer;
+            T current;
+            bool started;
+            bool done;
+        };
+
+    public:
+        /*!
+            @typedef iterator
+            @brief Input iterator producing the next element when incremented.
+         */
+        typedef CIterator iterator;
+
+        /*!
+            @typedef value_type
+            @brief The type of the elements.
+         */
+        typedef T value_type;
+
+        /*!
+            @brief  This is the constructor of a CGenerator of the elements of @p producer.
+            @param[in] producer A callable bool (T &).
+         */
+        template<class Producer>
+        explicit CGenerator (Producer producer) noexcept;
+
+        /*!
+            @brief  This function return an iterator to the current element, producing the first one on the first call.
+         */
+        iterator begin () const noexcept;
+
+        /*!
+            @brief  This function return the iterator reached once the producer returned false.
+         */
+        iterator end () const noexcept;
+
+    private:
+        /*!
+            @var m_state
+            @brief The producer and the current element.
+         */
+        std::shared_ptr<CState> m_state;
+    };
+
+    /*!
+        @brief  Return a CGenerator of the elements of @p producer.
+     */
+    template<typename T, class Producer>
+    CGenerator<T> generate (Producer producer) noexcept;
+}
+
+#include "CGenerator.hxx"
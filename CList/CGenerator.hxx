@@ -0,0 +1,96 @@
+/*!
+@file CGenerator.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CGenerator class and iterator implementation.
+*/
+#pragma once
+
+#include "CGenerator.h"
+
+/*!
+    @brief Input iterator of CGenerator. All the iterators not at the end are on the current element.
+ */
+template<typename T>
+struct nsSdD::CGenerator<T>::CIterator : public std::iterator<std::input_iterator_tag, T, std::ptrdiff_t, const T *, const T &>
+{
+private:
+    /*!
+        @var state
+        @brief The state of the generator, nullptr for the end iterator.
+    */
+    CState *state;
+
+    bool atEnd () const noexcept
+    {
+        return !state || state->done;
+    }
+
+public:
+    CIterator (CState *s = nullptr) noexcept : state (s)
+    {
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return atEnd () == other.atEnd ();
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return atEnd () != other.atEnd ();
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        state->done = !state->producer (state->current);
+        return *this;
+    }
+
+    void operator++ (int) noexcept
+    {
+        ++*this;
+    }
+
+    const T *operator-> () const noexcept
+    {
+        return &state->current;
+    }
+
+    const T &operator* () const noexcept
+    {
+        return state->current;
+    }
+};
+
+template<typename T>
+template<class Producer>
+nsSdD::CGenerator<T>::CGenerator (Producer producer) noexcept
+        : m_state (std::make_shared<CState> (CState {producer, T (), false, false}))
+{
+}
+
+template<typename T>
+typename nsSdD::CGenerator<T>::iterator nsSdD::CGenerator<T>::begin () const noexcept
+{
+    if (!m_state->started)
+    {
+        m_state->started = true;
+        m_state->done = !m_state->producer (m_state->current);
+    }
+
+    return iterator (m_state.get ());
+}
+
+template<typename T>
+typename nsSdD::CGenerator<T>::iterator nsSdD::CGenerator<T>::end () const noexcept
+{
+    return iterator ();
+}
+
+template<typename T, class Producer>
+nsSdD::CGenerator<T> nsSdD::generate (Producer producer) noexcept
+{
+    return CGenerator<T> (producer);
+}
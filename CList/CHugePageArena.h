@@ -0,0 +1,210 @@
+/*!
+@file CHugePageArena.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief The arena of the node slabs backed by 2 MiB pages.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace nsSdD
+{
+    /*!
+        @brief CHugePageArena gives the slabs of CNodeCache from regions backed by 2 MiB pages, so that the nodes
+               of a large list are covered by few TLB entries.
+
+               A region is mapped with MAP_HUGETLB when huge pages are reserved (vm.nr_hugepages), otherwise it is
+               aligned on 2 MiB and advised with madvise (MADV_HUGEPAGE) for transparent huge pages. When neither
+               is possible, or out of Linux, no region is mapped and the slabs come from operator new as without
+               the arena. The kernel may still back an advised region with 4 KiB pages: the coverage actually
+               obtained is read from /proc/self/smaps by @p stats.
+
+               The arena is shared by all the threads and is disabled by default. Once enabled, the slabs
+               allocated from then on come from it: the caches created before keep their slabs. The slabs freed
+               go back to the arena, whose regions are never unmapped.
+     */
+    class CHugePageArena
+    {
+    public:
+        /*!
+            @brief The bytes of a huge page.
+         */
+        static const size_t hugePageBytes = 2 * 1024 * 1024;
+
+        /*!
+            @brief The bytes mapped at once, a multiple of hugePageBytes.
+         */
+        static const size_t regionBytes = 16 * hugePageBytes;
+
+        /*!
+            @brief The bytes of a block, a slab of CNodeCache.
+         */
+        static const size_t blockBytes = 64 * 1024;
+
+        /*!
+            @brief How the regions of the arena are backed.
+         */
+        struct CStats
+        {
+            /*!
+                @var regions
+                @brief The number of regions mapped.
+             */
+            size_t regions;
+
+            /*!
+                @var mappedBytes
+                @brief The bytes of the regions.
+             */
+            size_t mappedBytes;
+
+            /*!
+                @var hugetlbBytes
+                @brief The bytes of the regions mapped with MAP_HUGETLB.
+             */
+            size_t hugetlbBytes;
+
+            /*!
+                @var advisedBytes
+                @brief The bytes of the regions advised for transparent huge pages.
+             */
+            size_t advisedBytes;
+
+            /*!
+                @var hugeBytes
+                @brief The bytes of the regions actually backed by huge pages, read from /proc/self/smaps:
+                       the MAP_HUGETLB regions, and the transparent huge pages of the advised ones.
+             */
+            size_t hugeBytes;
+
+            /*!
+                @var usedBytes
+                @brief The bytes of the blocks given and not freed.
+             */
+            size_t usedBytes;
+
+            /*!
+                @brief  Return the part of the mapped bytes backed by huge pages, from 0 to 1.
+             */
+            double coverage () const noexcept
+            {
+                return mappedBytes ? double (hugeBytes) / mappedBytes : 0;
+            }
+        };
+
+        /*!
+            @brief  Return the arena of the process.
+         */
+        static CHugePageArena &instance () noexcept;
+
+        /*!
+            @brief  Enables or disables the arena for the slabs allocated from now on.
+         */
+        static void setEnabled (bool enabled) noexcept;
+
+        /*!
+            @brief  Return true if the arena is enabled, false otherwise.
+         */
+        static bool enabled () noexcept;
+
+        /*!
+            @brief  Return a block of blockBytes, aligned on blockBytes, or nullptr if no region can be mapped.
+         */
+        void *allocate () noexcept;
+
+        /*!
+            @brief  Gives back the block @p block returned by @p allocate.
+         */
+        void deallocate (void *block) noexcept;
+
+        /*!
+            @brief  Return true if @p p is in a region of the arena, false otherwise.
+         */
+        bool owns (const void *p) const noexcept;
+
+        /*!
+            @brief  Return how the regions are backed.
+         */
+        CStats stats () const noexcept;
+
+        CHugePageArena (const CHugePageArena &) = delete;
+
+        CHugePageArena &operator= (const CHugePageArena &) = delete;
+
+    private:
+        /*!
+            @brief A mapped region.
+         */
+        struct CRegion
+        {
+            char *begin;
+            char *end;
+            bool hugetlb;
+        };
+
+        CHugePageArena () noexcept = default;
+
+        static std::atomic<bool> &enabledFlag () noexcept;
+
+        /*!
+            @brief  Maps a new region and makes it the current one.
+            @return False if no region could be mapped.
+         */
+        bool mapRegion () noexcept;
+
+        /*!
+            @brief  Return the bytes of transparent huge pages in the advised regions, from /proc/self/smaps.
+         */
+        size_t transparentHugeBytes () const noexcept;
+
+        /*!
+            @var m_mutex
+            @brief Protects the fields below, taken once per slab.
+         */
+        mutable std::mutex m_mutex;
+
+        /*!
+            @var m_regions
+            @brief The mapped regions, in the order of their mapping.
+         */
+        std::vector<CRegion> m_regions;
+
+        /*!
+            @var m_free
+            @brief The blocks freed, given again before the rest of the current region.
+         */
+        std::vector<void *> m_free;
+
+        /*!
+            @var m_next
+            @brief The first block of the current region never given.
+         */
+        char *m_next = nullptr;
+
+        /*!
+            @var m_end
+            @brief The end of the current region.
+         */
+        char *m_end = nullptr;
+
+        /*!
+            @var m_usedBytes
+            @brief The bytes of the blocks given and not freed.
+         */
+        size_t m_usedBytes = 0;
+
+        /*!
+            @var m_failed
+            @brief If mapping a region failed, the arena doesn't try again.
+         */
+        bool m_failed = false;
+    };
+}
+
+#include "CHugePageArena.hxx"
@@ -0,0 +1,177 @@
+/*!
+@file CHugePageArena.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CHugePageArena class implementation.
+*/
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "CHugePageArena.h"
+
+inline nsSdD::CHugePageArena &nsSdD::CHugePageArena::instance () noexcept
+{
+    // Never destroyed: slabs may be freed by the destructors of other static objects.
+    static CHugePageArena *arena = new CHugePageArena ();
+    return *arena;
+}
+
+inline std::atomic<bool> &nsSdD::CHugePageArena::enabledFlag () noexcept
+{
+    static std::atomic<bool> enabled (false);
+    return enabled;
+}
+
+inline void nsSdD::CHugePageArena::setEnabled (bool enabled) noexcept
+{
+    enabledFlag ().store (enabled, std::memory_order_relaxed);
+}
+
+inline bool nsSdD::CHugePageArena::enabled () noexcept
+{
+    return enabledFlag ().load (std::memory_order_relaxed);
+}
+
+inline void *nsSdD::CHugePageArena::allocate () noexcept
+{
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    void *block = nullptr;
+    if (!m_free.empty ())
+    {
+        block = m_free.back ();
+        m_free.pop_back ();
+    }
+    else
+    {
+        if (m_next == m_end && (m_failed || !mapRegion ()))
+        {
+            m_failed = true;
+            return nullptr;
+        }
+
+        block = m_next;
+        m_next += blockBytes;
+    }
+
+    m_usedBytes += blockBytes;
+    return block;
+}
+
+inline void nsSdD::CHugePageArena::deallocate (void *block) noexcept
+{
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    m_free.push_back (block);
+    m_usedBytes -= blockBytes;
+}
+
+inline bool nsSdD::CHugePageArena::owns (const void *p) const noexcept
+{
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    for (const CRegion &region : m_regions)
+        if (p >= region.begin && p < region.end)
+            return true;
+
+    return false;
+}
+
+inline nsSdD::CHugePageArena::CStats nsSdD::CHugePageArena::stats () const noexcept
+{
+    std::lock_guard<std::mutex> lock (m_mutex);
+    CStats stats = CStats ();
+
+    for (const CRegion &region : m_regions)
+    {
+        ++stats.regions;
+        stats.mappedBytes += region.end - region.begin;
+        if (region.hugetlb)
+            stats.hugetlbBytes += region.end - region.begin;
+        else
+            stats.advisedBytes += region.end - region.begin;
+    }
+
+    stats.hugeBytes = stats.hugetlbBytes + (stats.advisedBytes ? transparentHugeBytes () : 0);
+    stats.usedBytes = m_usedBytes;
+
+    return stats;
+}
+
+inline bool nsSdD::CHugePageArena::mapRegion () noexcept
+{
+#if defined (__linux__) && defined (MADV_HUGEPAGE)
+    bool hugetlb = true;
+    void *mapped = mmap (nullptr, regionBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+    if (mapped == MAP_FAILED)
+    {
+        // No huge page reserved: a region aligned on a huge page, for the transparent ones
+        hugetlb = false;
+        size_t bytes = regionBytes + hugePageBytes;
+        char *raw = static_cast<char *> (mmap (nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (raw == MAP_FAILED)
+            return false;
+
+        char *aligned = reinterpret_cast<char *> ((reinterpret_cast<std::uintptr_t> (raw) + hugePageBytes - 1)
+                                                  & ~std::uintptr_t (hugePageBytes - 1));
+        if (aligned != raw)
+            munmap (raw, aligned - raw);
+        if (raw + bytes != aligned + regionBytes)
+            munmap (aligned + regionBytes, raw + bytes - (aligned + regionBytes));
+
+        if (madvise (aligned, regionBytes, MADV_HUGEPAGE) != 0)
+        {
+            munmap (aligned, regionBytes);
+            return false;
+        }
+
+        mapped = aligned;
+    }
+
+    CRegion region = { static_cast<char *> (mapped), static_cast<char *> (mapped) + regionBytes, hugetlb };
+    m_regions.push_back (region);
+    m_next = region.begin;
+    m_end = region.end;
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+inline size_t nsSdD::CHugePageArena::transparentHugeBytes () const noexcept
+{
+    std::ifstream smaps ("/proc/self/smaps");
+    std::string line;
+    bool inArena = false;
+    size_t bytes = 0;
+
+    while (std::getline (smaps, line))
+    {
+        unsigned long begin, end, kiB;
+
+        // The first line of a mapping is its range, the ones of the arena can be merged by the kernel
+        if (std::sscanf (line.c_str (), "%lx-%lx ", &begin, &end) == 2)
+        {
+            inArena = false;
+            for (const CRegion &region : m_regions)
+                if (!region.hugetlb && reinterpret_cast<std::uintptr_t> (region.begin) < end
+                    && reinterpret_cast<std::uintptr_t> (region.end) > begin)
+                    inArena = true;
+        }
+        else if (inArena && std::sscanf (line.c_str (), "AnonHugePages: %lu kB", &kiB) == 1)
+            bytes += kiB * 1024;
+    }
+
+    return bytes;
+}
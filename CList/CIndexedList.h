@@ -0,0 +1,272 @@
+/*!
+@file CIndexedList.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CIndexedList class.
+*/
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+#include "CList.h"
+
+namespace nsSdD
+{
+    /*!
+        @brief Default key extractor of CIndexedList, the element is its own key.
+     */
+    template<typename T>
+    struct CIdentity
+    {
+        const T &operator() (const T &x) const noexcept
+        {
+            return x;
+        }
+    };
+
+    template<typename T, typename Key = T, typename KeyOf = CIdentity<T>, typename Hash = std::hash<Key>>
+    /*!
+       @brief CIndexedList is a CList doubled with a hash index going from a key to the node holding it.
+              The order of the elements is the order of the underlying CList, the index only serves lookups,
+              so that @p find, @p contains and @p erase by key are O(1) expected instead of a full scan.
+              Keys are unique: inserting an element whose key is already indexed does nothing.
+              The key of an element must not be modified through an iterator.
+    */
+    class CIndexedList
+    {
+    public:
+        /*!
+            @typedef size_type
+            @brief The size type of the underlying CList.
+         */
+        typedef typename CList<T>::size_type size_type;
+
+        /*!
+            @typedef iterator
+            @brief The iterator of the underlying CList.
+         */
+        typedef typename CList<T>::iterator iterator;
+
+        /*!
+            @typedef const_iterator
+            @brief The const iterator of the underlying CList.
+         */
+        typedef typename CList<T>::const_iterator const_iterator;
+
+        /*!
+            @typedef key_type
+            @brief The type of the keys extracted from the elements.
+         */
+        typedef Key key_type;
+
+        /*!
+            @brief This is the default constructor of the class CIndexedList
+            @param[in] keyOf The functor extracting the key of an element.
+            @param[in] hash The functor hashing the keys.
+         */
+        explicit CIndexedList (KeyOf keyOf = KeyOf (), Hash hash = Hash ()) noexcept;
+
+        /*!
+            @brief This is the copy-constructor of the class CIndexedList, the index is rebuilt on the copied nodes.
+            @param[in] x The CIndexedList we want to copy.
+         */
+        CIndexedList (const CIndexedList &x) noexcept;
+
+        /*!
+            @brief Copying the underlying CList by assignment would share its nodes, hence it is forbidden.
+         */
+        CIndexedList &operator= (const CIndexedList &) = delete;
+
+        // iterators
+        /*!
+            @brief  This function return an iterator to the begin of the CIndexedList.
+         */
+        iterator begin () noexcept;
+
+        /*!
+            @brief  This function return an iterator to the end of the CIndexedList.
+         */
+        iterator end () noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the begin of the CIndexedList.
+         */
+        const_iterator cbegin () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the end of the CIndexedList.
+         */
+        const_iterator cend () const noexcept;
+
+        // Capacity
+        /*!
+            @brief  This function return true if the CIndexedList is empty, false otherwise.
+         */
+        bool empty () const noexcept;
+
+        /*!
+            @brief  This function return the size of the CIndexedList.
+         */
+        size_type size () const noexcept;
+
+        // Element access
+        /*!
+            @brief  This function return value of the first element in the CIndexedList.
+         */
+        T front () const noexcept;
+
+        /*!
+            @brief  This function return value of the last element in the CIndexedList.
+         */
+        T back () const noexcept;
+
+        /*!
+            @brief  This function gives a read-only access to the underlying CList.
+         */
+        const CList<T> &list () const noexcept;
+
+        // Lookup
+        /*!
+            @brief  This function looks up the element of key @p key in O(1) expected.
+            @param[in] key The key we are looking for.
+            @return An iterator to the element, or end () if the key is not indexed.
+         */
+        iterator find (const Key &key) noexcept;
+
+        /*!
+            @brief  This function looks up the element of key @p key in O(1) expected.
+            @param[in] key The key we are looking for.
+            @return A const_iterator to the element, or cend () if the key is not indexed.
+         */
+        const_iterator find (const Key &key) const noexcept;
+
+        /*!
+            @brief  This function return true if an element of key @p key is in the CIndexedList, in O(1) expected.
+            @param[in] key The key we are looking for.
+         */
+        bool contains (const Key &key) const noexcept;
+
+        // Modifiers
+        /*!
+            @brief  This function add @p x at the end of the CIndexedList if its key is not already indexed.
+            @param[in] x The value we want to insert at the end of the CIndexedList.
+            @return An iterator to the element holding the key, and true if @p x was inserted.
+         */
+        std::pair<iterator, bool> push_back (const T &x) noexcept;
+
+        /*!
+            @brief  This function add @p x at the beginning of the CIndexedList if its key is not already indexed.
+            @param[in] x The value we want to insert at the beginning of the CIndexedList.
+            @return An iterator to the element holding the key, and true if @p x was inserted.
+         */
+        std::pair<iterator, bool> push_front (const T &x) noexcept;
+
+        /*!
+            @brief  This function inserts @p val before @p position if its key is not already indexed.
+            @param[in] position The position where you want to insert the new element.
+            @param[in] val The value we want to insert.
+            @return An iterator to the element holding the key, and true if @p val was inserted.
+         */
+        std::pair<iterator, bool> insert (iterator position, const T &val) noexcept;
+
+        /*!
+            @brief  This function delete the first element of the CIndexedList.
+         */
+        void pop_front () noexcept;
+
+        /*!
+            @brief  This function delete the last element of the CIndexedList.
+         */
+        void pop_back () noexcept;
+
+        /*!
+            @brief  This function delete the element pointed by the iterator @p position.
+            @param[in] position An iterator pointing to the element we want to delete.
+            @return iterator The element that followed the erased element.
+         */
+        iterator erase (iterator position) noexcept;
+
+        /*!
+            @brief  This function delete the element of key @p key in O(1) expected.
+            @param[in] key The key of the element we want to delete.
+            @return size_type The number of erased elements (0 or 1).
+         */
+        size_type erase (const Key &key) noexcept;
+
+        /*!
+            @brief  This function delete all the element of the CIndexedList.
+         */
+        void clear () noexcept;
+
+        // Operations
+        /*!
+            @brief  This function move the elements of @p x before @p position.
+                    Elements whose key is already indexed in the current CIndexedList are dropped.
+            @param[in] position The position where we want to insert the other list.
+            @param[in] x The CIndexedList we want to add on the current CIndexedList.
+         */
+        void splice (iterator position, CIndexedList &x) noexcept;
+
+        /*!
+            @brief  This function move element @p i of @p x before @p position.
+                    The element is dropped if its key is already indexed in the current CIndexedList.
+            @param[in] position The position where we want to insert the element.
+            @param[in] x The CIndexedList holding @p i, may be the current CIndexedList.
+            @param[in] i An iterator pointing to the element we want to move.
+         */
+        void splice (iterator position, CIndexedList &x, iterator i) noexcept;
+
+        /*!
+            @brief  This function sort the CIndexedList in ascending order.
+         */
+        void sort () noexcept;
+
+        /*!
+            @brief  This function sort the CIndexedList with the comparator @p comp.
+            @param[in] comp The comparator you want to use to sort the CIndexedList.
+         */
+        template<class Compare>
+        void sort (Compare comp) noexcept;
+
+        /*!
+            @brief  This function reverse the order of the CIndexedList, in linear time: the links of the nodes are
+                    reversed, so that the iterators of the index stay valid and follow the new order.
+         */
+        void reverse () noexcept;
+
+    private:
+        /*!
+            @brief  Indexes the range [@p first, @p last), dropping elements whose key is already indexed.
+         */
+        void indexRange (iterator first, iterator last) noexcept;
+
+        /*!
+            @brief  Rebuilds the whole index from the underlying CList.
+         */
+        void reindex () noexcept;
+
+        /*!
+          @var     m_list
+          @brief  The CList holding the elements, in order.
+       */
+        CList<T> m_list;
+
+        /*!
+          @var     m_keyOf
+          @brief  The functor extracting the key of an element.
+       */
+        KeyOf m_keyOf;
+
+        /*!
+          @var     m_index
+          @brief  The hash index going from a key to the node holding it.
+       */
+        std::unordered_map<Key, iterator, Hash> m_index;
+    };
+}
+
+#include "CIndexedList.hxx"
@@ -0,0 +1,241 @@
+/*!
+@file CIndexedList.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CIndexedList class implementation.
+*/
+#pragma once
+
+#include "CIndexedList.h"
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+nsSdD::CIndexedList<T, Key, KeyOf, Hash>::CIndexedList (KeyOf keyOf /*= KeyOf ()*/, Hash hash /*= Hash ()*/) noexcept
+        : m_keyOf (keyOf),
+          m_index (0, hash)
+{
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+nsSdD::CIndexedList<T, Key, KeyOf, Hash>::CIndexedList (const CIndexedList &x) noexcept
+        : m_list (x.m_list),
+          m_keyOf (x.m_keyOf),
+          m_index (x.m_index.bucket_count (), x.m_index.hash_function ())
+{
+    reindex ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::iterator nsSdD::CIndexedList<T, Key, KeyOf, Hash>::begin () noexcept
+{
+    return m_list.begin ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::iterator nsSdD::CIndexedList<T, Key, KeyOf, Hash>::end () noexcept
+{
+    return m_list.end ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::const_iterator nsSdD::CIndexedList<T, Key, KeyOf, Hash>::cbegin () const noexcept
+{
+    return m_list.cbegin ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::const_iterator nsSdD::CIndexedList<T, Key, KeyOf, Hash>::cend () const noexcept
+{
+    return m_list.cend ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+bool nsSdD::CIndexedList<T, Key, KeyOf, Hash>::empty () const noexcept
+{
+    return m_list.empty ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::size_type nsSdD::CIndexedList<T, Key, KeyOf, Hash>::size () const noexcept
+{
+    return m_list.size ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+T nsSdD::CIndexedList<T, Key, KeyOf, Hash>::front () const noexcept
+{
+    return m_list.front ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+T nsSdD::CIndexedList<T, Key, KeyOf, Hash>::back () const noexcept
+{
+    return m_list.back ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+const nsSdD::CList<T> &nsSdD::CIndexedList<T, Key, KeyOf, Hash>::list () const noexcept
+{
+    return m_list;
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::iterator nsSdD::CIndexedList<T, Key, KeyOf, Hash>::find (const Key &key) noexcept
+{
+    auto itr = m_index.find (key);
+
+    return itr == m_index.end () ? end () : itr->second;
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::const_iterator nsSdD::CIndexedList<T, Key, KeyOf, Hash>::find (const Key &key) const noexcept
+{
+    auto itr = m_index.find (key);
+
+    return itr == m_index.end () ? cend () : const_iterator (itr->second);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+bool nsSdD::CIndexedList<T, Key, KeyOf, Hash>::contains (const Key &key) const noexcept
+{
+    return m_index.count (key) != 0;
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+std::pair<typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::iterator, bool> nsSdD::CIndexedList<T, Key, KeyOf, Hash>::push_back (const T &x) noexcept
+{
+    return insert (end (), x);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+std::pair<typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::iterator, bool> nsSdD::CIndexedList<T, Key, KeyOf, Hash>::push_front (const T &x) noexcept
+{
+    return insert (begin (), x);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+std::pair<typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::iterator, bool> nsSdD::CIndexedList<T, Key, KeyOf, Hash>::insert (iterator position, const T &val) noexcept
+{
+    auto found = m_index.find (m_keyOf (val));
+    if (found != m_index.end ())
+        return std::make_pair (found->second, false);
+
+    iterator itr = m_list.insert (position, val);
+    m_index.emplace (m_keyOf (*itr), itr);
+
+    return std::make_pair (itr, true);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::pop_front () noexcept
+{
+    if (!empty ())
+        erase (begin ());
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::pop_back () noexcept
+{
+    if (!empty ())
+        erase (--end ());
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::iterator nsSdD::CIndexedList<T, Key, KeyOf, Hash>::erase (iterator position) noexcept
+{
+    m_index.erase (m_keyOf (*position));
+
+    return m_list.erase (position);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+typename nsSdD::CIndexedList<T, Key, KeyOf, Hash>::size_type nsSdD::CIndexedList<T, Key, KeyOf, Hash>::erase (const Key &key) noexcept
+{
+    auto found = m_index.find (key);
+    if (found == m_index.end ())
+        return 0;
+
+    m_list.erase (found->second);
+    m_index.erase (found);
+
+    return 1;
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::clear () noexcept
+{
+    m_index.clear ();
+    m_list.clear ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::splice (iterator position, CIndexedList &x) noexcept
+{
+    if (&x == this || x.empty ())
+        return;
+
+    // The node before position is kept, whatever the way CList moves the elements they land right after it.
+    iterator before = position;
+    --before;
+
+    x.m_index.clear ();
+    m_list.splice (position, x.m_list);
+
+    indexRange (++before, position);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::splice (iterator position, CIndexedList &x, iterator i) noexcept
+{
+    if (i == position)
+        return;
+
+    x.m_index.erase (m_keyOf (*i));
+    m_list.splice (position, x.m_list, i);
+
+    indexRange (--iterator (position), position);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::sort () noexcept
+{
+    // CList::sort relinks the nodes, the stored iterators stay valid.
+    m_list.sort ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+template<class Compare>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::sort (Compare comp) noexcept
+{
+    m_list.sort (comp);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::reverse () noexcept
+{
+    // The iterators keep the orientation they were taken with: the links are reversed for real, so that the
+    // stored iterators, which follow the links, walk the new order.
+    m_list.reverse ();
+    m_list.materialize_reverse ();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::indexRange (iterator first, iterator last) noexcept
+{
+    while (first != last)
+    {
+        if (m_index.emplace (m_keyOf (*first), first).second)
+            ++first;
+        else
+            first = m_list.erase (first);
+    }
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash>
+void nsSdD::CIndexedList<T, Key, KeyOf, Hash>::reindex () noexcept
+{
+    m_index.clear ();
+    m_index.reserve (m_list.size ());
+
+    indexRange (m_list.begin (), m_list.end ());
+}
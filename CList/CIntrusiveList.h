@@ -0,0 +1,435 @@
+/*!
+@file CIntrusiveList.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CIntrusiveList class.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+#include "CList.h"
+
+namespace nsSdD
+{
+    /*!
+        @brief The links an object embeds, or inherits, to be threaded by a CIntrusiveList.
+                Copying an object does not copy its membership: a copied hook is unlinked.
+                A hook unlinks itself when it is destroyed.
+     */
+    class CIntrusiveListHook
+    {
+    public:
+        /*!
+            @brief This is the constructor of an unlinked hook.
+         */
+        CIntrusiveListHook () noexcept : m_next (nullptr), m_previous (nullptr)
+        {
+        }
+
+        /*!
+            @brief The copy-constructor creates an unlinked hook.
+         */
+        CIntrusiveListHook (const CIntrusiveListHook &) noexcept : m_next (nullptr), m_previous (nullptr)
+        {
+        }
+
+        /*!
+            @brief The operator= keeps the hook where it is linked.
+         */
+        CIntrusiveListHook &operator= (const CIntrusiveListHook &) noexcept
+        {
+            return *this;
+        }
+
+        /*!
+            @brief The destructor unlinks the hook.
+         */
+        ~CIntrusiveListHook () noexcept
+        {
+            unlink ();
+        }
+
+        /*!
+            @brief  This function return true if the hook is in a CIntrusiveList, false otherwise.
+         */
+        bool isLinked () const noexcept
+        {
+            return m_next != nullptr;
+        }
+
+        /*!
+            @brief  This function removes the hook from its CIntrusiveList in O(1), without knowing the list.
+         */
+        void unlink () noexcept
+        {
+            if (!isLinked ())
+                return;
+
+            m_previous->m_next = m_next;
+            m_next->m_previous = m_previous;
+            m_next = m_previous = nullptr;
+        }
+
+    private:
+        template<typename, typename> friend class CIntrusiveList;
+
+        /*!
+            @var m_next
+            @brief The next hook, nullptr if unlinked.
+         */
+        CIntrusiveListHook *m_next;
+
+        /*!
+            @var m_previous
+            @brief The previous hook, nullptr if unlinked.
+         */
+        CIntrusiveListHook *m_previous;
+    };
+
+    /*!
+        @brief Hook traits for an element inheriting CIntrusiveListHook.
+     */
+    template<typename T>
+    struct CBaseHook
+    {
+        static CIntrusiveListHook *toHook (T &x) noexcept
+        {
+            return &x;
+        }
+
+        static T *fromHook (CIntrusiveListHook *hook) noexcept
+        {
+            return static_cast<T *> (hook);
+        }
+    };
+
+    /*!
+        @brief Hook traits for an element holding a CIntrusiveListHook as its @p Member.
+                The offset of the member is measured once, on the first element given to toHook: a hook is only
+                ever converted back after its element was linked, hence through toHook.
+     */
+    template<typename T, CIntrusiveListHook T::*Member>
+    struct CMemberHook
+    {
+        static CIntrusiveListHook *toHook (T &x) noexcept
+        {
+            offset (&x);
+            return &(x.*Member);
+        }
+
+        static T *fromHook (CIntrusiveListHook *hook) noexcept
+        {
+            return reinterpret_cast<T *> (reinterpret_cast<char *> (hook) - offset (nullptr));
+        }
+
+    private:
+        /*!
+            @brief  Return the offset of @p Member in T, measured on @p element the first time, the same for
+                    every element afterwards.
+         */
+        static std::ptrdiff_t offset (const T *element) noexcept
+        {
+            static const std::ptrdiff_t value = reinterpret_cast<const char *> (&(element->*Member))
+                                                - reinterpret_cast<const char *> (element);
+            return value;
+        }
+    };
+
+    template<typename T, typename HookTraits = CBaseHook<T>>
+    /*!
+       @brief CIntrusiveList threads existing objects through the CIntrusiveListHook they embed, instead of
+              copying them into nodes it allocates: inserting and erasing never allocate anything, and an element
+              can unlink itself in O(1) through its hook. The list never owns nor destroys the elements.
+              Since elements may leave the list on their own, the size is not tracked: @p size is linear,
+              and in exchange every @p splice is O(1).
+    */
+    class CIntrusiveList
+    {
+        // Types
+    private:
+        struct CIterator;
+
+        struct CConstIterator;
+
+    public:
+        /*!
+            @typedef size_type
+            @brief This define a @p size_t.
+         */
+        typedef size_t size_type;
+
+        /*!
+            @typedef iterator
+            @brief This define a @p CIterator.
+         */
+        typedef CIterator iterator;
+
+        /*!
+            @typedef const_iterator
+            @brief This define a @p CConstIterator.
+         */
+        typedef CConstIterator const_iterator;
+
+        /*!
+            @typedef reverse_iterator
+            @brief This define a reverse @p CIterator.
+         */
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+
+        /*!
+            @typedef const_reverse_iterator
+            @brief This define a reverse @p CConstIterator.
+         */
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /*!
+            @brief This is the default constructor of the class CIntrusiveList.
+         */
+        CIntrusiveList () noexcept;
+
+        /*!
+            @brief The elements can be in one CIntrusiveList only, hence it can't be copied.
+         */
+        CIntrusiveList (const CIntrusiveList &) = delete;
+
+        /*!
+            @brief The elements can be in one CIntrusiveList only, hence it can't be copied.
+         */
+        CIntrusiveList &operator= (const CIntrusiveList &) = delete;
+
+        /*!
+            @brief This is the move-constructor, the elements of @p x are relinked in the new CIntrusiveList.
+            @param[in] x The CIntrusiveList we take the elements of.
+         */
+        CIntrusiveList (CIntrusiveList &&x) noexcept;
+
+        /*!
+            @brief This is the move-operator=, the elements of the CIntrusiveList are unlinked, then those of @p x
+                    are relinked in it.
+            @param[in] x The CIntrusiveList we take the elements of.
+            @return CIntrusiveList& A reference to the CIntrusiveList.
+         */
+        CIntrusiveList &operator= (CIntrusiveList &&x) noexcept;
+
+        /*!
+            @brief The destructor unlinks all the elements, none of them is destroyed.
+         */
+        ~CIntrusiveList () noexcept;
+
+        // iterators
+        /*!
+            @brief  This function return an iterator to the begin of the CIntrusiveList.
+         */
+        iterator begin () noexcept;
+
+        /*!
+            @brief  This function return an iterator to the end of the CIntrusiveList.
+         */
+        iterator end () noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the begin of the CIntrusiveList.
+         */
+        const_iterator cbegin () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the end of the CIntrusiveList.
+         */
+        const_iterator cend () const noexcept;
+
+        /*!
+            @brief  This function return a reverse_iterator to the end of the CIntrusiveList.
+         */
+        reverse_iterator rbegin () noexcept;
+
+        /*!
+            @brief  This function return a reverse_iterator to the begin of the CIntrusiveList.
+         */
+        reverse_iterator rend () noexcept;
+
+        /*!
+            @brief  This function return a const_reverse_iterator to the end of the CIntrusiveList.
+         */
+        const_reverse_iterator crbegin () const noexcept;
+
+        /*!
+            @brief  This function return a const_reverse_iterator to the begin of the CIntrusiveList.
+         */
+        const_reverse_iterator crend () const noexcept;
+
+        /*!
+            @brief  This function return an iterator to @p x, which must be in a CIntrusiveList.
+            @param[in] x The element we want an iterator to.
+         */
+        static iterator iterator_to (T &x) noexcept;
+
+        // Capacity
+        /*!
+            @brief  This function return true if the CIntrusiveList is empty, false otherwise. O(1).
+         */
+        bool empty () const noexcept;
+
+        /*!
+            @brief  This function counts the elements of the CIntrusiveList. O(n).
+         */
+        size_type size () const noexcept;
+
+        // Element access
+        /*!
+            @brief  This function return a reference to the first element.
+         */
+        T &front () noexcept;
+
+        /*!
+            @brief  This function return a reference to the last element.
+         */
+        T &back () noexcept;
+
+        // Modifiers
+        /*!
+            @brief  This function links @p x at the end of the CIntrusiveList, unlinking it first if needed.
+            @param[in] x The element we want to link.
+         */
+        void push_back (T &x) noexcept;
+
+        /*!
+            @brief  This function links @p x at the beginning of the CIntrusiveList, unlinking it first if needed.
+            @param[in] x The element we want to link.
+         */
+        void push_front (T &x) noexcept;
+
+        /*!
+            @brief  This function unlinks the last element.
+         */
+        void pop_back () noexcept;
+
+        /*!
+            @brief  This function unlinks the first element.
+         */
+        void pop_front () noexcept;
+
+        /*!
+            @brief  This function links @p x before @p position, unlinking it first if needed.
+            @param[in] position The position where we want to link @p x.
+            @param[in] x The element we want to link.
+            @return An iterator to @p x.
+         */
+        iterator insert (iterator position, T &x) noexcept;
+
+        /*!
+            @brief  This function unlinks the element pointed by @p position.
+            @param[in] position An iterator to the element we want to unlink.
+            @return The iterator following the unlinked element.
+         */
+        iterator erase (iterator position) noexcept;
+
+        /*!
+            @brief  This function unlinks the elements between @p first and @p last.
+            @param[in] first An iterator to the first element we want to unlink.
+            @param[in] last An iterator following the last element we want to unlink.
+            @return @p last
+         */
+        iterator erase (iterator first, iterator last) noexcept;
+
+        /*!
+            @brief  This function swaps the elements of the two CIntrusiveList in O(1).
+            @param[in] x The CIntrusiveList we want to swap with.
+         */
+        void swap (CIntrusiveList &x) noexcept;
+
+        /*!
+            @brief  This function unlinks all the elements.
+         */
+        void clear () noexcept;
+
+        // Operations
+        /*!
+            @brief  This function unlinks the elements equal to @p val.
+            @param[in] val The value we want to remove.
+         */
+        void remove (const T &val) noexcept;
+
+        /*!
+            @brief  This function unlinks the elements for which @p pred is true.
+            @param[in] pred The predicate selecting the elements to unlink.
+         */
+        template<class Predicate>
+        void remove_if (Predicate pred) noexcept;
+
+        /*!
+            @brief  This function unlinks the elements equal to the one before them.
+         */
+        void unique () noexcept;
+
+        /*!
+            @brief  This function unlinks the elements for which @p pred is true with the one before them.
+            @param[in] pred The binary predicate comparing two consecutive elements.
+         */
+        template<class Compare>
+        void unique (Compare pred) noexcept;
+
+        /*!
+            @brief  This function moves all the elements of @p x before @p position, in O(1).
+         */
+        void splice (iterator position, CIntrusiveList &x) noexcept;
+
+        /*!
+            @brief  This function moves the element @p i of @p x before @p position, in O(1).
+         */
+        void splice (iterator position, CIntrusiveList &x, iterator i) noexcept;
+
+        /*!
+            @brief  This function moves the elements of @p x between @p first and @p last before @p position, in O(1).
+         */
+        void splice (iterator position, CIntrusiveList &x, iterator first, iterator last) noexcept;
+
+        /*!
+            @brief  This function merges the sorted @p x into the sorted CIntrusiveList, in linear time.
+            @param[in] x The sorted CIntrusiveList we want to merge, empty afterwards.
+         */
+        void merge (CIntrusiveList &x) noexcept;
+
+        /*!
+            @brief  This function merges @p x, sorted by @p comp, into the CIntrusiveList sorted by @p comp.
+            @param[in] x The sorted CIntrusiveList we want to merge, empty afterwards.
+            @param[in] comp The comparator both CIntrusiveList are sorted with.
+         */
+        template<class Compare>
+        void merge (CIntrusiveList &x, Compare comp) noexcept;
+
+        /*!
+            @brief  This function sorts the CIntrusiveList in ascending order, in O(n log n), by relinking.
+         */
+        void sort () noexcept;
+
+        /*!
+            @brief  This function sorts the CIntrusiveList with @p comp, in O(n log n), by relinking. Stable.
+            @param[in] comp The comparator you want to use to sort the CIntrusiveList.
+         */
+        template<class Compare>
+        void sort (Compare comp) noexcept;
+
+        /*!
+            @brief  This function reverses the order of the elements.
+         */
+        void reverse () noexcept;
+
+    private:
+        /*!
+            @brief  Unlinks the chain from @p first to @p last (included) and links it before @p position.
+         */
+        static void transfer (CIntrusiveListHook *position, CIntrusiveListHook *first, CIntrusiveListHook *last) noexcept;
+
+        /*!
+          @var     m_root
+          @brief  The sentinel hook, before the first and after the last element.
+       */
+        CIntrusiveListHook m_root;
+    };
+}
+
+#include "CIntrusiveList.hxx"
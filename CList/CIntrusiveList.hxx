@@ -0,0 +1,516 @@
+/*!
+@file CIntrusiveList.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CIntrusiveList class and iterators implementation.
+*/
+#pragma once
+
+#include <utility>
+
+#include "CIntrusiveList.h"
+
+/*!
+    @brief Bidirectional iterator of CIntrusiveList, walks the hooks and gives access to the elements holding them.
+ */
+template<typename T, typename HookTraits>
+struct nsSdD::CIntrusiveList<T, HookTraits>::CIterator : public CIterBase<T>
+{
+private:
+    /*!
+        @var node
+        @brief The current hook of the iterator.
+    */
+    CIntrusiveListHook *node;
+
+public:
+    CIterator (CIntrusiveListHook *p = nullptr) noexcept : node (p)
+    {
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return node == other.node;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return node != other.node;
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        node = node->m_next;
+        return *this;
+    }
+
+    CIterator &operator-- () noexcept
+    {
+        node = node->m_previous;
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        node = node->m_next;
+        return temp;
+    }
+
+    CIterator operator-- (int) noexcept
+    {
+        CIterator temp = *this;
+        node = node->m_previous;
+        return temp;
+    }
+
+    T *operator-> () const noexcept
+    {
+        return HookTraits::fromHook (node);
+    }
+
+    T &operator* () const noexcept
+    {
+        return *HookTraits::fromHook (node);
+    }
+
+    /*!
+      @brief The function return the hook the iterator is on.
+   */
+    CIntrusiveListHook *getNode () const noexcept
+    {
+        return node;
+    }
+};
+
+/*!
+    @brief Sister const class to CIterator
+ */
+template<typename T, typename HookTraits>
+struct nsSdD::CIntrusiveList<T, HookTraits>::CConstIterator : public CConstIterBase<T>
+{
+private:
+    /*!
+        @var node
+        @brief The current hook of the iterator.
+    */
+    const CIntrusiveListHook *node;
+
+public:
+    CConstIterator (const CIntrusiveListHook *p = nullptr) noexcept : node (p)
+    {
+    }
+
+    bool operator== (const CConstIterator &other) const noexcept
+    {
+        return node == other.node;
+    }
+
+    bool operator!= (const CConstIterator &other) const noexcept
+    {
+        return node != other.node;
+    }
+
+    CConstIterator &operator++ () noexcept
+    {
+        node = node->m_next;
+        return *this;
+    }
+
+    CConstIterator &operator-- () noexcept
+    {
+        node = node->m_previous;
+        return *this;
+    }
+
+    CConstIterator operator++ (int) noexcept
+    {
+        CConstIterator temp = *this;
+        node = node->m_next;
+        return temp;
+    }
+
+    CConstIterator operator-- (int) noexcept
+    {
+        CConstIterator temp = *this;
+        node = node->m_previous;
+        return temp;
+    }
+
+    const T *operator-> () const noexcept
+    {
+        return HookTraits::fromHook (const_cast<CIntrusiveListHook *> (node));
+    }
+
+    const T &operator* () const noexcept
+    {
+        return *HookTraits::fromHook (const_cast<CIntrusiveListHook *> (node));
+    }
+};
+
+template<typename T, typename HookTraits>
+nsSdD::CIntrusiveList<T, HookTraits>::CIntrusiveList () noexcept
+{
+    m_root.m_next = m_root.m_previous = &m_root;
+}
+
+template<typename T, typename HookTraits>
+nsSdD::CIntrusiveList<T, HookTraits>::CIntrusiveList (CIntrusiveList &&x) noexcept
+{
+    m_root.m_next = m_root.m_previous = &m_root;
+    splice (end (), x);
+}
+
+template<typename T, typename HookTraits>
+nsSdD::CIntrusiveList<T, HookTraits> &nsSdD::CIntrusiveList<T, HookTraits>::operator= (CIntrusiveList &&x) noexcept
+{
+    if (&x != this)
+    {
+        clear ();
+        splice (end (), x);
+    }
+
+    return *this;
+}
+
+template<typename T, typename HookTraits>
+nsSdD::CIntrusiveList<T, HookTraits>::~CIntrusiveList () noexcept
+{
+    clear ();
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::iterator nsSdD::CIntrusiveList<T, HookTraits>::begin () noexcept
+{
+    return iterator (m_root.m_next);
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::iterator nsSdD::CIntrusiveList<T, HookTraits>::end () noexcept
+{
+    return iterator (&m_root);
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::const_iterator nsSdD::CIntrusiveList<T, HookTraits>::cbegin () const noexcept
+{
+    return const_iterator (m_root.m_next);
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::const_iterator nsSdD::CIntrusiveList<T, HookTraits>::cend () const noexcept
+{
+    return const_iterator (&m_root);
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::reverse_iterator nsSdD::CIntrusiveList<T, HookTraits>::rbegin () noexcept
+{
+    return reverse_iterator (end ());
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::reverse_iterator nsSdD::CIntrusiveList<T, HookTraits>::rend () noexcept
+{
+    return reverse_iterator (begin ());
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::const_reverse_iterator nsSdD::CIntrusiveList<T, HookTraits>::crbegin () const noexcept
+{
+    return const_reverse_iterator (cend ());
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::const_reverse_iterator nsSdD::CIntrusiveList<T, HookTraits>::crend () const noexcept
+{
+    return const_reverse_iterator (cbegin ());
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::iterator nsSdD::CIntrusiveList<T, HookTraits>::iterator_to (T &x) noexcept
+{
+    return iterator (HookTraits::toHook (x));
+}
+
+template<typename T, typename HookTraits>
+bool nsSdD::CIntrusiveList<T, HookTraits>::empty () const noexcept
+{
+    return m_root.m_next == &m_root;
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::size_type nsSdD::CIntrusiveList<T, HookTraits>::size () const noexcept
+{
+    return std::distance (cbegin (), cend ());
+}
+
+template<typename T, typename HookTraits>
+T &nsSdD::CIntrusiveList<T, HookTraits>::front () noexcept
+{
+    return *begin ();
+}
+
+template<typename T, typename HookTraits>
+T &nsSdD::CIntrusiveList<T, HookTraits>::back () noexcept
+{
+    return *--end ();
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::push_back (T &x) noexcept
+{
+    insert (end (), x);
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::push_front (T &x) noexcept
+{
+    insert (begin (), x);
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::pop_back () noexcept
+{
+    if (!empty ())
+        m_root.m_previous->unlink ();
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::pop_front () noexcept
+{
+    if (!empty ())
+        m_root.m_next->unlink ();
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::iterator nsSdD::CIntrusiveList<T, HookTraits>::insert (iterator position, T &x) noexcept
+{
+    CIntrusiveListHook *hook = HookTraits::toHook (x);
+    CIntrusiveListHook *next = position.getNode ();
+
+    hook->unlink ();
+
+    hook->m_next = next;
+    hook->m_previous = next->m_previous;
+    next->m_previous->m_next = hook;
+    next->m_previous = hook;
+
+    return iterator (hook);
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::iterator nsSdD::CIntrusiveList<T, HookTraits>::erase (iterator position) noexcept
+{
+    CIntrusiveListHook *next = position.getNode ()->m_next;
+    position.getNode ()->unlink ();
+
+    return iterator (next);
+}
+
+template<typename T, typename HookTraits>
+typename nsSdD::CIntrusiveList<T, HookTraits>::iterator nsSdD::CIntrusiveList<T, HookTraits>::erase (iterator first, iterator last) noexcept
+{
+    while (first != last)
+        first = erase (first);
+
+    return last;
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::swap (CIntrusiveList &x) noexcept
+{
+    if (&x == this)
+        return;
+
+    CIntrusiveList temp;
+    temp.splice (temp.end (), x);
+    x.splice (x.end (), *this);
+    splice (end (), temp);
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::clear () noexcept
+{
+    for (CIntrusiveListHook *hook = m_root.m_next, *next; hook != &m_root; hook = next)
+    {
+        next = hook->m_next;
+        hook->m_next = hook->m_previous = nullptr;
+    }
+
+    m_root.m_next = m_root.m_previous = &m_root;
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::remove (const T &val) noexcept
+{
+    remove_if ([&val] (const T &x)
+    {
+        return x == val;
+    });
+}
+
+template<typename T, typename HookTraits>
+template<class Predicate>
+void nsSdD::CIntrusiveList<T, HookTraits>::remove_if (Predicate pred) noexcept
+{
+    for (iterator itr = begin (); itr != end ();)
+        if (pred (*itr))
+            itr = erase (itr);
+        else
+            ++itr;
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::unique () noexcept
+{
+    unique ([] (const T &a, const T &b)
+    {
+        return a == b;
+    });
+}
+
+template<typename T, typename HookTraits>
+template<class Compare>
+void nsSdD::CIntrusiveList<T, HookTraits>::unique (Compare pred) noexcept
+{
+    if (empty ())
+        return;
+
+    for (iterator first = begin (), next = ++begin (); next != end (); next = ++iterator (first))
+        if (pred (*first, *next))
+            erase (next);
+        else
+            first = next;
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::splice (iterator position, CIntrusiveList &x) noexcept
+{
+    if (&x == this || x.empty ())
+        return;
+
+    transfer (position.getNode (), x.m_root.m_next, x.m_root.m_previous);
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::splice (iterator position, CIntrusiveList &/*x*/, iterator i) noexcept
+{
+    if (position == i || position.getNode () == i.getNode ()->m_next)
+        return;
+
+    transfer (position.getNode (), i.getNode (), i.getNode ());
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::splice (iterator position, CIntrusiveList &/*x*/, iterator first, iterator last) noexcept
+{
+    if (first == last)
+        return;
+
+    transfer (position.getNode (), first.getNode (), last.getNode ()->m_previous);
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::merge (CIntrusiveList &x) noexcept
+{
+    merge (x, [] (const T &a, const T &b)
+    {
+        return a < b;
+    });
+}
+
+template<typename T, typename HookTraits>
+template<class Compare>
+void nsSdD::CIntrusiveList<T, HookTraits>::merge (CIntrusiveList &x, Compare comp) noexcept
+{
+    if (&x == this)
+        return;
+
+    iterator first1 = begin (), first2 = x.begin ();
+
+    while (first1 != end () && first2 != x.end ())
+    {
+        if (comp (*first2, *first1))
+        {
+            iterator next = first2;
+            ++next;
+            transfer (first1.getNode (), first2.getNode (), first2.getNode ());
+            first2 = next;
+        }
+        else
+            ++first1;
+    }
+
+    splice (end (), x);
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::sort () noexcept
+{
+    sort ([] (const T &a, const T &b)
+    {
+        return a < b;
+    });
+}
+
+template<typename T, typename HookTraits>
+template<class Compare>
+void nsSdD::CIntrusiveList<T, HookTraits>::sort (Compare comp) noexcept
+{
+    if (empty () || m_root.m_next->m_next == &m_root)
+        return;
+
+    // Bottom-up merge sort: bucket i holds a sorted run of 2^i elements, runs are merged like a binary counter.
+    CIntrusiveList carry;
+    CIntrusiveList buckets[64];
+    CIntrusiveList *fill = buckets;
+
+    do
+    {
+        carry.splice (carry.begin (), *this, begin ());
+
+        CIntrusiveList *counter = buckets;
+        for (; counter != fill && !counter->empty (); ++counter)
+        {
+            counter->merge (carry, comp);
+            carry.swap (*counter);
+        }
+
+        carry.swap (*counter);
+        if (counter == fill)
+            ++fill;
+    }
+    while (!empty ());
+
+    for (CIntrusiveList *counter = buckets + 1; counter != fill; ++counter)
+        counter->merge (*(counter - 1), comp);
+
+    splice (end (), *(fill - 1));
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::reverse () noexcept
+{
+    CIntrusiveListHook *hook = &m_root;
+
+    do
+    {
+        std::swap (hook->m_next, hook->m_previous);
+        hook = hook->m_previous;
+    }
+    while (hook != &m_root);
+}
+
+template<typename T, typename HookTraits>
+void nsSdD::CIntrusiveList<T, HookTraits>::transfer (CIntrusiveListHook *position, CIntrusiveListHook *first, CIntrusiveListHook *last) noexcept
+{
+    first->m_previous->m_next = last->m_next;
+    last->m_next->m_previous = first->m_previous;
+
+    first->m_previous = position->m_previous;
+    last->m_next = position;
+    position->m_previous->m_next = first;
+    position->m_previous = last;
+}
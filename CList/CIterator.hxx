@@ -18,8 +18,8 @@ template<typename T> using CIterBase = std::iterator<std::bidirectional_iterator
     @brief This class permit CList to use iterators. Because we want to have a stl compliant CList with bidirectional
            iterators, we implement this on the CIterator class.
  */
-template<typename T>
-struct nsSdD::CList<T>::CIterator : public CIterBase<T>
+template<typename T, class Policy>
+struct nsSdD::CList<T, Policy>::CIterator : public CIterBase<T>
 {
 private:
     /*!
@@ -28,13 +28,20 @@ private:
     */
     CNodePtr node;
 
+    /*!
+       @var reversed
+       @brief If the CList of the iterator is reversed, the iterator then moves against the links of the nodes.
+   */
+    bool reversed;
+
 public:
     /*!
-        @fn             CIterator (CNodePtr p = nullptr) noexcept
+        @fn             CIterator (CNodePtr p = nullptr, bool r = false) noexcept
         @brief          The default constructor of the iterator for the CList class.
         @param[in] p    The p node we want to use to construct the iterator.
+        @param[in] r    If the CList of the node is reversed.
     */
-    CIterator (CNodePtr p = nullptr) noexcept : node (p)
+    CIterator (CNodePtr p = nullptr, bool r = false) noexcept : node (std::move (p)), reversed (r)
     {
     }
 
@@ -91,7 +98,7 @@ public:
     */
     CIterator &operator++ () noexcept
     {
-        node = node->getNext ();
+        node = reversed ? node->getPrevious () : node->getNext ();
         return *this;
     }
 
@@ -102,7 +109,7 @@ public:
     */
     CIterator &operator-- () noexcept
     {
-        node = node->getPrevious ();
+        node = reversed ? node->getNext () : node->getPrevious ();
         return *this;
     }
 
@@ -114,7 +121,7 @@ public:
     CIterator operator++ (int) noexcept
     {
         CIterator temp = *this;
-        node = node->getNext ();
+        node = reversed ? node->getPrevious () : node->getNext ();
         return temp;
     }
 
@@ -126,7 +133,7 @@ public:
     CIterator operator-- (int) noexcept
     {
         CIterator temp = *this;
-        node = node->getPrevious ();
+        node = reversed ? node->getNext () : node->getPrevious ();
         return temp;
     }
 
@@ -165,8 +172,17 @@ public:
       @brief The function return the node of the pointer.
       @return  CNodePtr The node of the pointer.
    */
-    CNodePtr getNode () const noexcept
+    const CNodePtr &getNode () const noexcept
     {
         return node;
     }
+
+    /*!
+      @fn isReversed () const noexcept
+      @brief The function return true if the iterator moves against the links of the nodes.
+   */
+    bool isReversed () const noexcept
+    {
+        return reversed;
+    }
 };
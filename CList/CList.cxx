@@ -0,0 +1,12 @@
+/*!
+@file CList.cxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Explicit instantiations of the CList of the types used throughout the project, declared extern in CList.h.
+*/
+#include "CList.h"
+
+template class nsSdD::CList<int>;
+template class nsSdD::CList<int *>;
+template class nsSdD::CList<std::shared_ptr<int>>;
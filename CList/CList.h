@@ -23,33 +23,53 @@ Thank you for reading this notice. We hope you find our code pleasant ;)
 
 #pragma once
 
+#include <functional>
+#include <iosfwd>
 #include <iterator>
 #include <memory>
 
+#include "CListPolicy.h"
+#include "CListTrace.h"
+#include "CMemoryUsage.h"
+#include "CNodeCache.h"
+
 /*!
     @brief Regroups everything related to data structures.
  */
 namespace nsSdD
 {
 
-    template<typename T>
+    template<typename T, class Policy = CListPolicy<>>
     /*!
        @brief CList is the main class of our work, it's develop in order to be the most close to the original std::list
               In this idea we choose to make a double-linked list, in that way we can use bidirectional iterator and have
               a stl compliant CList. During the development process we choose to work in TDD (Test Driven Development) in
               order to have the least bugs possible.
 
+              The size, allocation, locking and instrumentation of the CList are chosen by @p Policy, see CListPolicy:
+              the default policies keep CList<T> as it was, and cost nothing when disabled.
+
     */
-    class CList
+    class CList : private Policy::size_policy, private Policy::locking_policy, private Policy::instrumentation_policy
     {
         // Types
     private:
+        typedef typename Policy::size_policy size_policy;
+
+        typedef typename Policy::allocation_policy allocation_policy;
+
+        typedef typename Policy::locking_policy locking_policy;
+
+        typedef typename Policy::instrumentation_policy instrumentation_policy;
+
         struct CIterator;
 
         struct CConstIterator;
 
         class CNode;
 
+        class CNodeHandle;
+
         /*!
             @typedef CNodePtr
             @brief This define a @p std::shared_ptr<CNode> like a CNodePtr. We use
@@ -90,11 +110,41 @@ namespace nsSdD
         typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
         /*!
-            @fn CList (const CList<T> &x) noexcept
+            @typedef node_type
+            @brief This define a @p CNodeHandle, owning a node extracted from a CList.
+         */
+        typedef CNodeHandle node_type;
+
+        /*!
+            @fn CList (const CList &x) noexcept
             @brief This is the copy-constructor of the class CList
-            @param[in] @p CList<T> this is the list who want to copy.
+            @param[in] @p CList this is the list who want to copy.
+        */
+        CList (const CList &x) noexcept;
+
+        /*!
+            @fn CList (CList &&x) noexcept
+            @brief This is the move-constructor of the class CList, the nodes of @p x are taken and @p x is left
+                   empty.
+            @param[in] @p CList this is the list whose nodes are taken.
         */
-        CList (const CList<T> &x) noexcept;
+        CList (CList &&x) noexcept;
+
+        /*!
+            @fn operator= (const CList &x) noexcept
+            @brief This is the copy-assignment of the class CList: the elements of @p x are copied in new nodes,
+                   and the old ones are freed.
+            @param[in] @p CList this is the list who want to copy.
+        */
+        CList &operator= (const CList &x) noexcept;
+
+        /*!
+            @fn operator= (CList &&x) noexcept
+            @brief This is the move-assignment of the class CList: the old elements are freed, the nodes of @p x
+                   are taken and @p x is left empty.
+            @param[in] @p CList this is the list whose nodes are taken.
+        */
+        CList &operator= (CList &&x) noexcept;
 
         /*!
             @fn explicit CList () noexcept
@@ -127,6 +177,12 @@ namespace nsSdD
         template<class InputIterator>
         explicit CList (InputIterator first, InputIterator last) noexcept;
 
+        /*!
+            @fn     ~CList () noexcept
+            @brief  The destructor unlinks the nodes, which own each other, so that they are freed.
+         */
+        ~CList () noexcept;
+
         // V1
         /*!
             @fn     getHead() const noexcept
@@ -279,7 +335,8 @@ namespace nsSdD
         // Sort
         /*!
            @fn     sort() noexcept
-           @brief  This function the CList in ascending order.
+           @brief  This function the CList in ascending order, stable, in O(n log n) by relinking the nodes:
+                   the iterators stay valid and keep pointing to the same elements.
         */
         void sort() noexcept;
 
@@ -342,7 +399,8 @@ namespace nsSdD
            @param[in] position The position where you want to insert the new element.
            @param[in] first An iterator to the first element to insert.
            @param[in] last An iterator to the last element to insert.
-           @details Any kind of InputIterator is accepted...
+           @details Any kind of InputIterator is accepted... The new nodes are chained together first, then
+                    linked into the CList at once.
            @return A iterator that points to the first of newly inserted elements.
         */
         template<class InputIterator>
@@ -357,6 +415,26 @@ namespace nsSdD
         */
         iterator erase (iterator del) noexcept;
 
+        // Node handles
+        /*!
+           @fn     extract (iterator position) noexcept
+           @brief  This function unlinks the element at @p position and gives its node, with the value, to the
+                   returned handle. Nothing is freed: the node can be inserted again in any CList of the same type.
+           @param[in] position An iterator to the element we want to extract.
+           @return node_type The handle owning the node.
+        */
+        node_type extract (iterator position) noexcept;
+
+        /*!
+           @fn     insert (iterator position, node_type &&node) noexcept
+           @brief  This function links the node owned by @p node before @p position, without allocating nor
+                   copying, and empties @p node.
+           @param[in] position The position where we want to insert the node.
+           @param[in] node The handle of an extracted node.
+           @return iterator The inserted element, end () if @p node was empty.
+        */
+        iterator insert (iterator position, node_type &&node) noexcept;
+
         /*!
            @fn     erase (iterator first, iterator last) noexcept
            @brief  This function elements between the @p first and @p last iterator .
@@ -423,10 +501,29 @@ namespace nsSdD
         template<class Compare>
         void unique (Compare pred) noexcept;
 
+        // Dedup
+        /*!
+          @fn     dedup () noexcept
+          @brief  This function removes the elements equal to an earlier one, adjacent or not, in one pass:
+                  the first occurrences keep their order. They are found in an open-addressing hash set sized
+                  from size (), holding pointers to the elements, not copies. The removed nodes are released
+                  together at the end.
+          @return size_type The number of elements removed.
+       */
+        size_type dedup () noexcept;
+
+        /*!
+          @fn     template<class Hash, class KeyEqual> dedup (Hash hash, KeyEqual eq) noexcept
+          @brief  Same as @p dedup, with @p hash and @p eq instead of std::hash and operator==.
+       */
+        template<class Hash, class KeyEqual>
+        size_type dedup (Hash hash, KeyEqual eq) noexcept;
+
         //Splice
         /*!
           @fn     splice (iterator position, CList &x) noexcept
           @brief  This function move the CList @p x to the current CList before @p position.
+                  The nodes are relinked in O(1), nothing is copied nor allocated.
           @param[in] position The position where we want to insert the other list.
           @param[in] x The CList we want to add on the current CList.
        */
@@ -435,6 +532,7 @@ namespace nsSdD
         /*!
           @fn     splice (iterator position, CList &x, iterator i) noexcept
           @brief  This function move element @p i from the CList @p x to the current CList before @p position.
+                  The node is relinked in O(1), iterators to it stay valid. @p x may be the current CList.
           @param[in] position The position where we want to insert the other list.
           @param[in] x The CList we want to add on the current CList.
           @param[in] i The iterator who pointing the element who want to move on the current CList.
@@ -444,6 +542,7 @@ namespace nsSdD
         /*!
           @fn     splice (iterator position, CList &x,iterator first, iterator last) noexcept
           @brief  This function move elements between @p first and @p last from the CList @p x to the current CList before @p position.
+                  The nodes are relinked, only counting them when @p x is another CList is linear.
           @param[in] position The position where we want to insert the other list.
           @param[in] x The CList we want to add on the current CList.
           @param[in] first The iterator who pointing the first element who want to move on the current CList.
@@ -453,26 +552,272 @@ namespace nsSdD
 
         //Merge
         /*!
-          @fn     merge (CList<T>& x) noexcept
-          @brief  This function merge two sorted list @p x after the current CList.
+          @fn     merge (CList& x) noexcept
+          @brief  This function merge two sorted list @p x after the current CList, in linear time.
+                  The elements of @p x go after the equal elements of the current CList.
           @param[in] x The sorted list we want to merge with the current CList.
        */
-        void merge (CList<T>& x) noexcept;
+        void merge (CList& x) noexcept;
+
+        // Partition and selection
+        /*!
+          @fn     template<class Predicate> partition (Predicate pred) noexcept
+          @brief  This function moves the elements satisfying @p pred before the others, in one pass.
+                  The nodes are relinked, no element is copied. The order of each part is kept, as with
+                  @p stable_partition.
+          @param[in] pred The predicate of the elements we want first.
+          @return iterator The first element not satisfying @p pred.
+       */
+        template<class Predicate>
+        iterator partition (Predicate pred) noexcept;
+
+        /*!
+          @fn     template<class Predicate> stable_partition (Predicate pred) noexcept
+          @brief  This function moves the elements satisfying @p pred before the others, in one pass, keeping
+                  their relative order in each part. Only the nodes not satisfying @p pred are relinked.
+          @param[in] pred The predicate of the elements we want first.
+          @return iterator The first element not satisfying @p pred.
+       */
+        template<class Predicate>
+        iterator stable_partition (Predicate pred) noexcept;
+
+        /*!
+          @fn     nth_element (size_type n) noexcept
+          @brief  This function puts at the position @p n the element which would be there if the CList was
+                  stably sorted, the elements before it not greater and the ones after not less, by quickselect.
+                  The nodes are relinked into three parts around a pivot at each step, no element is copied,
+                  in linear expected time. Equal elements keep their relative order.
+          @param[in] n The position of the element we want in place.
+          @return iterator The element at the position @p n, end () if there is none.
+       */
+        iterator nth_element (size_type n) noexcept;
+
+        /*!
+          @fn     template<class Compare> nth_element (size_type n, Compare comp) noexcept
+          @brief  Same as @p nth_element, with @p comp.
+       */
+        template<class Compare>
+        iterator nth_element (size_type n, Compare comp) noexcept;
+
+        /*!
+          @fn     partial_sort (size_type k) noexcept
+          @brief  This function sorts the @p k smallest elements at the beginning, the others following in no
+                  particular order. The @p k elements are selected as by @p nth_element, then sorted by merging
+                  runs of nodes: in O(n + k log k) expected time, without copying any element. Stable.
+          @param[in] k The number of elements we want sorted.
+       */
+        void partial_sort (size_type k) noexcept;
+
+        /*!
+          @fn     template<class Compare> partial_sort (size_type k, Compare comp) noexcept
+          @brief  Same as @p partial_sort, with @p comp.
+       */
+        template<class Compare>
+        void partial_sort (size_type k, Compare comp) noexcept;
 
         // Reverse
         /*!
           @fn     reverse () noexcept
-          @brief  This function reverse the head and the tail of the CList.
+          @brief  This function reverses the order of the elements in O(1): only the orientation of the CList
+                  flips, no node is written. The iterators, push/pop and the algorithms follow the orientation;
+                  getHead and getTail keep giving the physical ends of the chain.
+                  The iterators taken before keep the former orientation: take them again, or, if the CList
+                  wasn't reversed, call @p materialize_reverse so that they follow the new order.
        */
         void reverse () noexcept;
 
+        /*!
+          @fn     materialize_reverse () noexcept
+          @brief  This function physically reverses the links of a reversed CList, in linear time, so that its
+                  order follows the links of the nodes again. The order of the elements is unchanged.
+       */
+        void materialize_reverse () noexcept;
+
+        /*!
+          @fn     isReversed () const noexcept
+          @brief  This function return true if the order of the elements is against the links of the nodes.
+       */
+        bool isReversed () const noexcept;
+
+        // Serialization, defined in CListStream.h which must be included to call them
+        /*!
+          @fn     write_to (std::ostream &out) const noexcept
+          @brief  This function writes the elements in @p out by chunks of about 1 MiB, see CSerializer.
+                  A member template, so that only the translation units including CListStream.h instantiate it.
+          @param[in] out The binary stream we write to.
+          @return bool If the whole CList was written.
+       */
+        template<typename Serialized = T>
+        bool write_to (std::ostream &out) const noexcept;
+
+        /*!
+          @fn     write_to (int fd) const noexcept
+          @brief  This function writes the elements in the file descriptor @p fd, with one system call per chunk.
+          @param[in] fd The file, pipe or socket we write to.
+          @return bool If the whole CList was written.
+       */
+        template<typename Serialized = T>
+        bool write_to (int fd) const noexcept;
+
+        /*!
+          @fn     read_from (std::istream &in) noexcept
+          @brief  This function reads a CList written by @p write_to and appends its elements.
+                  A stream read can't be interrupted, so the chunks are read in the calling thread.
+          @param[in] in The binary stream we read from.
+          @return bool If a whole CList was read, the elements read before an error are kept.
+       */
+        template<typename Serialized = T>
+        bool read_from (std::istream &in) noexcept;
+
+        /*!
+          @fn     read_from (int fd) noexcept
+          @brief  This function reads a CList written by @p write_to from the file descriptor @p fd
+                  and appends its elements. The chunks are read in a background thread while the elements
+                  of the previous ones are added.
+          @param[in] fd The file, pipe or socket we read from.
+          @return bool If a whole CList was read, the elements read before an error are kept.
+       */
+        template<typename Serialized = T>
+        bool read_from (int fd) noexcept;
+
+        // Memory
+        /*!
+          @fn     memory_usage (bool deep = false) const noexcept
+          @brief  This function return the bytes used by the CList: elements, links, allocator overhead and sentinels.
+                  In O(1), or in O(n log n) with @p deep, which walks the nodes to measure how they are spread in
+                  memory.
+          @param[in] deep If the nodes are walked.
+          @return CMemoryUsage The breakdown of the bytes used.
+       */
+        CMemoryUsage memory_usage (bool deep = false) const noexcept;
+
+        /*!
+          @fn     node_cache_stats () noexcept
+          @brief  This function return the state of the node cache of the calling thread for the nodes of CList.
+                  The nodes are allocated from caches local to each thread, see CNodeCache, unless the allocation
+                  policy is CSharedAllocation (the default if CLIST_NO_NODE_CACHE is defined, e.g. for memory
+                  checkers), then they come from std::make_shared.
+       */
+        static CNodeCache::CStats node_cache_stats () noexcept;
+
     private:
+        /*!
+          @brief  Holds the locks of a call to a public function of the CList, and records it in the trace,
+                  as chosen by the locking and instrumentation policies.
+       */
+        class CCallScope
+        {
+        public:
+            CCallScope (const CList &list, CListTrace::EOperation operation, size_type count = 0,
+                        const CList *other = nullptr) noexcept
+                    : m_guard (list, other),
+                      m_trace (list.traceId (), operation, sizeof (T), CListTrace::EPosition::None, count,
+                               other ? other->traceId () : 0)
+            {
+            }
+
+            CCallScope (const CList &list, CListTrace::EOperation operation, const iterator &position,
+                        size_type count = 1, const CList *other = nullptr) noexcept
+                    : m_guard (list, other),
+                      m_trace (list.traceId (), operation, sizeof (T),
+                               instrumentation_policy::traced ? list.tracePosition (operation, position.getNode ())
+                                                              : CListTrace::EPosition::None,
+                               count, other ? other->traceId () : 0)
+            {
+            }
+
+            void setCount (size_type count) noexcept
+            {
+                m_trace.setCount (count);
+            }
+
+        private:
+            typename locking_policy::CGuard m_guard;
+
+            typename instrumentation_policy::CScope m_trace;
+        };
+
+        /*!
+          @brief  Return where the element inserted before @p position, or removed at @p position, is.
+       */
+        CListTrace::EPosition tracePosition (CListTrace::EOperation operation, const CNodePtr &position) const noexcept;
+
+        /*!
+          @brief  Return the size recorded in the trace, 0 without instrumentation, so that an uncounted size is
+                  not walked for nothing.
+       */
+        size_type traceSize () const noexcept;
+
+        /*!
+          @brief  Return the bytes of the block allocated by std::make_shared for a node and its control block.
+       */
+        static size_t nodeBlockSize () noexcept;
+
+        /*!
+          @brief  Return a new node holding @p val between @p previous and @p next, from the node cache.
+       */
+        static CNodePtr makeNode (const T &val, const CNodePtr &next, const CNodePtr &previous) noexcept;
+
+        /*!
+          @brief  Unlinks the nodes from @p first until @p last (excluded), in the orientation of the CList,
+                  so that they are freed once no iterator holds them.
+       */
+        void release (CNodePtr first, const CNodePtr &last) noexcept;
+
+        /*!
+          @brief  Moves the elements of the sorted CList @p x into the sorted CList @p into, by relinking them.
+                  Stable: an element of @p x goes after the equal elements of @p into.
+       */
+        template<class Compare>
+        static void mergeRuns (CList &into, CList &x, Compare comp) noexcept;
 
         /*!
-          @var     m_size
-          @brief  The size of the CList.
+          @brief  Sorts @p x by merging runs of nodes of doubling lengths, in O(n log n), stable.
        */
-        size_type m_size = 0;
+        template<class Compare>
+        static void mergeSort (CList &x, Compare comp) noexcept;
+
+        /*!
+          @brief  Return the sentinel before the first element, in the orientation of the CList.
+       */
+        const CNodePtr &frontSentinel () const noexcept;
+
+        /*!
+          @brief  Return the sentinel after the last element, in the orientation of the CList.
+       */
+        const CNodePtr &backSentinel () const noexcept;
+
+        /*!
+          @brief  Return the node following @p node in the orientation of the CList.
+       */
+        CNodePtr nextOf (const CNodePtr &node) const noexcept;
+
+        /*!
+          @brief  Return the node preceding @p node in the orientation of the CList.
+       */
+        CNodePtr previousOf (const CNodePtr &node) const noexcept;
+
+        /*!
+          @brief  Adds a node holding @p val before @p position, in the orientation of the CList.
+       */
+        CNodePtr addBefore (const CNodePtr &position, const T &val) noexcept;
+
+        /*!
+          @brief  Links @p second after @p first, in the orientation of the CList.
+       */
+        void linkNext (const CNodePtr &first, const CNodePtr &second) noexcept;
+
+        /*!
+          @brief  Links the chain of new nodes from @p first to @p last, linked in the orientation of the CList,
+                  before @p position.
+       */
+        void linkBefore (const CNodePtr &position, const CNodePtr &first, const CNodePtr &last) noexcept;
+
+        /*!
+          @brief  Moves the nodes of @p x from @p first to @p last (included), in the orientation of @p x, before
+                  @p position. The links of the nodes moved are reversed if the orientations differ.
+       */
+        void spliceChain (const CNodePtr &position, CList &x, const CNodePtr &first, const CNodePtr &last) noexcept;
 
         /*!
           @var     m_head
@@ -485,6 +830,12 @@ namespace nsSdD
           @brief  A pointer the tail of the CList.
        */
         CNodePtr m_tail = nullptr;
+
+        /*!
+          @var     m_reversed
+          @brief  If the elements are ordered from the tail to the head.
+       */
+        bool m_reversed = false;
     };
 }
 
@@ -492,3 +843,20 @@ namespace nsSdD
 #include "CIterator.hxx"
 #include "CConstIterator.hxx"
 #include "CNode.hxx"
+#include "CNodeHandle.hxx"
+
+#ifndef CLIST_HEADER_ONLY
+namespace nsSdD
+{
+    /*!
+        The CList of the types used throughout the project are compiled once in the CListInstances library
+        (CList.cxx), the other translation units only declare them. A type is only worth listing if it is used:
+        every member of an explicit instantiation is compiled and linked, called or not. Define CLIST_HEADER_ONLY
+        to instantiate them in every translation unit instead, without linking the library. The other types are
+        always instantiated where they are used.
+     */
+    extern template class CList<int>;
+    extern template class CList<int *>;
+    extern template class CList<std::shared_ptr<int>>;
+}
+#endif
@@ -7,23 +7,28 @@
 */
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <iterator>
+#include <vector>
 #include "CList.h"
 #include "CNode.hxx"
 
-template<typename T>
-nsSdD::CList<T>::CList () noexcept
-        : m_head (std::make_shared<CNode> (T (), nullptr, nullptr)),
-          m_tail (std::make_shared<CNode> (T (), nullptr, m_head))
+template<typename T, class Policy>
+nsSdD::CList<T, Policy>::CList () noexcept
+        : instrumentation_policy (sizeof (T)),
+          m_head (makeNode (T (), nullptr, nullptr)),
+          m_tail (makeNode (T (), nullptr, m_head))
 {
     m_head->setNext (m_tail);
 }
 
-template<typename T>
-nsSdD::CList<T>::CList (size_type n) noexcept
-        : m_head (std::make_shared<CNode> (T (), nullptr, nullptr)),
-          m_tail (std::make_shared<CNode> (T (), nullptr, m_head))
+template<typename T, class Policy>
+nsSdD::CList<T, Policy>::CList (size_type n) noexcept
+        : instrumentation_policy (sizeof (T)),
+          m_head (makeNode (T (), nullptr, nullptr)),
+          m_tail (makeNode (T (), nullptr, m_head))
 {
     m_head->setNext (m_tail);
 
@@ -31,10 +36,11 @@ nsSdD::CList<T>::CList (size_type n) noexcept
         push_back (T ());
 }
 
-template<typename T>
-nsSdD::CList<T>::CList (size_type n, const T &val) noexcept
-        : m_head (std::make_shared<CNode> (T (), nullptr, nullptr)),
-          m_tail (std::make_shared<CNode> (T (), nullptr, m_head))
+template<typename T, class Policy>
+nsSdD::CList<T, Policy>::CList (size_type n, const T &val) noexcept
+        : instrumentation_policy (sizeof (T)),
+          m_head (makeNode (T (), nullptr, nullptr)),
+          m_tail (makeNode (T (), nullptr, m_head))
 {
     m_head->setNext (m_tail);
 
@@ -42,381 +48,1014 @@ nsSdD::CList<T>::CList (size_type n, const T &val) noexcept
         push_back (val);
 }
 
-template<typename T>
-nsSdD::CList<T>::CList (const nsSdD::CList<T> &list) noexcept
-        : m_head (std::make_shared<CNode> (T (), nullptr, nullptr)),
-          m_tail (std::make_shared<CNode> (T (), nullptr, m_head))
+template<typename T, class Policy>
+nsSdD::CList<T, Policy>::CList (const nsSdD::CList<T, Policy> &list) noexcept
+        : instrumentation_policy (sizeof (T)),
+          m_head (makeNode (T (), nullptr, nullptr)),
+          m_tail (makeNode (T (), nullptr, m_head))
 {
     m_head->setNext (m_tail);
 
+    typename locking_policy::CGuard guard (list);
     for (auto itr = list.cbegin (); itr != list.cend (); ++itr)
         push_back (*itr);
 }
 
-template<typename T>
+template<typename T, class Policy>
 template<class InputIterator>
-nsSdD::CList<T>::CList (InputIterator begin, InputIterator end) noexcept
-        : m_head (std::make_shared<CNode> (T (), nullptr, nullptr)),
-          m_tail (std::make_shared<CNode> (T (), nullptr, m_head))
+nsSdD::CList<T, Policy>::CList (InputIterator begin, InputIterator end) noexcept
+        : instrumentation_policy (sizeof (T)),
+          m_head (makeNode (T (), nullptr, nullptr)),
+          m_tail (makeNode (T (), nullptr, m_head))
 {
     m_head->setNext (m_tail);
 
     assign (begin, end);
 }
 
-template<typename T>
-typename nsSdD::CList<T>::CNodePtr nsSdD::CList<T>::getHead () const noexcept
+template<typename T, class Policy>
+nsSdD::CList<T, Policy>::CList (CList &&x) noexcept : CList ()
+{
+    swap (x);
+}
+
+template<typename T, class Policy>
+nsSdD::CList<T, Policy> &nsSdD::CList<T, Policy>::operator= (const CList &x) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Assign, x.traceSize ());
+    if (this != &x)
+    {
+        // Copy and swap: the old nodes are freed with the copy
+        CList copy (x);
+        swap (copy);
+    }
+
+    return *this;
+}
+
+template<typename T, class Policy>
+nsSdD::CList<T, Policy> &nsSdD::CList<T, Policy>::operator= (CList &&x) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Assign, x.traceSize ());
+    if (this != &x)
+    {
+        clear ();
+        swap (x);
+    }
+
+    return *this;
+}
+
+template<typename T, class Policy>
+nsSdD::CList<T, Policy>::~CList () noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Destroy, traceSize ());
+    clear ();
+
+    m_head->setNext (nullptr);
+    m_tail->setPrevious (nullptr);
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::CNodePtr nsSdD::CList<T, Policy>::getHead () const noexcept
 {
     return m_head;
 }
 
-template<typename T>
-typename nsSdD::CList<T>::CNodePtr nsSdD::CList<T>::getTail () const noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::CNodePtr nsSdD::CList<T, Policy>::getTail () const noexcept
 {
     return m_tail;
 }
 
-template<typename T>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::begin () noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::begin () noexcept
 {
-    return iterator (m_head->getNext ());
+    return iterator (nextOf (frontSentinel ()), m_reversed);
 }
 
-template<typename T>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::end () noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::end () noexcept
 {
-    return iterator (m_tail);
+    return iterator (backSentinel (), m_reversed);
 }
 
-template<typename T>
-typename nsSdD::CList<T>::const_iterator nsSdD::CList<T>::cbegin () const noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::const_iterator nsSdD::CList<T, Policy>::cbegin () const noexcept
 {
-    return const_iterator (m_head->getNext ());
+    return const_iterator (nextOf (frontSentinel ()), m_reversed);
 }
 
-template<typename T>
-typename nsSdD::CList<T>::const_iterator nsSdD::CList<T>::cend () const noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::const_iterator nsSdD::CList<T, Policy>::cend () const noexcept
 {
-    return const_iterator (m_tail);
+    return const_iterator (backSentinel (), m_reversed);
 }
 
-template<typename T>
-typename std::reverse_iterator<typename nsSdD::CList<T>::iterator> nsSdD::CList<T>::rbegin () noexcept
+template<typename T, class Policy>
+typename std::reverse_iterator<typename nsSdD::CList<T, Policy>::iterator> nsSdD::CList<T, Policy>::rbegin () noexcept
 {
     return std::reverse_iterator<iterator> (end ());
 }
 
-template<typename T>
-typename std::reverse_iterator<typename nsSdD::CList<T>::iterator> nsSdD::CList<T>::rend () noexcept
+template<typename T, class Policy>
+typename std::reverse_iterator<typename nsSdD::CList<T, Policy>::iterator> nsSdD::CList<T, Policy>::rend () noexcept
 {
     return std::reverse_iterator<iterator> (begin ());
 }
 
-template<typename T>
-typename std::reverse_iterator<typename nsSdD::CList<T>::const_iterator> nsSdD::CList<T>::crbegin () noexcept
+template<typename T, class Policy>
+typename std::reverse_iterator<typename nsSdD::CList<T, Policy>::const_iterator> nsSdD::CList<T, Policy>::crbegin () noexcept
 {
     return std::reverse_iterator<const_iterator> (cend ());
 }
 
-template<typename T>
-typename std::reverse_iterator<typename nsSdD::CList<T>::const_iterator> nsSdD::CList<T>::crend () noexcept
+template<typename T, class Policy>
+typename std::reverse_iterator<typename nsSdD::CList<T, Policy>::const_iterator> nsSdD::CList<T, Policy>::crend () noexcept
 {
     return std::reverse_iterator<const_iterator> (cbegin ());
 }
 
-template<typename T>
-bool nsSdD::CList<T>::empty () const noexcept
+template<typename T, class Policy>
+bool nsSdD::CList<T, Policy>::empty () const noexcept
 {
-    return m_size == 0;
+    typename locking_policy::CGuard guard (*this);
+    return size_policy::counted ? this->countedSize () == 0 : nextOf (frontSentinel ()) == backSentinel ();
 }
 
-template<typename T>
-typename nsSdD::CList<T>::size_type nsSdD::CList<T>::size () const noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::size_type nsSdD::CList<T, Policy>::size () const noexcept
 {
-    return m_size;
+    typename locking_policy::CGuard guard (*this);
+    if (size_policy::counted)
+        return this->countedSize ();
+
+    size_type count = 0;
+    for (CNodePtr node = nextOf (frontSentinel ()); node != backSentinel (); node = nextOf (node))
+        ++count;
+
+    return count;
 }
 
-template<typename T>
-T nsSdD::CList<T>::front () const noexcept
+template<typename T, class Policy>
+T nsSdD::CList<T, Policy>::front () const noexcept
 {
-    return m_head->getNext ()->getInfo ();
+    CCallScope call (*this, CListTrace::EOperation::Front);
+    return nextOf (frontSentinel ())->getInfo ();
 }
 
-template<typename T>
-T nsSdD::CList<T>::back () const noexcept
+template<typename T, class Policy>
+T nsSdD::CList<T, Policy>::back () const noexcept
 {
-    return m_tail->getPrevious ()->getInfo ();
+    CCallScope call (*this, CListTrace::EOperation::Back);
+    return previousOf (backSentinel ())->getInfo ();
 }
 
-template<typename T>
+template<typename T, class Policy>
 template<class InputIterator>
-void nsSdD::CList<T>::assign (InputIterator begin, InputIterator last) noexcept
+void nsSdD::CList<T, Policy>::assign (InputIterator begin, InputIterator last) noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Assign);
     clear ();
-    for (; begin != last; ++begin)
-        push_back (*begin);
+    insert (end (), begin, last);
+    call.setCount (traceSize ());
 }
 
-template<typename T>
-void nsSdD::CList<T>::assign (unsigned n, const T &val) noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::assign (unsigned n, const T &val) noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Assign, n);
     clear ();
     for (size_type i = 0; i < n; ++i)
         push_back (val);
 }
 
-template<typename T>
-void nsSdD::CList<T>::pop_front () noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::pop_front () noexcept
 {
-    if (m_size != 0)
+    CCallScope call (*this, CListTrace::EOperation::PopFront);
+    if (!empty ())
     {
-        m_head->getNext ()->remove ();
-        --m_size;
+        nextOf (frontSentinel ())->remove ();
+        this->subtractSize (1);
     }
 }
 
-template<typename T>
-void nsSdD::CList<T>::push_front (const T &x) noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::push_front (const T &x) noexcept
 {
-    m_head->addAfter (x);
-    ++m_size;
+    CCallScope call (*this, CListTrace::EOperation::PushFront, 1);
+    addBefore (nextOf (frontSentinel ()), x);
+    this->addSize (1);
 }
 
-template<typename T>
-void nsSdD::CList<T>::push_back (const T &x) noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::push_back (const T &x) noexcept
 {
-    m_tail->addBefore (x);
-    ++m_size;
+    CCallScope call (*this, CListTrace::EOperation::PushBack, 1);
+    addBefore (backSentinel (), x);
+    this->addSize (1);
 }
 
-template<typename T>
-void nsSdD::CList<T>::pop_back () noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::pop_back () noexcept
 {
-    if (m_size != 0)
+    CCallScope call (*this, CListTrace::EOperation::PopBack);
+    if (!empty ())
     {
-        m_tail->getPrevious ()->remove ();
-        --m_size;
+        previousOf (backSentinel ())->remove ();
+        this->subtractSize (1);
     }
 }
 
-template<typename T>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::erase (iterator del) noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::erase (iterator del) noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Erase, del);
     del.getNode ()->remove ();
-    --m_size;
+    this->subtractSize (1);
+
+    return iterator (nextOf (del.getNode ()), m_reversed);
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::node_type nsSdD::CList<T, Policy>::extract (iterator position) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Extract, position);
+    CNodePtr node = position.getNode ();
+
+    node->remove ();
+    node->setNext (nullptr);
+    node->setPrevious (nullptr);
+    this->subtractSize (1);
+
+    return node_type (node);
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::insert (iterator position, node_type &&node) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::InsertNode, position);
+    if (node.empty ())
+        return end ();
+
+    CNodePtr inserted = std::move (node.m_node);
+    linkBefore (position.getNode (), inserted, inserted);
+    this->addSize (1);
 
-    return iterator (del.getNode ()->getNext ());
+    return iterator (inserted, m_reversed);
 }
 
-template<typename T>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::erase (iterator first, iterator last) noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::erase (iterator first, iterator last) noexcept
 {
-    for(auto i = first ; i != last ; ++i)
+    CCallScope call (*this, CListTrace::EOperation::Erase, first, 0);
+    size_type count = 0;
+
+    for(auto i = first ; i != last ; ++i, ++count)
         erase (i);
 
-    return iterator (last.getNode ());
+    call.setCount (count);
+
+    return iterator (last.getNode (), m_reversed);
 }
 
-template<typename T>
-void nsSdD::CList<T>::resize (unsigned n, const T &val /*= T()*/) noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::resize (unsigned n, const T &val /*= T()*/) noexcept
 {
-    if (m_size == n)
+    CCallScope call (*this, CListTrace::EOperation::Resize, n);
+    if (size () == n)
         return;
 
     if (0 == n)
         clear ();
 
-    if (m_size > n) // Reducing the CList to n
+    if (size () > n) // Reducing the CList to n
     {
         iterator itr = begin ();
         std::advance (itr, n - 1);
 
-        itr.getNode ()->setNext (m_tail);
-        m_tail->setPrevious (itr.getNode ());
+        CNodePtr cut = nextOf (itr.getNode ());
+        linkNext (itr.getNode (), backSentinel ());
+        release (cut, backSentinel ());
 
-        m_size = n;
+        this->setSize (n);
     }
     else // Expanding the CList to n
     {
-        for (; n != 0; --n)
+        for (size_type count = size (); count < n; ++count)
             push_back (val);
     }
 }
 
-template<typename T>
-void nsSdD::CList<T>::swap (nsSdD::CList<T> &x) noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::swap (nsSdD::CList<T, Policy> &x) noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Swap, x.traceSize (), &x);
     std::swap (x.m_head, m_head);
     std::swap (x.m_tail, m_tail);
-    std::swap (x.m_size, m_size);
+    this->swapSize (x);
+    std::swap (x.m_reversed, m_reversed);
 }
 
-template<typename T>
-void nsSdD::CList<T>::clear () noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::clear () noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Clear, traceSize ());
+    release (nextOf (frontSentinel ()), backSentinel ());
+
     m_head->setNext (m_tail);
     m_tail->setPrevious (m_head);
 
-    m_size = 0;
+    this->setSize (0);
 }
 
-template<typename T>
-void nsSdD::CList<T>::remove (const T &val) noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::remove (const T &val) noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Remove);
+    size_type size = traceSize ();
+
     remove_if ([val] (const T &x)
     {
         return x == val;
     });
+    call.setCount (size - traceSize ());
 }
 
-template<typename T>
+template<typename T, class Policy>
 template<class Predicate>
-void nsSdD::CList<T>::remove_if (Predicate pred) noexcept
+void nsSdD::CList<T, Policy>::remove_if (Predicate pred) noexcept
 {
-    for (CNodePtr a = m_head->getNext (); a != m_tail; a = a->getNext ())
+    CCallScope call (*this, CListTrace::EOperation::Remove);
+    size_type count = 0;
+
+    for (CNodePtr a = nextOf (frontSentinel ()); a != backSentinel (); a = nextOf (a))
     {
         if (pred (a->getInfo ()))
         {
             a->remove ();
-            --m_size;
+            ++count;
         }
     }
+
+    this->subtractSize (count);
+    call.setCount (count);
 }
 
-template<typename T>
-void nsSdD::CList<T>::unique () noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::unique () noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Unique);
+    size_type size = traceSize ();
+
     unique ([] (const T &a, const T &b)
     {
         return a == b;
     });
+    call.setCount (size - traceSize ());
 }
 
-template<typename T>
+template<typename T, class Policy>
 template<class Compare>
-void nsSdD::CList<T>::unique (Compare comp) noexcept
+void nsSdD::CList<T, Policy>::unique (Compare comp) noexcept
 {
-    for (CNodePtr currNode = m_head->getNext (); currNode != m_tail; currNode = currNode->getNext ())
-        while (comp (currNode->getInfo (), currNode->getNext ()->getInfo ()))
+    CCallScope call (*this, CListTrace::EOperation::Unique);
+    size_type count = 0;
+
+    for (CNodePtr currNode = nextOf (frontSentinel ()); currNode != backSentinel (); currNode = nextOf (currNode))
+        while (nextOf (currNode) != backSentinel () && comp (currNode->getInfo (), nextOf (currNode)->getInfo ()))
         {
-            currNode->getNext ()->remove ();
-            --m_size;
+            nextOf (currNode)->remove ();
+            ++count;
         }
+
+    this->subtractSize (count);
+    call.setCount (count);
+}
+
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::reverse () noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Reverse, traceSize ());
+    m_reversed = !m_reversed;
 }
 
-template<typename T>
-void nsSdD::CList<T>::reverse () noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::materialize_reverse () noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::MaterializeReverse, traceSize ());
+    if (!m_reversed)
+        return;
+
     for (CNodePtr currentNode = m_head; currentNode != m_tail; currentNode = currentNode->getPrevious ())
         std::swap (currentNode->getNext (), currentNode->getPrevious ());
 
     std::swap (m_tail->getNext (), m_tail->getPrevious ());
     std::swap (m_tail, m_head);
+    m_reversed = false;
 }
 
-template<typename T>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::insert (iterator position, T const &val) noexcept
+template<typename T, class Policy>
+bool nsSdD::CList<T, Policy>::isReversed () const noexcept
 {
-    ++m_size;
-    return iterator (position.getNode ()->addBefore (val));
+    return m_reversed;
 }
 
-template<typename T>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::insert (iterator position, size_type n, T const &val) noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::insert (iterator position, T const &val) noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Insert, position);
+    this->addSize (1);
+    return iterator (addBefore (position.getNode (), val), m_reversed);
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::insert (iterator position, size_type n, T const &val) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Insert, position, n);
     CNodePtr nextNode = position.getNode (),
-            prevNode = nextNode->getPrevious (),
-            currNode = prevNode;
+            prevNode = previousOf (nextNode);
 
     for (size_type i = 0; i < n; ++i)
     {
-        currNode = nextNode->addBefore (val);
-        ++m_size;
+        addBefore (nextNode, val);
+        this->addSize (1);
     }
 
-    return iterator (prevNode->getNext ());
+    return iterator (nextOf (prevNode), m_reversed);
 }
 
-template<typename T>
+template<typename T, class Policy>
 template<class InputIterator>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::insert (iterator position, InputIterator first, InputIterator last) noexcept
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::insert (iterator position, InputIterator first, InputIterator last) noexcept
 {
-    CNodePtr nextNode = position.getNode ();
-    CNodePtr prevNode = nextNode->getPrevious ();
+    CCallScope call (*this, CListTrace::EOperation::Insert, position, 0);
+    if (first == last)
+        return position;
+
+    // The new nodes are chained aside, then linked at once.
+    CNodePtr chainFirst = makeNode (*first, nullptr, nullptr), chainLast = chainFirst;
+    size_type count = 1;
 
-    for (; first != last; ++first)
+    for (++first; first != last; ++first, ++count)
     {
-        nextNode->addBefore (*first);
-        ++m_size;
+        CNodePtr node = makeNode (*first, nullptr, nullptr);
+        linkNext (chainLast, node);
+        chainLast = node;
     }
 
-    return iterator (prevNode->getNext ());
+    linkBefore (position.getNode (), chainFirst, chainLast);
+    this->addSize (count);
+    call.setCount (count);
+
+    return iterator (chainFirst, m_reversed);
 }
 
-template<typename T>
+template<typename T, class Policy>
 template<typename... Args>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::emplace (iterator position, Args &&... args) noexcept
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::emplace (iterator position, Args &&... args) noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Insert, position);
     return insert (position, T (std::forward<Args> (args)...));
 }
 
-template<typename T>
+template<typename T, class Policy>
 template<typename... Args>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::emplace_front (Args &&... args) noexcept
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::emplace_front (Args &&... args) noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::PushFront, 1);
     return emplace (begin (), std::forward<Args> (args)...);
 }
 
-template<typename T>
+template<typename T, class Policy>
 template<typename... Args>
-typename nsSdD::CList<T>::iterator nsSdD::CList<T>::emplace_back (Args &&... args) noexcept
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::emplace_back (Args &&... args) noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::PushBack, 1);
     return emplace (end (), std::forward<Args> (args)...);
 }
 
-template<typename T>
-void nsSdD::CList<T>::splice (iterator position, typename nsSdD::CList<T>& x) noexcept
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::size_type nsSdD::CList<T, Policy>::dedup () noexcept
+{
+    return dedup (std::hash<T> (), std::equal_to<T> ());
+}
+
+template<typename T, class Policy>
+template<class Hash, class KeyEqual>
+typename nsSdD::CList<T, Policy>::size_type nsSdD::CList<T, Policy>::dedup (Hash hash, KeyEqual eq) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Dedup);
+
+    size_type count = size ();
+    if (count < 2)
+        return 0;
+
+    // Linear probing in a table at most half full, indexed by the high bits of the hash times 2^64 / phi,
+    // so that identity hashes (integers) spread too.
+    struct CSlot
+    {
+        size_t hash;
+        const T *value;
+    };
+
+    unsigned bits = 1;
+    while ((size_type (1) << bits) < 2 * count)
+        ++bits;
+    const size_type mask = (size_type (1) << bits) - 1;
+    std::vector<CSlot> slots (mask + 1, CSlot { 0, nullptr });
+
+    // Destroyed at the end with all the removed nodes
+    CList removed;
+
+    for (iterator itr = begin (); itr != end ();)
+    {
+        iterator current = itr++;
+        const size_t h = hash (*current);
+
+        size_type i = static_cast<size_type> ((std::uint64_t (h) * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+        while (slots[i].value != nullptr && !(slots[i].hash == h && eq (*slots[i].value, *current)))
+            i = (i + 1) & mask;
+
+        if (slots[i].value == nullptr)
+            slots[i] = CSlot { h, &*current };
+        else
+            removed.splice (removed.end (), *this, current);
+    }
+
+    call.setCount (removed.size ());
+    return removed.size ();
+}
+
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::splice (iterator position, typename nsSdD::CList<T, Policy>& x) noexcept
 {
-    insert (position, x.begin (), x.end ());
-    x.clear ();
+    CCallScope call (*this, CListTrace::EOperation::Splice, position, x.traceSize (), &x);
+    if (&x == this || x.empty ())
+        return;
+
+    spliceChain (position.getNode (), x, x.nextOf (x.frontSentinel ()), x.previousOf (x.backSentinel ()));
+
+    this->addSize (x.countedSize ());
+    x.setSize (0);
 }
 
-template<typename T>
-void nsSdD::CList<T>::splice (iterator position, nsSdD::CList<T> &x, iterator i) noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::splice (iterator position, nsSdD::CList<T, Policy> &x, iterator i) noexcept
 {
-    insert (position, *i);
-    x.erase (i);
+    CCallScope call (*this, CListTrace::EOperation::Splice, position, 1, &x);
+    const CNodePtr &next = x.m_reversed ? i.getNode ()->getPrevious () : i.getNode ()->getNext ();
+    if (position == i || position.getNode () == next)
+        return;
+
+    spliceChain (position.getNode (), x, i.getNode (), i.getNode ());
+
+    x.subtractSize (1);
+    this->addSize (1);
 }
 
-template<typename T>
-void nsSdD::CList<T>::splice(iterator position, CList& x, iterator first, iterator last) noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::splice(iterator position, CList& x, iterator first, iterator last) noexcept
 {
-    insert (position, first, last);
-    x.erase (first,last);
+    CCallScope call (*this, CListTrace::EOperation::Splice, position, 0, &x);
+    if (first == last)
+        return;
+
+    // Without counted sizes, the range is moved in O(1)
+    if (size_policy::counted && &x != this)
+    {
+        size_type n = std::distance (first, last);
+        x.subtractSize (n);
+        this->addSize (n);
+        call.setCount (n);
+    }
+
+    spliceChain (position.getNode (), x, first.getNode (), x.previousOf (last.getNode ()));
 }
 
-template <typename T>
-void nsSdD::CList<T>::sort() noexcept
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::sort() noexcept
 {
+    CCallScope call (*this, CListTrace::EOperation::Sort, traceSize ());
     sort ([] (const T &a, const T &b)
     {
         return a < b;
     });
 }
 
-template <typename T>
+template<typename T, class Policy>
+template<class Compare>
+void nsSdD::CList<T, Policy>::sort(Compare comp) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Sort, traceSize ());
+    mergeSort (*this, comp);
+}
+
+template<typename T, class Policy>
+void  nsSdD::CList<T, Policy>::merge (nsSdD::CList<T, Policy>& x) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Merge, x.traceSize (), &x);
+    if (&x == this)
+        return;
+
+    mergeRuns (*this, x, [] (const T &a, const T &b)
+    {
+        return a < b;
+    });
+}
+
+template<typename T, class Policy>
+template<class Predicate>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::partition (Predicate pred) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Partition, traceSize ());
+    return stable_partition (pred);
+}
+
+template<typename T, class Policy>
+template<class Predicate>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::stable_partition (Predicate pred) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::Partition, traceSize ());
+    CList rejected;
+
+    for (iterator itr = begin (); itr != end ();)
+    {
+        iterator current = itr++;
+        if (!pred (*current))
+            rejected.splice (rejected.end (), *this, current);
+    }
+
+    if (rejected.empty ())
+        return end ();
+
+    CNodePtr split = rejected.nextOf (rejected.frontSentinel ());
+    splice (end (), rejected);
+
+    return iterator (split, m_reversed);
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::nth_element (size_type n) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::NthElement, n);
+    return nth_element (n, [] (const T &a, const T &b)
+    {
+        return a < b;
+    });
+}
+
+template<typename T, class Policy>
+template<class Compare>
+typename nsSdD::CList<T, Policy>::iterator nsSdD::CList<T, Policy>::nth_element (size_type n, Compare comp) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::NthElement, n);
+    if (n >= size ())
+        return end ();
+
+    // The elements placed before the nth are put back in *this as they are found. The partitions are reused
+    // by every round, the part holding the nth becomes the next work by swapping.
+    CList work, less, equal, greater, after;
+    CNodePtr nth;
+    work.swap (*this);
+
+    while (true)
+    {
+        // The median of the first, middle and last elements as pivot
+        iterator first = work.begin (), middle = work.begin (), last = --work.end ();
+        std::advance (middle, work.size () / 2);
+        iterator pivot = comp (*first, *middle)
+                         ? (comp (*middle, *last) ? middle : comp (*first, *last) ? last : first)
+                         : (comp (*first, *last) ? first : comp (*middle, *last) ? last : middle);
+
+        // The pivot is partitioned in its turn, so that the equal elements keep their order: a moved node
+        // keeps its value, which stays valid to compare to.
+        const T &value = *pivot;
+        while (!work.empty ())
+        {
+            iterator itr = work.begin ();
+            if (comp (*itr, value))
+                less.splice (less.end (), work, itr);
+            else if (comp (value, *itr))
+                greater.splice (greater.end (), work, itr);
+            else
+                equal.splice (equal.end (), work, itr);
+        }
+
+        if (n < less.size ())
+        {
+            after.splice (after.begin (), greater);
+            after.splice (after.begin (), equal);
+            work.swap (less);
+        }
+        else if (n < less.size () + equal.size ())
+        {
+            iterator itr = equal.begin ();
+            std::advance (itr, n - less.size ());
+            nth = itr.getNode ();
+
+            splice (end (), less);
+            splice (end (), equal);
+            splice (end (), greater);
+            break;
+        }
+        else
+        {
+            n -= less.size () + equal.size ();
+            splice (end (), less);
+            splice (end (), equal);
+            work.swap (greater);
+        }
+    }
+
+    splice (end (), after);
+
+    return iterator (nth, m_reversed);
+}
+
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::partial_sort (size_type k) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::PartialSort, k);
+    partial_sort (k, [] (const T &a, const T &b)
+    {
+        return a < b;
+    });
+}
+
+template<typename T, class Policy>
+template<class Compare>
+void nsSdD::CList<T, Policy>::partial_sort (size_type k, Compare comp) noexcept
+{
+    CCallScope call (*this, CListTrace::EOperation::PartialSort, k);
+    if (k == 0)
+        return;
+
+    CList prefix;
+    if (k < size ())
+    {
+        iterator last = nth_element (k - 1, comp);
+        prefix.splice (prefix.end (), *this, begin (), ++last);
+    }
+    else
+        prefix.splice (prefix.end (), *this);
+
+    mergeSort (prefix, comp);
+    splice (begin (), prefix);
+}
+
+template<typename T, class Policy>
+template<class Compare>
+void nsSdD::CList<T, Policy>::mergeRuns (CList &into, CList &x, Compare comp) noexcept
+{
+    iterator itr = into.begin ();
+
+    while (!x.empty ())
+    {
+        if (itr == into.end ())
+        {
+            into.splice (into.end (), x);
+            return;
+        }
+
+        if (comp (*x.begin (), *itr))
+            into.splice (itr, x, x.begin ());
+        else
+            ++itr;
+    }
+}
+
+template<typename T, class Policy>
 template<class Compare>
-void nsSdD::CList<T>::sort(Compare comp) noexcept
+void nsSdD::CList<T, Policy>::mergeSort (CList &x, Compare comp) noexcept
+{
+    if (x.size () < 2)
+        return;
+
+    // runs[i] is empty or holds a sorted run of 2^i elements, older than the runs below it
+    size_type runCount = 1;
+    for (size_type n = x.size (); n > 1; n >>= 1)
+        ++runCount;
+
+    std::vector<CList> runs (runCount);
+    CList carry;
+    size_type used = 0;
+
+    while (!x.empty ())
+    {
+        carry.splice (carry.begin (), x, x.begin ());
+
+        size_type i = 0;
+        for (; i < used && !runs[i].empty (); ++i)
+        {
+            mergeRuns (runs[i], carry, comp);
+            carry.splice (carry.end (), runs[i]);
+        }
+
+        runs[i].splice (runs[i].end (), carry);
+        if (i == used)
+            ++used;
+    }
+
+    for (size_type i = 0; i < used; ++i)
+    {
+        mergeRuns (runs[i], carry, comp);
+        carry.splice (carry.end (), runs[i]);
+    }
+
+    x.splice (x.end (), carry);
+}
+
+template<typename T, class Policy>
+nsSdD::CListTrace::EPosition nsSdD::CList<T, Policy>::tracePosition (CListTrace::EOperation operation,
+                                                                     const CNodePtr &position) const noexcept
+{
+    // The end is where an element is inserted at the back, the last element is where one is removed from it
+    bool removed = operation == CListTrace::EOperation::Erase || operation == CListTrace::EOperation::Extract;
+
+    if (position == nextOf (frontSentinel ()))
+        return CListTrace::EPosition::Front;
+
+    if (position == (removed ? previousOf (backSentinel ()) : backSentinel ()))
+        return CListTrace::EPosition::Back;
+
+    return CListTrace::EPosition::Middle;
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::size_type nsSdD::CList<T, Policy>::traceSize () const noexcept
+{
+    return instrumentation_policy::traced ? size () : 0;
+}
+
+template<typename T, class Policy>
+const typename nsSdD::CList<T, Policy>::CNodePtr &nsSdD::CList<T, Policy>::frontSentinel () const noexcept
+{
+    return m_reversed ? m_tail : m_head;
+}
+
+template<typename T, class Policy>
+const typename nsSdD::CList<T, Policy>::CNodePtr &nsSdD::CList<T, Policy>::backSentinel () const noexcept
+{
+    return m_reversed ? m_head : m_tail;
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::CNodePtr nsSdD::CList<T, Policy>::nextOf (const CNodePtr &node) const noexcept
+{
+    return m_reversed ? node->getPrevious () : node->getNext ();
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::CNodePtr nsSdD::CList<T, Policy>::previousOf (const CNodePtr &node) const noexcept
+{
+    return m_reversed ? node->getNext () : node->getPrevious ();
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::CNodePtr nsSdD::CList<T, Policy>::addBefore (const CNodePtr &position, const T &val) noexcept
+{
+    return m_reversed ? position->addAfter (val) : position->addBefore (val);
+}
+
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::linkNext (const CNodePtr &first, const CNodePtr &second) noexcept
+{
+    if (m_reversed)
+    {
+        first->setPrevious (second);
+        second->setNext (first);
+    }
+    else
+    {
+        first->setNext (second);
+        second->setPrevious (first);
+    }
+}
+
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::linkBefore (const CNodePtr &position, const CNodePtr &first, const CNodePtr &last) noexcept
+{
+    if (m_reversed)
+        position->linkAfter (last, first);
+    else
+        position->linkBefore (first, last);
+}
+
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::spliceChain (const CNodePtr &position, CList &x, const CNodePtr &first, const CNodePtr &last) noexcept
+{
+    // The ends of the chain along the links of the nodes.
+    const CNodePtr &linkFirst = x.m_reversed ? last : first,
+                   &linkLast = x.m_reversed ? first : last;
+
+    CNode::unlinkRing (linkFirst, linkLast);
+
+    if (x.m_reversed != m_reversed)
+        for (CNodePtr node = linkFirst, next; node != nullptr; node = next)
+        {
+            next = node == linkLast ? nullptr : node->getNext ();
+            std::swap (node->getNext (), node->getPrevious ());
+        }
+
+    if (m_reversed)
+        position->linkRingAfter (last, first);
+    else
+        position->linkRingBefore (first, last);
+}
+
+template<typename T, class Policy>
+nsSdD::CMemoryUsage nsSdD::CList<T, Policy>::memory_usage (bool deep /*= false*/) const noexcept
+{
+    CMemoryUsage usage;
+
+    size_type count = size ();
+
+    usage.allocationSize = allocation_policy::allocationSize (nodeBlockSize ());
+    usage.payload = count * sizeof (T);
+    usage.links = count * (sizeof (CNode) - sizeof (T));
+    usage.allocatorOverhead = count * (usage.allocationSize - sizeof (CNode));
+    usage.sentinels = 2 * usage.allocationSize;
+
+    if (!deep)
+        return usage;
+
+    usage.deep = true;
+
+    std::vector<std::uintptr_t> addresses;
+    addresses.reserve (count);
+
+    double strides = 0;
+    for (CNodePtr node = nextOf (frontSentinel ()); node != nullptr && node != backSentinel (); node = nextOf (node))
+    {
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t> (node.get ());
+
+        if (!addresses.empty ())
+        {
+            std::uintptr_t previous = addresses.back ();
+            strides += address > previous ? address - previous : previous - address;
+
+            if (address > previous && address - previous <= usage.allocationSize)
+                ++usage.adjacentSteps;
+        }
+
+        addresses.push_back (address);
+    }
+
+    usage.nodes = addresses.size ();
+    if (addresses.empty ())
+        return usage;
+
+    std::sort (addresses.begin (), addresses.end ());
+
+    usage.addressSpread = addresses.back () - addresses.front () + usage.allocationSize;
+    usage.pages = 1;
+    for (size_type i = 1; i < addresses.size (); ++i)
+        if (addresses[i] / 4096 != addresses[i - 1] / 4096)
+            ++usage.pages;
+
+    usage.averageStride = usage.nodes > 1 ? strides / (usage.nodes - 1) : 0;
+    usage.fragmentation = std::max (0.0, 1.0 - static_cast<double> (usage.nodes * usage.allocationSize) / usage.addressSpread);
+
+    return usage;
+}
+
+template<typename T, class Policy>
+size_t nsSdD::CList<T, Policy>::nodeBlockSize () noexcept
 {
-    for (iterator i = begin (); i != end (); ++i)
-        for (iterator j = i; j != end (); ++j)
-            if(comp(*j, *i))
-                std::iter_swap(i, j);
+    static const size_t size = [] () noexcept
+    {
+        CSizingAllocatorBase::requested () = 0;
+        std::allocate_shared<CNode> (CSizingAllocator<CNode> (), T (), nullptr, nullptr);
+
+        return CSizingAllocatorBase::requested ();
+    } ();
+
+    return size;
 }
 
-template<typename T>
-void  nsSdD::CList<T>::merge (nsSdD::CList<T>& x) noexcept
+template<typename T, class Policy>
+nsSdD::CNodeCache::CStats nsSdD::CList<T, Policy>::node_cache_stats () noexcept
 {
-    splice (end(), x);
-    sort();
+    return CNodeCache::stats (nodeBlockSize ());
+}
+
+template<typename T, class Policy>
+typename nsSdD::CList<T, Policy>::CNodePtr nsSdD::CList<T, Policy>::makeNode (const T &val, const CNodePtr &next, const CNodePtr &previous) noexcept
+{
+    return allocation_policy::template make<CNode> (val, next, previous);
+}
+
+template<typename T, class Policy>
+void nsSdD::CList<T, Policy>::release (CNodePtr first, const CNodePtr &last) noexcept
+{
+    while (first != nullptr && first != last)
+    {
+        // The links are moved out rather than copied
+        CNodePtr next = std::move (m_reversed ? first->getPrevious () : first->getNext ());
+
+        (m_reversed ? first->getNext () : first->getPrevious ()).reset ();
+        first = std::move (next);
+    }
 }
@@ -0,0 +1,363 @@
+/*!
+@file CListPolicy.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief The policies configuring a CList at compile time.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "CListTrace.h"
+#include "CMemoryUsage.h"
+#include "CNodeCache.h"
+
+namespace nsSdD
+{
+    // Size policies
+    /*!
+        @brief The CList counts its elements: size is O(1), splicing a range from another CList is linear in
+               the length of the range.
+     */
+    class CCountedSize
+    {
+    public:
+        static const bool counted = true;
+
+    protected:
+        size_t countedSize () const noexcept
+        {
+            return m_size;
+        }
+
+        void addSize (size_t n) noexcept
+        {
+            m_size += n;
+        }
+
+        void subtractSize (size_t n) noexcept
+        {
+            m_size -= n;
+        }
+
+        void setSize (size_t n) noexcept
+        {
+            m_size = n;
+        }
+
+        void swapSize (CCountedSize &x) noexcept
+        {
+            std::swap (m_size, x.m_size);
+        }
+
+    private:
+        /*!
+            @var m_size
+            @brief The number of elements.
+         */
+        size_t m_size = 0;
+    };
+
+    /*!
+        @brief The CList doesn't count its elements, and takes no room for it: size is linear, splicing any
+               range is O(1).
+     */
+    class CUncountedSize
+    {
+    public:
+        static const bool counted = false;
+
+    protected:
+        size_t countedSize () const noexcept
+        {
+            return 0;
+        }
+
+        void addSize (size_t) noexcept
+        {
+        }
+
+        void subtractSize (size_t) noexcept
+        {
+        }
+
+        void setSize (size_t) noexcept
+        {
+        }
+
+        void swapSize (CUncountedSize &) noexcept
+        {
+        }
+    };
+
+    // Allocation policies
+    /*!
+        @brief The nodes come from the node caches local to each thread, see CNodeCache.
+     */
+    struct CCachedAllocation
+    {
+        template<class Node, typename... Args>
+        static std::shared_ptr<Node> make (Args &&... args) noexcept
+        {
+            return std::allocate_shared<Node> (CNodeAllocator<Node> (), std::forward<Args> (args)...);
+        }
+
+        /*!
+            @brief  Return the bytes taken to allocate a node of @p blockSize bytes.
+         */
+        static size_t allocationSize (size_t blockSize) noexcept
+        {
+            return CNodeCache::slotSize (blockSize);
+        }
+    };
+
+    /*!
+        @brief The nodes come from std::make_shared, for memory checkers.
+     */
+    struct CSharedAllocation
+    {
+        template<class Node, typename... Args>
+        static std::shared_ptr<Node> make (Args &&... args) noexcept
+        {
+            return std::make_shared<Node> (std::forward<Args> (args)...);
+        }
+
+        /*!
+            @brief  Return the bytes taken to allocate a node of @p blockSize bytes, estimated from malloc.
+         */
+        static size_t allocationSize (size_t blockSize) noexcept
+        {
+            return mallocChunkSize (blockSize);
+        }
+    };
+
+    // Locking policies
+    /*!
+        @brief The CList is not locked, it is used by one thread at a time.
+     */
+    class CNoLocking
+    {
+    protected:
+        /*!
+            @brief Locks nothing.
+         */
+        class CGuard
+        {
+        public:
+            template<typename... Lists>
+            explicit CGuard (const Lists &...) noexcept
+            {
+            }
+
+            ~CGuard () noexcept
+            {
+            }
+        };
+    };
+
+    /*!
+        @brief Each call to the CList holds its recursive mutex, and the one of the other CList given to splice,
+               merge or swap, locked together without deadlock. The calls are atomic, the iterators are not
+               protected: they must be used by one thread at a time.
+     */
+    class CMutexLocking
+    {
+    protected:
+        CMutexLocking () noexcept = default;
+
+        // Each CList has its own mutex
+        CMutexLocking (const CMutexLocking &) noexcept
+        {
+        }
+
+        CMutexLocking &operator= (const CMutexLocking &) noexcept
+        {
+            return *this;
+        }
+
+        /*!
+            @brief Holds the mutex of a CList, and of the other one if not nullptr, during a call.
+         */
+        class CGuard
+        {
+        public:
+            explicit CGuard (const CMutexLocking &list, const CMutexLocking *other = nullptr) noexcept
+                    : m_list (list), m_other (other != &list ? other : nullptr)
+            {
+                if (m_other)
+                    std::lock (m_list.m_mutex, m_other->m_mutex);
+                else
+                    m_list.m_mutex.lock ();
+            }
+
+            ~CGuard () noexcept
+            {
+                m_list.m_mutex.unlock ();
+                if (m_other)
+                    m_other->m_mutex.unlock ();
+            }
+
+            CGuard (const CGuard &) = delete;
+
+            CGuard &operator= (const CGuard &) = delete;
+
+        private:
+            const CMutexLocking &m_list;
+
+            const CMutexLocking *m_other;
+        };
+
+    private:
+        /*!
+            @var m_mutex
+            @brief Recursive, the calls call each other.
+         */
+        mutable std::recursive_mutex m_mutex;
+    };
+
+    // Instrumentation policies
+    /*!
+        @brief The calls are not recorded.
+     */
+    class CNoInstrumentation
+    {
+    public:
+        static const bool traced = false;
+
+    protected:
+        explicit CNoInstrumentation (size_t) noexcept
+        {
+        }
+
+        std::uint32_t traceId () const noexcept
+        {
+            return 0;
+        }
+
+        /*!
+            @brief Records nothing.
+         */
+        class CScope
+        {
+        public:
+            template<typename... Args>
+            explicit CScope (const Args &...) noexcept
+            {
+            }
+
+            ~CScope () noexcept
+            {
+            }
+
+            void setCount (size_t) noexcept
+            {
+            }
+        };
+    };
+
+    /*!
+        @brief The calls are recorded in the trace of CListTrace.
+     */
+    class CTraceInstrumentation
+    {
+    public:
+        static const bool traced = true;
+
+    protected:
+        /*!
+            @brief  Records the construction of a CList whose elements are of @p valueSize bytes.
+         */
+        explicit CTraceInstrumentation (size_t valueSize) noexcept : m_traceId (CListTrace::open (valueSize))
+        {
+        }
+
+        // A CList keeps its number in the trace
+        CTraceInstrumentation &operator= (const CTraceInstrumentation &) noexcept
+        {
+            return *this;
+        }
+
+        std::uint32_t traceId () const noexcept
+        {
+            return m_traceId;
+        }
+
+        typedef CListTrace::CScope CScope;
+
+    private:
+        /*!
+            @var m_traceId
+            @brief The number of the CList in the trace.
+         */
+        std::uint32_t m_traceId;
+    };
+
+    /*!
+        @brief The allocation of the CList configured by default: from the node caches, unless CLIST_NO_NODE_CACHE
+               is defined (e.g. for memory checkers).
+     */
+#ifdef CLIST_NO_NODE_CACHE
+    typedef CSharedAllocation CDefaultAllocation;
+#else
+    typedef CCachedAllocation CDefaultAllocation;
+#endif
+
+    /*!
+        @brief The instrumentation of the CList configured by default: traced if CLIST_TRACE is defined.
+     */
+#ifdef CLIST_TRACE
+    typedef CTraceInstrumentation CDefaultInstrumentation;
+#else
+    typedef CNoInstrumentation CDefaultInstrumentation;
+#endif
+
+    /*!
+        @brief The policies of a CList, each chosen at compile time. A CList derives from its size, locking and
+               instrumentation policies, so that the empty ones take no room, and the calls to those which do
+               nothing are inlined away.
+
+               The default policies are the ones of CList<T>: counted size, node caches, no locking, and no
+               instrumentation unless CLIST_TRACE is defined. For instance, a CList shared by threads which
+               splices ranges often:
+               @code
+               CList<int, CListPolicy<CUncountedSize, CCachedAllocation, CMutexLocking>> shared;
+               @endcode
+
+               The linkage is not a policy: the algorithms of CList, its O(1) reverse and its bidirectional
+               iterators need both links, CForwardList is the list linked forward only.
+     */
+    template<class Size = CCountedSize, class Allocation = CDefaultAllocation, class Locking = CNoLocking,
+             class Instrumentation = CDefaultInstrumentation>
+    struct CListPolicy
+    {
+        /*!
+            @typedef size_policy
+            @brief CCountedSize or CUncountedSize.
+         */
+        typedef Size size_policy;
+
+        /*!
+            @typedef allocation_policy
+            @brief CCachedAllocation or CSharedAllocation.
+         */
+        typedef Allocation allocation_policy;
+
+        /*!
+            @typedef locking_policy
+            @brief CNoLocking or CMutexLocking.
+         */
+        typedef Locking locking_policy;
+
+        /*!
+            @typedef instrumentation_policy
+            @brief CNoInstrumentation or CTraceInstrumentation.
+         */
+        typedef Instrumentation instrumentation_policy;
+    };
+}
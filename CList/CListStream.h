@@ -0,0 +1,79 @@
+/*!
+@file CListStream.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CListStream class, the chunked binary format of CList::write_to and CList::read_from.
+
+Include it to call CList::write_to and CList::read_from: CList.h only declares them, so that its includers don't
+pull the threads and the buffers of the serialization.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "CList.h"
+#include "CSerializer.h"
+
+namespace nsSdD
+{
+    /*!
+        @brief CListStream writes and reads the chunks of a serialized CList, see CSerializer.
+     */
+    class CListStream
+    {
+    public:
+        /*!
+            @typedef sink_type
+            @brief Writes all the given bytes, returns false on error.
+         */
+        typedef std::function<bool (const char *, size_t)> sink_type;
+
+        /*!
+            @brief  Writes the stream header and the chunks of elements of @p list through @p sink.
+            @return bool If the whole list was written.
+         */
+        template<typename T, class Policy>
+        static bool write (const CList<T, Policy> &list, const sink_type &sink) noexcept;
+
+        /*!
+            @brief  Reads the stream header and the chunks of elements from @p source, and appends them to @p list.
+            @param[in] descriptor The file descriptor read by @p source, or -1, see CChunkReader.
+            @return bool If a whole list was read.
+         */
+        template<typename T, class Policy>
+        static bool read (CList<T, Policy> &list, const CChunkReader::source_type &source, int descriptor) noexcept;
+
+    private:
+        /*!
+            @brief  Return the magic string starting a serialized CList, of size @p magicSize.
+         */
+        static const char *magic () noexcept;
+
+        /*!
+            @brief The size of the magic string.
+         */
+        static constexpr size_t magicSize = 8;
+
+        /*!
+            @brief The target size of the content of a chunk.
+         */
+        static constexpr size_t chunkSize = 1 << 20;
+
+        /*!
+            @brief The largest content of a chunk, read back or written: a chunk goes over @p chunkSize by the size
+                   of its last element at most, which can't be larger than that.
+         */
+        static constexpr size_t maxChunkSize = 64 << 20;
+
+        /*!
+            @brief The size of the header of a chunk: its number of elements and its size in bytes.
+         */
+        static constexpr size_t chunkHeaderSize = 2 * sizeof (std::uint32_t);
+    };
+}
+
+#include "CListStream.hxx"
@@ -0,0 +1,180 @@
+/*!
+@file CListStream.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CListStream class and CList chunked binary serialization implementation.
+*/
+#pragma once
+
+#include <cerrno>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+#include <unistd.h>
+
+#include "CListStream.h"
+
+inline const char *nsSdD::CListStream::magic () noexcept
+{
+    return "CLSTRM01";
+}
+
+template<typename T, class Policy>
+bool nsSdD::CListStream::write (const CList<T, Policy> &list, const sink_type &sink) noexcept
+{
+    std::vector<char> chunk;
+    chunk.reserve (chunkHeaderSize + chunkSize);
+    CByteWriter writer (chunk);
+
+    writer.write (magic (), magicSize);
+    writer.write (static_cast<std::uint32_t> (CSerializer<T>::bulk));
+    writer.write (static_cast<std::uint32_t> (CSerializer<T>::bulk ? sizeof (T) : 0));
+    if (!sink (chunk.data (), chunk.size ()))
+        return false;
+
+    std::uint32_t count = 0;
+    chunk.assign (chunkHeaderSize, 0);
+
+    for (auto itr = list.cbegin ();; ++itr)
+    {
+        const bool last = itr == list.cend ();
+        if (!last)
+        {
+            CSerializer<T>::write (writer, *itr);
+            ++count;
+        }
+
+        if (count && (last || chunk.size () >= chunkHeaderSize + chunkSize))
+        {
+            // An element too large to be read back fails the write
+            if (chunk.size () - chunkHeaderSize > maxChunkSize)
+                return false;
+
+            std::uint32_t header[2] = {count, static_cast<std::uint32_t> (chunk.size () - chunkHeaderSize)};
+            std::memcpy (chunk.data (), header, sizeof (header));
+            if (!sink (chunk.data (), chunk.size ()))
+                return false;
+
+            count = 0;
+            chunk.resize (chunkHeaderSize);
+        }
+
+        if (last)
+            break;
+    }
+
+    std::uint32_t endOfList[2] = {0, 0};
+    return sink (reinterpret_cast<const char *> (endOfList), sizeof (endOfList));
+}
+
+template<typename T, class Policy>
+bool nsSdD::CListStream::read (CList<T, Policy> &list, const CChunkReader::source_type &source, int descriptor) noexcept
+{
+    char streamHeader[magicSize + 2 * sizeof (std::uint32_t)];
+    if (!CChunkReader::readAll (source, streamHeader, sizeof (streamHeader)))
+        return false;
+
+    std::uint32_t bulk, elementSize;
+    CByteReader headerReader (streamHeader + magicSize, 2 * sizeof (std::uint32_t));
+    headerReader.read (bulk);
+    headerReader.read (elementSize);
+
+    if (std::memcmp (streamHeader, magic (), magicSize) != 0
+        || bulk != CSerializer<T>::bulk
+        || elementSize != (CSerializer<T>::bulk ? sizeof (T) : 0))
+        return false;
+
+    CChunkReader reader (source, maxChunkSize, CSerializer<T>::bulk ? sizeof (T) : 0, descriptor);
+    std::vector<char> chunk;
+    std::uint32_t count;
+
+    while (reader.next (chunk, count))
+    {
+        if (CSerializer<T>::bulk)
+        {
+            // Raw values: the size is checked once for the chunk, whose buffer from operator new is aligned for T,
+            // then the whole chunk is linked at once, without copying the values aside.
+            if (chunk.size () != count * sizeof (T))
+                return false;
+
+            const T *values = reinterpret_cast<const T *> (chunk.data ());
+            list.insert (list.end (), values, values + count);
+        }
+        else
+        {
+            CByteReader in (chunk.data (), chunk.size ());
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                T value;
+                if (!CSerializer<T>::read (in, value))
+                    return false;
+                list.push_back (value);
+            }
+
+            if (in.remaining ())
+                return false;
+        }
+    }
+
+    return !reader.failed ();
+}
+
+template<typename T, class Policy>
+template<typename Serialized>
+bool nsSdD::CList<T, Policy>::write_to (std::ostream &out) const noexcept
+{
+    return CListStream::write (*this, [&out] (const char *data, size_t length)
+    {
+        return static_cast<bool> (out.write (data, length));
+    });
+}
+
+template<typename T, class Policy>
+template<typename Serialized>
+bool nsSdD::CList<T, Policy>::write_to (int fd) const noexcept
+{
+    return CListStream::write (*this, [fd] (const char *data, size_t length)
+    {
+        while (length)
+        {
+            ssize_t written = ::write (fd, data, length);
+            if (written < 0 && errno == EINTR)
+                continue;
+            if (written <= 0)
+                return false;
+
+            data += written;
+            length -= written;
+        }
+
+        return true;
+    });
+}
+
+template<typename T, class Policy>
+template<typename Serialized>
+bool nsSdD::CList<T, Policy>::read_from (std::istream &in) noexcept
+{
+    return CListStream::read (*this, [&in] (char *data, size_t length)
+    {
+        in.read (data, length);
+        return static_cast<size_t> (in.gcount ());
+    }, -1);
+}
+
+template<typename T, class Policy>
+template<typename Serialized>
+bool nsSdD::CList<T, Policy>::read_from (int fd) noexcept
+{
+    return CListStream::read (*this, [fd] (char *data, size_t length)
+    {
+        ssize_t read;
+        do
+            read = ::read (fd, data, length);
+        while (read < 0 && errno == EINTR);
+
+        return read > 0 ? static_cast<size_t> (read) : 0;
+    }, fd);
+}
@@ -0,0 +1,259 @@
+/*!
+@file CListTrace.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief The recorder of the calls to CList, replayed by CList_replay.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace nsSdD
+{
+    /*!
+        @brief CListTrace records the calls to the public functions of CList in a compact binary trace, so that
+               the access patterns of an application can be replayed against CList and other lists by
+               CList_replay.
+
+               The calls are recorded only by the CList whose instrumentation policy is CTraceInstrumentation, the
+               default when CLIST_TRACE is defined (the CLIST_TRACE option of CMake), see CListPolicy. A call made by another
+               public function, like the push_back of assign, is part of the outer call and not recorded.
+               Iterating over a CList is not recorded.
+
+               Each thread buffers its records and appends them to the trace file by chunks, and when it exits.
+               The file is the value of the environment variable CLIST_TRACE_FILE, or clist.trace, unless set
+               by @p setPath; it is truncated when the first chunk is written. The records of a chunk are
+               ordered by time, the chunks of different threads may not be.
+
+               The file starts with a header, then the records follow, in the byte order of the machine:
+               @code
+               char          magic[8]     "CLTRACE"
+               std::uint32_t version      1
+               std::uint32_t recordBytes  sizeof (CRecord)
+               CRecord       records[]
+               @endcode
+     */
+    class CListTrace
+    {
+    public:
+        /*!
+            @brief The recorded calls.
+         */
+        enum class EOperation : std::uint8_t
+        {
+            Construct, Destroy, Assign, PushFront, PushBack, PopFront, PopBack, Insert, Erase, Extract,
+            InsertNode, Front, Back, Swap, Resize, Clear, Remove, Unique, Dedup, Splice, Merge, Sort, Partition, NthElement,
+            PartialSort, Reverse, MaterializeReverse
+        };
+
+        /*!
+            @brief The number of operations.
+         */
+        static const std::size_t operationCount = std::size_t (EOperation::MaterializeReverse) + 1;
+
+        /*!
+            @brief Where a call inserted or removed an element.
+         */
+        enum class EPosition : std::uint8_t
+        {
+            None, Front, Back, Middle
+        };
+
+        /*!
+            @brief A recorded call.
+         */
+        struct CRecord
+        {
+            /*!
+                @var time
+                @brief The nanoseconds from the start of the recording to the call.
+             */
+            std::uint64_t time;
+
+            /*!
+                @var list
+                @brief The CList called, numbered from 1 in the order of their construction.
+             */
+            std::uint32_t list;
+
+            /*!
+                @var other
+                @brief The CList given to splice, merge and swap, 0 otherwise.
+             */
+            std::uint32_t other;
+
+            /*!
+                @var count
+                @brief The number of elements inserted, removed or moved, the new size of resize and assign.
+             */
+            std::uint32_t count;
+
+            /*!
+                @var valueSize
+                @brief The bytes of an element, saturated.
+             */
+            std::uint16_t valueSize;
+
+            /*!
+                @var operation
+                @brief The EOperation called.
+             */
+            std::uint8_t operation;
+
+            /*!
+                @var position
+                @brief The EPosition of the element inserted or removed.
+             */
+            std::uint8_t position;
+        };
+
+        /*!
+            @brief Records a call when it ends, unless it is made by another recorded call of the thread.
+         */
+        class CScope
+        {
+        public:
+            CScope (std::uint32_t list, EOperation operation, std::size_t valueSize, EPosition position = EPosition::None,
+                    std::size_t count = 0, std::uint32_t other = 0) noexcept;
+
+            ~CScope () noexcept;
+
+            CScope (const CScope &) = delete;
+
+            CScope &operator= (const CScope &) = delete;
+
+            /*!
+                @brief  Sets the count of the record, once known.
+             */
+            void setCount (std::size_t count) noexcept;
+
+        private:
+            CRecord m_record;
+
+            bool m_outermost;
+        };
+
+        /*!
+            @brief  Records the construction of a CList whose elements are of @p valueSize bytes.
+            @return The number of the CList in the trace.
+         */
+        static std::uint32_t open (std::size_t valueSize) noexcept;
+
+        /*!
+            @brief  Sets the file the next chunks are written to, truncated when the first one is.
+         */
+        static void setPath (const std::string &path) noexcept;
+
+        /*!
+            @brief  Appends the records buffered by the calling thread to the trace file.
+         */
+        static void flush () noexcept;
+
+        /*!
+            @brief  Reads the records of the trace file @p path into @p records.
+            @return False if the file can't be read or isn't a trace.
+         */
+        static bool read (const std::string &path, std::vector<CRecord> &records) noexcept;
+
+        /*!
+            @brief  Return the name of @p operation.
+         */
+        static const char *name (EOperation operation) noexcept;
+
+        CListTrace (const CListTrace &) = delete;
+
+        CListTrace &operator= (const CListTrace &) = delete;
+
+    private:
+        /*!
+            @brief The records of a thread not written yet.
+         */
+        struct CBuffer
+        {
+            CBuffer () noexcept;
+
+            ~CBuffer () noexcept;
+
+            std::vector<CRecord> records;
+        };
+
+        /*!
+            @brief The number of records of a chunk.
+         */
+        static const std::size_t chunkRecords = 4096;
+
+        CListTrace () noexcept;
+
+        static CListTrace &instance () noexcept;
+
+        /*!
+            @brief  Return the buffer of the calling thread, nullptr once the thread released it.
+         */
+        static CBuffer *buffer () noexcept;
+
+        /*!
+            @brief  Return true once the buffer of the calling thread was released.
+         */
+        static bool &released () noexcept;
+
+        /*!
+            @brief  Return the number of recorded calls in progress in the calling thread.
+         */
+        static std::size_t &depth () noexcept;
+
+        /*!
+            @brief  Return the nanoseconds since the start of the recording.
+         */
+        std::uint64_t now () const noexcept;
+
+        /*!
+            @brief  Appends a record to the buffer of the calling thread, written once full.
+         */
+        static void append (const CRecord &record) noexcept;
+
+        /*!
+            @brief  Writes @p count records to the trace file, opened if needed.
+         */
+        void write (const CRecord *records, std::size_t count) noexcept;
+
+        /*!
+            @var m_lists
+            @brief The number of CList constructed.
+         */
+        std::atomic<std::uint32_t> m_lists;
+
+        /*!
+            @var m_start
+            @brief The start of the recording, in nanoseconds of the steady clock.
+         */
+        const std::int64_t m_start;
+
+        /*!
+            @var m_mutex
+            @brief Protects the fields below.
+         */
+        std::mutex m_mutex;
+
+        /*!
+            @var m_path
+            @brief The path of the trace file.
+         */
+        std::string m_path;
+
+        /*!
+            @var m_file
+            @brief The trace file, nullptr until the first chunk, or if it can't be opened.
+         */
+        std::FILE *m_file = nullptr;
+    };
+}
+
+#include "CListTrace.hxx"
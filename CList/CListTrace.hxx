@@ -0,0 +1,211 @@
+/*!
+@file CListTrace.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CListTrace class implementation.
+*/
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include "CListTrace.h"
+
+namespace nsSdD
+{
+    namespace nsTrace
+    {
+        const char magic[8] = "CLTRACE";
+
+        const std::uint32_t version = 1;
+
+        static_assert (sizeof (CListTrace::CRecord) == 24, "The records of a trace are of 24 bytes");
+    }
+}
+
+inline nsSdD::CListTrace::CScope::CScope (std::uint32_t list, EOperation operation, std::size_t valueSize,
+                                          EPosition position /*= EPosition::None*/, std::size_t count /*= 0*/,
+                                          std::uint32_t other /*= 0*/) noexcept
+        : m_outermost (depth ()++ == 0)
+{
+    if (!m_outermost)
+        return;
+
+    m_record.time = instance ().now ();
+    m_record.list = list;
+    m_record.other = other;
+    m_record.count = std::uint32_t (count);
+    m_record.valueSize = std::uint16_t (std::min<std::size_t> (valueSize, UINT16_MAX));
+    m_record.operation = std::uint8_t (operation);
+    m_record.position = std::uint8_t (position);
+}
+
+inline nsSdD::CListTrace::CScope::~CScope () noexcept
+{
+    --depth ();
+    if (m_outermost)
+        append (m_record);
+}
+
+inline void nsSdD::CListTrace::CScope::setCount (std::size_t count) noexcept
+{
+    m_record.count = std::uint32_t (count);
+}
+
+inline nsSdD::CListTrace::CBuffer::CBuffer () noexcept
+{
+    records.reserve (chunkRecords);
+}
+
+inline nsSdD::CListTrace::CBuffer::~CBuffer () noexcept
+{
+    instance ().write (records.data (), records.size ());
+    released () = true;
+}
+
+inline nsSdD::CListTrace::CListTrace () noexcept
+        : m_lists (0),
+          m_start (std::chrono::duration_cast<std::chrono::nanoseconds> (
+                  std::chrono::steady_clock::now ().time_since_epoch ()).count ())
+{
+    const char *path = std::getenv ("CLIST_TRACE_FILE");
+    m_path = path ? path : "clist.trace";
+}
+
+inline nsSdD::CListTrace &nsSdD::CListTrace::instance () noexcept
+{
+    // Never destroyed: the threads write their last records when they exit, after the static objects of the main
+    // thread may have been destroyed.
+    static CListTrace *trace = new CListTrace ();
+    return *trace;
+}
+
+inline bool &nsSdD::CListTrace::released () noexcept
+{
+    // Trivially destructible, so still valid after the buffer of the thread
+    static thread_local bool released = false;
+    return released;
+}
+
+inline nsSdD::CListTrace::CBuffer *nsSdD::CListTrace::buffer () noexcept
+{
+    if (released ())
+        return nullptr;
+
+    static thread_local CBuffer buffer;
+    return &buffer;
+}
+
+inline std::size_t &nsSdD::CListTrace::depth () noexcept
+{
+    static thread_local std::size_t depth = 0;
+    return depth;
+}
+
+inline std::uint64_t nsSdD::CListTrace::now () const noexcept
+{
+    return std::uint64_t (std::chrono::duration_cast<std::chrono::nanoseconds> (
+            std::chrono::steady_clock::now ().time_since_epoch ()).count () - m_start);
+}
+
+inline std::uint32_t nsSdD::CListTrace::open (std::size_t valueSize) noexcept
+{
+    std::uint32_t list = instance ().m_lists.fetch_add (1, std::memory_order_relaxed) + 1;
+
+    // The lists of the other calls, like the runs of sort, are not recorded with them
+    CScope scope (list, EOperation::Construct, valueSize);
+
+    return list;
+}
+
+inline void nsSdD::CListTrace::setPath (const std::string &path) noexcept
+{
+    CListTrace &trace = instance ();
+    std::lock_guard<std::mutex> lock (trace.m_mutex);
+
+    if (trace.m_file)
+        std::fclose (trace.m_file);
+
+    trace.m_file = nullptr;
+    trace.m_path = path;
+}
+
+inline void nsSdD::CListTrace::flush () noexcept
+{
+    CBuffer *records = buffer ();
+    if (!records)
+        return;
+
+    instance ().write (records->records.data (), records->records.size ());
+    records->records.clear ();
+}
+
+inline void nsSdD::CListTrace::append (const CRecord &record) noexcept
+{
+    CBuffer *records = buffer ();
+    if (!records)
+        return;
+
+    records->records.push_back (record);
+    if (records->records.size () == chunkRecords)
+        flush ();
+}
+
+inline void nsSdD::CListTrace::write (const CRecord *records, std::size_t count) noexcept
+{
+    if (count == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    if (!m_file)
+    {
+        m_file = std::fopen (m_path.c_str (), "wb");
+        if (!m_file)
+            return;
+
+        std::uint32_t recordBytes = sizeof (CRecord);
+        std::fwrite (nsTrace::magic, sizeof (nsTrace::magic), 1, m_file);
+        std::fwrite (&nsTrace::version, sizeof (nsTrace::version), 1, m_file);
+        std::fwrite (&recordBytes, sizeof (recordBytes), 1, m_file);
+    }
+
+    // Flushed, so that the trace of a process which crashes keeps its last chunks
+    std::fwrite (records, sizeof (CRecord), count, m_file);
+    std::fflush (m_file);
+}
+
+inline bool nsSdD::CListTrace::read (const std::string &path, std::vector<CRecord> &records) noexcept
+{
+    std::ifstream file (path, std::ios::binary);
+
+    char magic[sizeof (nsTrace::magic)];
+    std::uint32_t version = 0, recordBytes = 0;
+    if (!file.read (magic, sizeof (magic)) || std::memcmp (magic, nsTrace::magic, sizeof (magic)) != 0
+        || !file.read (reinterpret_cast<char *> (&version), sizeof (version)) || version != nsTrace::version
+        || !file.read (reinterpret_cast<char *> (&recordBytes), sizeof (recordBytes)) || recordBytes != sizeof (CRecord))
+        return false;
+
+    CRecord record;
+    records.clear ();
+    while (file.read (reinterpret_cast<char *> (&record), sizeof (record)))
+        records.push_back (record);
+
+    // A record cut by a crash is dropped
+    return file.eof ();
+}
+
+inline const char *nsSdD::CListTrace::name (EOperation operation) noexcept
+{
+    static const char *const names[operationCount] =
+            { "construct", "destroy", "assign", "push_front", "push_back", "pop_front", "pop_back", "insert",
+              "erase", "extract", "insert_node", "front", "back", "swap", "resize", "clear", "remove", "unique",
+              "dedup", "splice", "merge", "sort", "partition", "nth_element", "partial_sort", "reverse",
+              "materialize_reverse" };
+
+    return std::size_t (operation) < operationCount ? names[std::size_t (operation)] : "unknown";
+}
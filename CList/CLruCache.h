@@ -0,0 +1,268 @@
+/*!
+@file CLruCache.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CLruCache class.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include "CList.h"
+
+namespace nsSdD
+{
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    /*!
+       @brief CLruCache is a bounded cache evicting its least recently used entries.
+              Entries live in a CList ordered from the most to the least recently used, and a hash index
+              goes from a key to its node. A hit moves the node to the front by relinking it, so it neither
+              copies nor allocates anything; evictions are taken from the back.
+              The capacity is either a number of entries, or a total weight (e.g. bytes) when a weigher is given.
+    */
+    class CLruCache
+    {
+    public:
+        /*!
+            @typedef size_type
+            @brief This define a @p size_t, used for capacities and weights.
+         */
+        typedef size_t size_type;
+
+        /*!
+            @typedef weigher_type
+            @brief The functor giving the weight of an entry.
+         */
+        typedef std::function<size_type (const Key &, const Value &)> weigher_type;
+
+        /*!
+            @typedef eviction_callback
+            @brief The functor called on each entry evicted by the cache.
+         */
+        typedef std::function<void (const Key &, Value &)> eviction_callback;
+
+    private:
+        /*!
+            @brief An entry of the cache, its weight is kept so that evicting it does not call the weigher again.
+         */
+        struct CEntry
+        {
+            Key key;
+            Value value;
+            size_type weight;
+
+            explicit CEntry (const Key &k = Key (), const Value &v = Value (), size_type w = 0) noexcept
+                    : key (k), value (v), weight (w)
+            {
+            }
+        };
+
+        typedef typename CList<CEntry>::iterator CEntryIterator;
+
+    public:
+        /*!
+            @typedef const_iterator
+            @brief Iterates over the entries, from the most to the least recently used.
+         */
+        typedef typename CList<CEntry>::const_iterator const_iterator;
+
+        /*!
+            @brief  This is the constructor of a CLruCache holding at most @p capacity entries.
+            @param[in] capacity The maximum number of entries.
+         */
+        explicit CLruCache (size_type capacity) noexcept;
+
+        /*!
+            @brief  This is the constructor of a CLruCache holding entries for a total weight of at most @p capacity.
+            @param[in] capacity The maximum total weight of the entries.
+            @param[in] weigher The functor giving the weight of an entry.
+         */
+        CLruCache (size_type capacity, weigher_type weigher) noexcept;
+
+        /*!
+            @brief  This is the copy-constructor of the class CLruCache, the index is rebuilt on the copied entries.
+            @param[in] x The CLruCache we want to copy.
+         */
+        CLruCache (const CLruCache &x) noexcept;
+
+        /*!
+            @brief Assigning would keep iterators into the entries of @p x in the index, hence it is forbidden.
+         */
+        CLruCache &operator= (const CLruCache &) = delete;
+
+        /*!
+            @brief  Sets the functor called on each evicted entry, before it is destroyed.
+            @param[in] callback The eviction callback, may be empty.
+         */
+        void setEvictionCallback (eviction_callback callback) noexcept;
+
+        /*!
+            @brief  Looks up @p key and marks the entry as the most recently used. Counts a hit or a miss.
+            @param[in] key The key we are looking for.
+            @return A pointer to the cached value, or nullptr on a miss.
+                    It stays valid until the entry is evicted or erased.
+         */
+        Value *find (const Key &key) noexcept;
+
+        /*!
+            @brief  Looks up @p key without changing the recency of the entry nor the counters.
+            @param[in] key The key we are looking for.
+            @return A pointer to the cached value, or nullptr if the key is not cached.
+         */
+        const Value *peek (const Key &key) const noexcept;
+
+        /*!
+            @brief  Return true if @p key is cached, without changing the recency of the entry nor the counters.
+            @param[in] key The key we are looking for.
+         */
+        bool contains (const Key &key) const noexcept;
+
+        /*!
+            @brief  Inserts or updates the entry of @p key, marks it as the most recently used and
+                    evicts the least recently used entries until the cache fits its capacity again.
+            @param[in] key The key of the entry.
+            @param[in] value The value we want to cache.
+         */
+        void put (const Key &key, const Value &value) noexcept;
+
+        /*!
+            @brief  Removes the entry of @p key, the eviction callback is not called.
+            @param[in] key The key of the entry we want to remove.
+            @return bool If an entry was removed.
+         */
+        bool erase (const Key &key) noexcept;
+
+        /*!
+            @brief  Removes all the entries, the eviction callback is not called.
+         */
+        void clear () noexcept;
+
+        /*!
+            @brief  Changes the capacity of the cache, evicting entries if needed.
+            @param[in] capacity The new capacity.
+         */
+        void setCapacity (size_type capacity) noexcept;
+
+        /*!
+            @brief  Return the capacity of the cache, in entries or in weight.
+         */
+        size_type capacity () const noexcept;
+
+        /*!
+            @brief  Return the current weight of the cache, its size when no weigher was given.
+         */
+        size_type weight () const noexcept;
+
+        /*!
+            @brief  Return the number of cached entries.
+         */
+        size_type size () const noexcept;
+
+        /*!
+            @brief  Return true if the cache is empty, false otherwise.
+         */
+        bool empty () const noexcept;
+
+        /*!
+            @brief  Return a const_iterator to the most recently used entry.
+         */
+        const_iterator cbegin () const noexcept;
+
+        /*!
+            @brief  Return a const_iterator past the least recently used entry.
+         */
+        const_iterator cend () const noexcept;
+
+        // Counters
+        /*!
+            @brief  Return the number of successful calls to @p find.
+         */
+        std::uint64_t hits () const noexcept;
+
+        /*!
+            @brief  Return the number of unsuccessful calls to @p find.
+         */
+        std::uint64_t misses () const noexcept;
+
+        /*!
+            @brief  Return the number of entries evicted to respect the capacity.
+         */
+        std::uint64_t evictions () const noexcept;
+
+        /*!
+            @brief  Resets the hits, misses and evictions counters.
+         */
+        void resetCounters () noexcept;
+
+    private:
+        /*!
+            @brief  Evicts the least recently used entries until the cache fits its capacity.
+         */
+        void shrink () noexcept;
+
+        /*!
+            @brief  Rebuilds the whole index from the entries.
+         */
+        void reindex () noexcept;
+
+        /*!
+            @var m_capacity
+            @brief The maximum number of entries, or total weight.
+         */
+        size_type m_capacity;
+
+        /*!
+            @var m_weight
+            @brief The current total weight of the entries.
+         */
+        size_type m_weight = 0;
+
+        /*!
+            @var m_weigher
+            @brief The functor giving the weight of an entry, empty when the capacity is counted in entries.
+         */
+        weigher_type m_weigher;
+
+        /*!
+            @var m_onEviction
+            @brief The functor called on each evicted entry.
+         */
+        eviction_callback m_onEviction;
+
+        /*!
+            @var m_entries
+            @brief The entries, from the most to the least recently used.
+         */
+        CList<CEntry> m_entries;
+
+        /*!
+            @var m_index
+            @brief The hash index going from a key to its entry.
+         */
+        std::unordered_map<Key, CEntryIterator, Hash> m_index;
+
+        /*!
+            @var m_hits
+            @brief The number of successful lookups.
+         */
+        std::uint64_t m_hits = 0;
+
+        /*!
+            @var m_misses
+            @brief The number of unsuccessful lookups.
+         */
+        std::uint64_t m_misses = 0;
+
+        /*!
+            @var m_evictions
+            @brief The number of evicted entries.
+         */
+        std::uint64_t m_evictions = 0;
+    };
+}
+
+#include "CLruCache.hxx"
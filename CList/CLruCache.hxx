@@ -0,0 +1,216 @@
+/*!
+@file CLruCache.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CLruCache class implementation.
+*/
+#pragma once
+
+#include "CLruCache.h"
+
+template<typename Key, typename Value, typename Hash>
+nsSdD::CLruCache<Key, Value, Hash>::CLruCache (size_type capacity) noexcept
+        : m_capacity (capacity)
+{
+}
+
+template<typename Key, typename Value, typename Hash>
+nsSdD::CLruCache<Key, Value, Hash>::CLruCache (size_type capacity, weigher_type weigher) noexcept
+        : m_capacity (capacity),
+          m_weigher (weigher)
+{
+}
+
+template<typename Key, typename Value, typename Hash>
+nsSdD::CLruCache<Key, Value, Hash>::CLruCache (const CLruCache &x) noexcept
+        : m_capacity (x.m_capacity),
+          m_weight (x.m_weight),
+          m_weigher (x.m_weigher),
+          m_onEviction (x.m_onEviction),
+          m_entries (x.m_entries),
+          m_index (x.m_index.bucket_count (), x.m_index.hash_function ()),
+          m_hits (x.m_hits),
+          m_misses (x.m_misses),
+          m_evictions (x.m_evictions)
+{
+    reindex ();
+}
+
+template<typename Key, typename Value, typename Hash>
+void nsSdD::CLruCache<Key, Value, Hash>::setEvictionCallback (eviction_callback callback) noexcept
+{
+    m_onEviction = callback;
+}
+
+template<typename Key, typename Value, typename Hash>
+Value *nsSdD::CLruCache<Key, Value, Hash>::find (const Key &key) noexcept
+{
+    auto found = m_index.find (key);
+    if (found == m_index.end ())
+    {
+        ++m_misses;
+        return nullptr;
+    }
+
+    ++m_hits;
+    m_entries.splice (m_entries.begin (), m_entries, found->second);
+
+    return &found->second->value;
+}
+
+template<typename Key, typename Value, typename Hash>
+const Value *nsSdD::CLruCache<Key, Value, Hash>::peek (const Key &key) const noexcept
+{
+    auto found = m_index.find (key);
+
+    return found == m_index.end () ? nullptr : &(*found->second).value;
+}
+
+template<typename Key, typename Value, typename Hash>
+bool nsSdD::CLruCache<Key, Value, Hash>::contains (const Key &key) const noexcept
+{
+    return m_index.count (key) != 0;
+}
+
+template<typename Key, typename Value, typename Hash>
+void nsSdD::CLruCache<Key, Value, Hash>::put (const Key &key, const Value &value) noexcept
+{
+    size_type weight = m_weigher ? m_weigher (key, value) : 1;
+
+    auto found = m_index.find (key);
+    if (found != m_index.end ())
+    {
+        CEntryIterator entry = found->second;
+        m_weight = m_weight - entry->weight + weight;
+        entry->value = value;
+        entry->weight = weight;
+
+        m_entries.splice (m_entries.begin (), m_entries, entry);
+    }
+    else
+    {
+        m_entries.push_front (CEntry (key, value, weight));
+        m_index.emplace (key, m_entries.begin ());
+        m_weight += weight;
+    }
+
+    shrink ();
+}
+
+template<typename Key, typename Value, typename Hash>
+bool nsSdD::CLruCache<Key, Value, Hash>::erase (const Key &key) noexcept
+{
+    auto found = m_index.find (key);
+    if (found == m_index.end ())
+        return false;
+
+    m_weight -= found->second->weight;
+    m_entries.erase (found->second);
+    m_index.erase (found);
+
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash>
+void nsSdD::CLruCache<Key, Value, Hash>::clear () noexcept
+{
+    m_index.clear ();
+    m_entries.clear ();
+    m_weight = 0;
+}
+
+template<typename Key, typename Value, typename Hash>
+void nsSdD::CLruCache<Key, Value, Hash>::setCapacity (size_type capacity) noexcept
+{
+    m_capacity = capacity;
+    shrink ();
+}
+
+template<typename Key, typename Value, typename Hash>
+typename nsSdD::CLruCache<Key, Value, Hash>::size_type nsSdD::CLruCache<Key, Value, Hash>::capacity () const noexcept
+{
+    return m_capacity;
+}
+
+template<typename Key, typename Value, typename Hash>
+typename nsSdD::CLruCache<Key, Value, Hash>::size_type nsSdD::CLruCache<Key, Value, Hash>::weight () const noexcept
+{
+    return m_weight;
+}
+
+template<typename Key, typename Value, typename Hash>
+typename nsSdD::CLruCache<Key, Value, Hash>::size_type nsSdD::CLruCache<Key, Value, Hash>::size () const noexcept
+{
+    return m_entries.size ();
+}
+
+template<typename Key, typename Value, typename Hash>
+bool nsSdD::CLruCache<Key, Value, Hash>::empty () const noexcept
+{
+    return m_entries.empty ();
+}
+
+template<typename Key, typename Value, typename Hash>
+typename nsSdD::CLruCache<Key, Value, Hash>::const_iterator nsSdD::CLruCache<Key, Value, Hash>::cbegin () const noexcept
+{
+    return m_entries.cbegin ();
+}
+
+template<typename Key, typename Value, typename Hash>
+typename nsSdD::CLruCache<Key, Value, Hash>::const_iterator nsSdD::CLruCache<Key, Value, Hash>::cend () const noexcept
+{
+    return m_entries.cend ();
+}
+
+template<typename Key, typename Value, typename Hash>
+std::uint64_t nsSdD::CLruCache<Key, Value, Hash>::hits () const noexcept
+{
+    return m_hits;
+}
+
+template<typename Key, typename Value, typename Hash>
+std::uint64_t nsSdD::CLruCache<Key, Value, Hash>::misses () const noexcept
+{
+    return m_misses;
+}
+
+template<typename Key, typename Value, typename Hash>
+std::uint64_t nsSdD::CLruCache<Key, Value, Hash>::evictions () const noexcept
+{
+    return m_evictions;
+}
+
+template<typename Key, typename Value, typename Hash>
+void nsSdD::CLruCache<Key, Value, Hash>::resetCounters () noexcept
+{
+    m_hits = m_misses = m_evictions = 0;
+}
+
+template<typename Key, typename Value, typename Hash>
+void nsSdD::CLruCache<Key, Value, Hash>::shrink () noexcept
+{
+    while (m_weight > m_capacity && !m_entries.empty ())
+    {
+        CEntryIterator victim = --m_entries.end ();
+
+        if (m_onEviction)
+            m_onEviction (victim->key, victim->value);
+
+        m_weight -= victim->weight;
+        m_index.erase (victim->key);
+        m_entries.erase (victim);
+        ++m_evictions;
+    }
+}
+
+template<typename Key, typename Value, typename Hash>
+void nsSdD::CLruCache<Key, Value, Hash>::reindex () noexcept
+{
+    // The index of a copied cache points into the source entries: every iterator is recomputed.
+    m_index.clear ();
+    m_index.reserve (m_entries.size ());
+
+    for (CEntryIterator entry = m_entries.begin (); entry != m_entries.end (); ++entry)
+        m_index.emplace (entry->key, entry);
+}
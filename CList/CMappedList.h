@@ -0,0 +1,331 @@
+/*!
+@file CMappedList.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CMappedList class.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+#include "CList.h"
+
+namespace nsSdD
+{
+    template<typename T>
+    /*!
+       @brief CMappedList is a list of trivially copyable values stored in a file that is mapped in memory.
+              The nodes are laid out in the file with links stored as offsets from the start of the file,
+              so that once mapped, the list is traversed in place without any deserialization: opening
+              a file of any size only validates its header, the whole file is read only when asked to verify
+              its checksum. Every link is checked against the mapping before being followed, so that a
+              corrupted file never makes the traversal read outside of the mapping. Other corruptions, such as
+              links forming a cycle, are only detected by verifying the checksum when opening the file.
+
+              A file is either mapped read-only, or copy-on-write: the pages touched by mutations are then
+              private to the process and the file is never modified; @p save writes the result to a new file.
+              Since a mapping can't grow, insertions reuse the slots of erased nodes and the spare slots
+              reserved when the file was written.
+    */
+    class CMappedList
+    {
+        static_assert (std::is_trivially_copyable<T>::value, "CMappedList only stores trivially copyable types");
+
+        // Types
+    private:
+        struct CIterator;
+
+        struct CConstIterator;
+
+        /*!
+            @brief The header at the start of the file.
+         */
+        struct CHeader
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t nodeSize;
+            std::uint64_t size;
+            std::uint64_t capacity;
+            std::uint64_t head;
+            std::uint64_t tail;
+            std::uint64_t freeList;
+            std::uint64_t checksum;
+        };
+
+        /*!
+            @brief A node of the file. A link is the offset of a node from the start of the file, 0 being none.
+         */
+        struct CMappedNode
+        {
+            std::uint64_t next;
+            std::uint64_t previous;
+            T info;
+        };
+
+    public:
+        /*!
+            @typedef size_type
+            @brief This define a @p size_t.
+         */
+        typedef size_t size_type;
+
+        /*!
+            @typedef iterator
+            @brief Iterator giving write access to the values, only given in CopyOnWrite mode.
+         */
+        typedef CIterator iterator;
+
+        /*!
+            @typedef const_iterator
+            @brief Iterator giving read access to the values.
+         */
+        typedef CConstIterator const_iterator;
+
+        /*!
+            @brief The ways a file can be mapped.
+         */
+        enum EMode
+        {
+            ReadOnly,   /*!< The mapping is shared with the file and can't be modified. */
+            CopyOnWrite /*!< The mapping can be modified, modifications are private to the process. */
+        };
+
+        /*!
+            @brief  Writes the elements from @p first to @p last in a new file at @p path, in order and contiguously.
+            @param[in] first The first element to write.
+            @param[in] last The element following the last one to write.
+            @param[in] path The path of the file, replaced if it exists.
+            @param[in] spare The number of free slots reserved for insertions in CopyOnWrite mode.
+            @return bool If the file was written.
+         */
+        template<class ForwardIterator>
+        static bool write (ForwardIterator first, ForwardIterator last, const std::string &path, size_type spare = 0) noexcept;
+
+        /*!
+            @brief  Writes the CList @p list in a new file at @p path.
+            @param[in] list The CList we want to persist.
+            @param[in] path The path of the file, replaced if it exists.
+            @param[in] spare The number of free slots reserved for insertions in CopyOnWrite mode.
+            @return bool If the file was written.
+         */
+        static bool write (const CList<T> &list, const std::string &path, size_type spare = 0) noexcept;
+
+        /*!
+            @brief This is the default constructor, the CMappedList is not opened.
+         */
+        CMappedList () noexcept;
+
+        /*!
+            @brief A mapping has a single owner, hence it can't be copied.
+         */
+        CMappedList (const CMappedList &) = delete;
+
+        /*!
+            @brief A mapping has a single owner, hence it can't be copied.
+         */
+        CMappedList &operator= (const CMappedList &) = delete;
+
+        /*!
+            @brief The destructor unmaps the file.
+         */
+        ~CMappedList () noexcept;
+
+        /*!
+            @brief  Maps the file at @p path, after checking its header and, if @p verify, its checksum.
+            @param[in] path The path of a file written by @p write or @p save.
+            @param[in] mode How the file is mapped.
+            @param[in] verify If the checksum of the whole file is checked, which reads all of it.
+                              Without it, opening is O(1) and a corrupted value is not detected.
+            @return bool If the file is mapped.
+         */
+        bool open (const std::string &path, EMode mode = ReadOnly, bool verify = false) noexcept;
+
+        /*!
+            @brief  Unmaps the file, all modifications made in CopyOnWrite mode are lost.
+         */
+        void close () noexcept;
+
+        /*!
+            @brief  Return true if a file is mapped, false otherwise.
+         */
+        bool isOpen () const noexcept;
+
+        /*!
+            @brief  Writes the current content of the CMappedList in a new file at @p path, compacted.
+            @param[in] path The path of the file, which must not be the mapped one.
+            @param[in] spare The number of free slots reserved for insertions in CopyOnWrite mode.
+            @return bool If the file was written.
+         */
+        bool save (const std::string &path, size_type spare = 0) const noexcept;
+
+        /*!
+            @brief  Copies the content of the CMappedList in a CList.
+         */
+        CList<T> toList () const noexcept;
+
+        // iterators
+        /*!
+            @brief  This function return an iterator to the begin, or end () in ReadOnly mode: the pages of
+                    the mapping can't be written, use cbegin instead.
+         */
+        iterator begin () noexcept;
+
+        /*!
+            @brief  This function return an iterator to the end.
+         */
+        iterator end () noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the begin.
+         */
+        const_iterator begin () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the end.
+         */
+        const_iterator end () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the begin.
+         */
+        const_iterator cbegin () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the end.
+         */
+        const_iterator cend () const noexcept;
+
+        // Capacity
+        /*!
+            @brief  This function return true if the CMappedList is empty or not opened, false otherwise.
+         */
+        bool empty () const noexcept;
+
+        /*!
+            @brief  This function return the number of elements.
+         */
+        size_type size () const noexcept;
+
+        /*!
+            @brief  This function return the number of elements that can be inserted before the mapping is full.
+         */
+        size_type available () const noexcept;
+
+        // Element access
+        /*!
+            @brief  This function return value of the first element.
+         */
+        T front () const noexcept;
+
+        /*!
+            @brief  This function return value of the last element.
+         */
+        T back () const noexcept;
+
+        // Modifiers, CopyOnWrite mode only
+        /*!
+            @brief  Inserts @p val before @p position in a free slot.
+            @param[in] position The position where you want to insert the new element.
+            @param[in] val The value we want to insert.
+            @return An iterator to the new element, or end () if the mapping is read-only or full.
+         */
+        iterator insert (iterator position, const T &val) noexcept;
+
+        /*!
+            @brief  Adds @p x at the end in a free slot.
+            @return bool If @p x was added, false if the mapping is read-only or full.
+         */
+        bool push_back (const T &x) noexcept;
+
+        /*!
+            @brief  Adds @p x at the beginning in a free slot.
+            @return bool If @p x was added, false if the mapping is read-only or full.
+         */
+        bool push_front (const T &x) noexcept;
+
+        /*!
+            @brief  Erases the element pointed by @p position, its slot becomes free.
+            @param[in] position An iterator to the element we want to erase.
+            @return iterator The element that followed the erased element.
+         */
+        iterator erase (iterator position) noexcept;
+
+        /*!
+            @brief  Erases the first element.
+         */
+        void pop_front () noexcept;
+
+        /*!
+            @brief  Erases the last element.
+         */
+        void pop_back () noexcept;
+
+    private:
+        /*!
+            @brief The version of the file format.
+         */
+        static constexpr std::uint32_t version = 1;
+
+        /*!
+            @brief  Return the magic string starting a CMappedList file, of the size of CHeader::magic.
+         */
+        static const char *magic () noexcept;
+
+        /*!
+            @brief  Return the offset of the first node in the file.
+         */
+        static constexpr std::uint64_t firstNodeOffset () noexcept;
+
+        /*!
+            @brief  Return true if @p offset is 0 or the offset of a node of the mapping at @p base.
+         */
+        static bool isLink (const char *base, std::uint64_t offset) noexcept;
+
+        /*!
+            @brief  Hashes @p length bytes at @p data, starting from @p hash to chain the calls.
+         */
+        static std::uint64_t hashBytes (const char *data, std::uint64_t length, std::uint64_t hash = 0xcbf29ce484222325) noexcept;
+
+        /*!
+            @brief  Return the checksum of the @p length bytes of file at @p base: its nodes, then its header
+                    without the checksum field.
+         */
+        static std::uint64_t checksum (const char *base, std::uint64_t length) noexcept;
+
+        /*!
+            @brief  Return the header of the mapping.
+         */
+        CHeader *header () const noexcept;
+
+        /*!
+            @brief  Return the node at @p offset in the mapping.
+         */
+        CMappedNode *node (std::uint64_t offset) const noexcept;
+
+        /*!
+          @var     m_base
+          @brief  The start of the mapping, nullptr if not opened.
+       */
+        char *m_base = nullptr;
+
+        /*!
+          @var     m_length
+          @brief  The length of the mapping.
+       */
+        std::uint64_t m_length = 0;
+
+        /*!
+          @var     m_mode
+          @brief  The mode of the mapping.
+       */
+        EMode m_mode = ReadOnly;
+    };
+}
+
+#include "CMappedList.hxx"
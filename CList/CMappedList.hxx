@@ -0,0 +1,557 @@
+/*!
+@file CMappedList.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CMappedList class and iterators implementation.
+*/
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CMappedList.h"
+
+/*!
+    @brief Bidirectional iterator of CMappedList, follows the offsets stored in the mapped nodes.
+           An invalid offset is followed to the end.
+ */
+template<typename T>
+struct nsSdD::CMappedList<T>::CIterator : public CIterBase<T>
+{
+private:
+    /*!
+        @var base
+        @brief The start of the mapping.
+    */
+    char *base;
+
+    /*!
+        @var offset
+        @brief The offset of the current node, 0 for end.
+    */
+    std::uint64_t offset;
+
+public:
+    CIterator (char *b = nullptr, std::uint64_t o = 0) noexcept : base (b), offset (o)
+    {
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return offset == other.offset;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return offset != other.offset;
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        offset = follow (node ()->next);
+        return *this;
+    }
+
+    CIterator &operator-- () noexcept
+    {
+        offset = follow (offset ? node ()->previous : reinterpret_cast<CHeader *> (base)->tail);
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    CIterator operator-- (int) noexcept
+    {
+        CIterator temp = *this;
+        --*this;
+        return temp;
+    }
+
+    T *operator-> () const noexcept
+    {
+        return &node ()->info;
+    }
+
+    T &operator* () const noexcept
+    {
+        return node ()->info;
+    }
+
+    /*!
+      @brief The function return the offset of the node, 0 for end.
+   */
+    std::uint64_t getOffset () const noexcept
+    {
+        return offset;
+    }
+
+private:
+    CMappedNode *node () const noexcept
+    {
+        return reinterpret_cast<CMappedNode *> (base + offset);
+    }
+
+    std::uint64_t follow (std::uint64_t link) const noexcept
+    {
+        return isLink (base, link) ? link : 0;
+    }
+};
+
+/*!
+    @brief Sister const class to CIterator
+ */
+template<typename T>
+struct nsSdD::CMappedList<T>::CConstIterator : public CConstIterBase<T>
+{
+private:
+    /*!
+        @var base
+        @brief The start of the mapping.
+    */
+    const char *base;
+
+    /*!
+        @var offset
+        @brief The offset of the current node, 0 for end.
+    */
+    std::uint64_t offset;
+
+public:
+    CConstIterator (const char *b = nullptr, std::uint64_t o = 0) noexcept : base (b), offset (o)
+    {
+    }
+
+    bool operator== (const CConstIterator &other) const noexcept
+    {
+        return offset == other.offset;
+    }
+
+    bool operator!= (const CConstIterator &other) const noexcept
+    {
+        return offset != other.offset;
+    }
+
+    CConstIterator &operator++ () noexcept
+    {
+        offset = follow (node ()->next);
+        return *this;
+    }
+
+    CConstIterator &operator-- () noexcept
+    {
+        offset = follow (offset ? node ()->previous : reinterpret_cast<const CHeader *> (base)->tail);
+        return *this;
+    }
+
+    CConstIterator operator++ (int) noexcept
+    {
+        CConstIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    CConstIterator operator-- (int) noexcept
+    {
+        CConstIterator temp = *this;
+        --*this;
+        return temp;
+    }
+
+    const T *operator-> () const noexcept
+    {
+        return &node ()->info;
+    }
+
+    const T &operator* () const noexcept
+    {
+        return node ()->info;
+    }
+
+private:
+    const CMappedNode *node () const noexcept
+    {
+        return reinterpret_cast<const CMappedNode *> (base + offset);
+    }
+
+    std::uint64_t follow (std::uint64_t link) const noexcept
+    {
+        return isLink (base, link) ? link : 0;
+    }
+};
+
+template<typename T>
+template<class ForwardIterator>
+bool nsSdD::CMappedList<T>::write (ForwardIterator first, ForwardIterator last, const std::string &path, size_type spare /*= 0*/) noexcept
+{
+    const std::uint64_t count = std::distance (first, last);
+    const std::uint64_t capacity = count + spare;
+
+    std::ofstream file (path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    CHeader header;
+    std::memset (&header, 0, sizeof (header));
+    std::memcpy (header.magic, magic (), sizeof (header.magic));
+    header.version = version;
+    header.nodeSize = sizeof (CMappedNode);
+    header.size = count;
+    header.capacity = capacity;
+    header.head = count ? firstNodeOffset () : 0;
+    header.tail = count ? firstNodeOffset () + (count - 1) * sizeof (CMappedNode) : 0;
+    header.freeList = spare ? firstNodeOffset () + count * sizeof (CMappedNode) : 0;
+
+    // The header is written last, once the checksum of the nodes is known.
+    std::vector<char> buffer (firstNodeOffset (), 0);
+    file.write (buffer.data (), buffer.size ());
+
+    // Nodes are written by chunks of about 1 MiB.
+    const std::uint64_t nodesPerChunk = 1 + (1 << 20) / sizeof (CMappedNode);
+    std::vector<char> chunk (nodesPerChunk * sizeof (CMappedNode));
+    std::uint64_t hash = hashBytes (nullptr, 0);
+
+    for (std::uint64_t i = 0; i < capacity;)
+    {
+        std::uint64_t filled = 0;
+        std::fill (chunk.begin (), chunk.end (), 0);
+
+        for (; filled < nodesPerChunk && i < capacity; ++filled, ++i)
+        {
+            CMappedNode &node = *reinterpret_cast<CMappedNode *> (chunk.data () + filled * sizeof (CMappedNode));
+            const std::uint64_t offset = firstNodeOffset () + i * sizeof (CMappedNode);
+
+            if (i < count)
+            {
+                node.next = i + 1 < count ? offset + sizeof (CMappedNode) : 0;
+                node.previous = i ? offset - sizeof (CMappedNode) : 0;
+                const T &info = *first++;
+                std::memcpy (static_cast<void *> (&node.info), &info, sizeof (T));
+            }
+            else // Spare slots are chained in the free list through next.
+                node.next = i + 1 < capacity ? offset + sizeof (CMappedNode) : 0;
+        }
+
+        hash = hashBytes (chunk.data (), filled * sizeof (CMappedNode), hash);
+        file.write (chunk.data (), filled * sizeof (CMappedNode));
+    }
+
+    header.checksum = hashBytes (reinterpret_cast<const char *> (&header), offsetof (CHeader, checksum), hash);
+    file.seekp (0);
+    file.write (reinterpret_cast<const char *> (&header), sizeof (header));
+
+    return static_cast<bool> (file.flush ());
+}
+
+template<typename T>
+bool nsSdD::CMappedList<T>::write (const CList<T> &list, const std::string &path, size_type spare /*= 0*/) noexcept
+{
+    return write (list.cbegin (), list.cend (), path, spare);
+}
+
+template<typename T>
+nsSdD::CMappedList<T>::CMappedList () noexcept
+{
+}
+
+template<typename T>
+nsSdD::CMappedList<T>::~CMappedList () noexcept
+{
+    close ();
+}
+
+template<typename T>
+bool nsSdD::CMappedList<T>::open (const std::string &path, EMode mode /*= ReadOnly*/, bool verify /*= false*/) noexcept
+{
+    close ();
+
+    int fd = ::open (path.c_str (), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat status;
+    if (fstat (fd, &status) != 0 || static_cast<std::uint64_t> (status.st_size) < firstNodeOffset ())
+    {
+        ::close (fd);
+        return false;
+    }
+
+    std::uint64_t length = status.st_size;
+    void *base = mode == ReadOnly ? mmap (nullptr, length, PROT_READ, MAP_SHARED, fd, 0)
+                                  : mmap (nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close (fd);
+
+    if (base == MAP_FAILED)
+        return false;
+
+    // Once the capacity matches the length, isLink keeps every followed link inside of the mapping.
+    const char *b = static_cast<const char *> (base);
+    const CHeader *h = static_cast<const CHeader *> (base);
+    bool valid = std::memcmp (h->magic, magic (), sizeof (h->magic)) == 0
+                 && h->version == version
+                 && h->nodeSize == sizeof (CMappedNode)
+                 && h->size <= h->capacity
+                 && h->capacity == (length - firstNodeOffset ()) / sizeof (CMappedNode)
+                 && firstNodeOffset () + h->capacity * sizeof (CMappedNode) == length
+                 && isLink (b, h->head) && isLink (b, h->tail) && isLink (b, h->freeList)
+                 && (!verify || checksum (b, length) == h->checksum);
+
+    if (!valid)
+    {
+        munmap (base, length);
+        return false;
+    }
+
+    m_base = static_cast<char *> (base);
+    m_length = length;
+    m_mode = mode;
+
+    return true;
+}
+
+template<typename T>
+void nsSdD::CMappedList<T>::close () noexcept
+{
+    if (m_base)
+        munmap (m_base, m_length);
+
+    m_base = nullptr;
+    m_length = 0;
+}
+
+template<typename T>
+bool nsSdD::CMappedList<T>::isOpen () const noexcept
+{
+    return m_base != nullptr;
+}
+
+template<typename T>
+bool nsSdD::CMappedList<T>::save (const std::string &path, size_type spare /*= 0*/) const noexcept
+{
+    return isOpen () && write (cbegin (), cend (), path, spare);
+}
+
+template<typename T>
+nsSdD::CList<T> nsSdD::CMappedList<T>::toList () const noexcept
+{
+    return CList<T> (cbegin (), cend ());
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::iterator nsSdD::CMappedList<T>::begin () noexcept
+{
+    return iterator (m_base, isOpen () && m_mode == CopyOnWrite ? header ()->head : 0);
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::iterator nsSdD::CMappedList<T>::end () noexcept
+{
+    return iterator (m_base, 0);
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::const_iterator nsSdD::CMappedList<T>::begin () const noexcept
+{
+    return cbegin ();
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::const_iterator nsSdD::CMappedList<T>::end () const noexcept
+{
+    return cend ();
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::const_iterator nsSdD::CMappedList<T>::cbegin () const noexcept
+{
+    return const_iterator (m_base, isOpen () ? header ()->head : 0);
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::const_iterator nsSdD::CMappedList<T>::cend () const noexcept
+{
+    return const_iterator (m_base, 0);
+}
+
+template<typename T>
+bool nsSdD::CMappedList<T>::empty () const noexcept
+{
+    return size () == 0;
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::size_type nsSdD::CMappedList<T>::size () const noexcept
+{
+    return isOpen () ? header ()->size : 0;
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::size_type nsSdD::CMappedList<T>::available () const noexcept
+{
+    return isOpen () && m_mode == CopyOnWrite ? header ()->capacity - header ()->size : 0;
+}
+
+template<typename T>
+T nsSdD::CMappedList<T>::front () const noexcept
+{
+    return node (header ()->head)->info;
+}
+
+template<typename T>
+T nsSdD::CMappedList<T>::back () const noexcept
+{
+    return node (header ()->tail)->info;
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::iterator nsSdD::CMappedList<T>::insert (iterator position, const T &val) noexcept
+{
+    if (!available () || !header ()->freeList)
+        return end ();
+
+    CHeader *h = header ();
+    const std::uint64_t offset = h->freeList;
+    const std::uint64_t next = position.getOffset ();
+    const std::uint64_t previous = next ? node (next)->previous : h->tail;
+
+    CMappedNode *newNode = node (offset);
+    if (!isLink (m_base, previous) || !isLink (m_base, newNode->next))
+        return end ();
+
+    h->freeList = newNode->next;
+
+    newNode->next = next;
+    newNode->previous = previous;
+    std::memcpy (static_cast<void *> (&newNode->info), &val, sizeof (T));
+
+    (previous ? node (previous)->next : h->head) = offset;
+    (next ? node (next)->previous : h->tail) = offset;
+    ++h->size;
+
+    return iterator (m_base, offset);
+}
+
+template<typename T>
+bool nsSdD::CMappedList<T>::push_back (const T &x) noexcept
+{
+    return insert (end (), x) != end ();
+}
+
+template<typename T>
+bool nsSdD::CMappedList<T>::push_front (const T &x) noexcept
+{
+    return insert (begin (), x) != end ();
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::iterator nsSdD::CMappedList<T>::erase (iterator position) noexcept
+{
+    if (!isOpen () || m_mode != CopyOnWrite || !position.getOffset ())
+        return end ();
+
+    CHeader *h = header ();
+    const std::uint64_t offset = position.getOffset ();
+    CMappedNode *oldNode = node (offset);
+    const std::uint64_t next = oldNode->next;
+    if (!isLink (m_base, next) || !isLink (m_base, oldNode->previous))
+        return end ();
+
+    (oldNode->previous ? node (oldNode->previous)->next : h->head) = next;
+    (next ? node (next)->previous : h->tail) = oldNode->previous;
+    --h->size;
+
+    oldNode->next = h->freeList;
+    h->freeList = offset;
+
+    return iterator (m_base, next);
+}
+
+template<typename T>
+void nsSdD::CMappedList<T>::pop_front () noexcept
+{
+    if (!empty ())
+        erase (begin ());
+}
+
+template<typename T>
+void nsSdD::CMappedList<T>::pop_back () noexcept
+{
+    if (!empty ())
+        erase (--end ());
+}
+
+template<typename T>
+const char *nsSdD::CMappedList<T>::magic () noexcept
+{
+    return "CLSTMAP1";
+}
+
+template<typename T>
+constexpr std::uint64_t nsSdD::CMappedList<T>::firstNodeOffset () noexcept
+{
+    return (sizeof (CHeader) + alignof (CMappedNode) - 1) / alignof (CMappedNode) * alignof (CMappedNode);
+}
+
+template<typename T>
+bool nsSdD::CMappedList<T>::isLink (const char *base, std::uint64_t offset) noexcept
+{
+    const std::uint64_t nodesEnd = firstNodeOffset ()
+                                   + reinterpret_cast<const CHeader *> (base)->capacity * sizeof (CMappedNode);
+
+    return offset == 0 || (offset >= firstNodeOffset () && offset < nodesEnd
+                           && (offset - firstNodeOffset ()) % sizeof (CMappedNode) == 0);
+}
+
+template<typename T>
+std::uint64_t nsSdD::CMappedList<T>::hashBytes (const char *data, std::uint64_t length, std::uint64_t hash /*= 0xcbf29ce484222325*/) noexcept
+{
+    // FNV-1a, fed a 64 bits word at a time rather than a byte to keep up with the disk.
+    const std::uint64_t prime = 0x100000001b3;
+    std::uint64_t i = 0;
+
+    for (; i + sizeof (std::uint64_t) <= length; i += sizeof (std::uint64_t))
+    {
+        std::uint64_t word;
+        std::memcpy (&word, data + i, sizeof (word));
+        hash = (hash ^ word) * prime;
+        hash ^= hash >> 29;
+    }
+
+    for (; i < length; ++i)
+        hash = (hash ^ static_cast<unsigned char> (data[i])) * prime;
+
+    return hash;
+}
+
+template<typename T>
+std::uint64_t nsSdD::CMappedList<T>::checksum (const char *base, std::uint64_t length) noexcept
+{
+    std::uint64_t hash = hashBytes (base + firstNodeOffset (), length - firstNodeOffset ());
+
+    return hashBytes (base, offsetof (CHeader, checksum), hash);
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::CHeader *nsSdD::CMappedList<T>::header () const noexcept
+{
+    return reinterpret_cast<CHeader *> (m_base);
+}
+
+template<typename T>
+typename nsSdD::CMappedList<T>::CMappedNode *nsSdD::CMappedList<T>::node (std::uint64_t offset) const noexcept
+{
+    return reinterpret_cast<CMappedNode *> (m_base + offset);
+}
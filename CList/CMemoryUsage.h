@@ -0,0 +1,170 @@
+/*!
+@file CMemoryUsage.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief The memory footprint of a CList, as returned by CList::memory_usage.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace nsSdD
+{
+    /*!
+        @brief The bytes used by a CList, and with the deep mode, how its nodes are spread in memory.
+
+               The bytes are computed from the sizes of the types: the memory owned by the elements themselves
+               (the characters of a std::string, the object of a pointer) is not counted.
+     */
+    struct CMemoryUsage
+    {
+        /*!
+            @var payload
+            @brief The bytes of the elements.
+         */
+        size_t payload = 0;
+
+        /*!
+            @var links
+            @brief The bytes of the links of the nodes, and their padding.
+         */
+        size_t links = 0;
+
+        /*!
+            @var allocatorOverhead
+            @brief The bytes of the shared_ptr control blocks and of the headers and rounding of the slots of
+                   the node caches, or an estimate of those of malloc without the node caches.
+         */
+        size_t allocatorOverhead = 0;
+
+        /*!
+            @var sentinels
+            @brief The bytes of the two sentinels, allocations included.
+         */
+        size_t sentinels = 0;
+
+        /*!
+            @var allocationSize
+            @brief The bytes taken by one node from its node cache, or estimated from malloc.
+         */
+        size_t allocationSize = 0;
+
+        /*!
+            @var deep
+            @brief If the nodes were walked, the fields below are only set then.
+         */
+        bool deep = false;
+
+        /*!
+            @var nodes
+            @brief The number of nodes reached from the head, size () unless the links are broken.
+         */
+        size_t nodes = 0;
+
+        /*!
+            @var addressSpread
+            @brief The bytes between the lowest and the highest node, the last one included.
+         */
+        size_t addressSpread = 0;
+
+        /*!
+            @var pages
+            @brief The number of 4 KiB pages holding at least a node.
+         */
+        size_t pages = 0;
+
+        /*!
+            @var adjacentSteps
+            @brief The number of nodes directly following the previous one in memory, in the order of the list.
+         */
+        size_t adjacentSteps = 0;
+
+        /*!
+            @var averageStride
+            @brief The average distance in bytes between a node and the next one.
+         */
+        double averageStride = 0;
+
+        /*!
+            @var fragmentation
+            @brief The part of the address spread which doesn't hold nodes, from 0 for a packed list to nearly 1.
+         */
+        double fragmentation = 0;
+
+        /*!
+            @brief  Return the bytes of the payload, the links, the allocator overhead and the sentinels.
+         */
+        size_t total () const noexcept
+        {
+            return payload + links + allocatorOverhead + sentinels;
+        }
+    };
+
+    /*!
+        @brief The bytes counted by the CSizingAllocator of the calling thread.
+     */
+    struct CSizingAllocatorBase
+    {
+        static size_t &requested () noexcept
+        {
+            static thread_local size_t bytes = 0;
+            return bytes;
+        }
+    };
+
+    /*!
+        @brief Allocator counting the bytes requested by std::allocate_shared, to know the size of the block
+               holding an object and its control block. It is empty like std::allocator, so that the block has
+               the layout std::make_shared gives it.
+     */
+    template<typename T>
+    struct CSizingAllocator : CSizingAllocatorBase
+    {
+        typedef T value_type;
+
+        CSizingAllocator () noexcept = default;
+
+        template<typename U>
+        CSizingAllocator (const CSizingAllocator<U> &) noexcept
+        {
+        }
+
+        T *allocate (size_t n)
+        {
+            requested () += n * sizeof (T);
+            return std::allocator<T> ().allocate (n);
+        }
+
+        void deallocate (T *p, size_t n) noexcept
+        {
+            std::allocator<T> ().deallocate (p, n);
+        }
+
+        template<typename U>
+        bool operator== (const CSizingAllocator<U> &) const noexcept
+        {
+            return true;
+        }
+
+        template<typename U>
+        bool operator!= (const CSizingAllocator<U> &) const noexcept
+        {
+            return false;
+        }
+    };
+
+    /*!
+        @brief  Return the bytes malloc takes to give @p requested bytes, estimated for a dlmalloc-like allocator
+                (glibc): a header of one size_t, rounded to two size_t, with a minimum of four.
+     */
+    inline size_t mallocChunkSize (size_t requested) noexcept
+    {
+        const size_t alignment = 2 * sizeof (size_t);
+        size_t chunk = (requested + sizeof (size_t) + alignment - 1) & ~(alignment - 1);
+
+        return chunk < 2 * alignment ? 2 * alignment : chunk;
+    }
+}
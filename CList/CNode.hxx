@@ -15,8 +15,8 @@
             Also contains methods for insertion and removal.
             Be careful to keep count in CList.m_size when using those.
  */
-template<typename T>
-class nsSdD::CList<T>::CNode
+template<typename T, class Policy>
+class nsSdD::CList<T, Policy>::CNode
 {
 private:
     /*!
@@ -102,11 +102,11 @@ public:
     }
 
     /*!
-        @fn inline void setNext (CNodePtr next) noexcept
+        @fn inline void setNext (const CNodePtr &next) noexcept
         @brief This is the setter of the next CNode
         @param[in] next This is the next CNode that you liked to define
      */
-    inline void setNext (CNodePtr next) noexcept
+    inline void setNext (const CNodePtr &next) noexcept
     {
         m_next = next;
     }
@@ -121,11 +121,11 @@ public:
     }
 
     /*!
-        @fn inline void setPrevious (CNodePtr previous) noexcept
+        @fn inline void setPrevious (const CNodePtr &previous) noexcept
         @brief This is the setter of the previous CNode
         @param[in] previous This is the previous CNode that you liked to define
      */
-    inline void setPrevious (CNodePtr previous) noexcept
+    inline void setPrevious (const CNodePtr &previous) noexcept
     {
         m_previous = previous;
     }
@@ -140,6 +140,75 @@ public:
         m_previous->setNext (m_next);
     }
 
+    /*!
+        @fn inline void linkBefore (const CNodePtr &first, const CNodePtr &last) noexcept
+        @brief This function links the unlinked chain of CNode from @p first to @p last (included) before this one,
+                with four link updates whatever the length of the chain.
+        @param[in] first This is the first CNode of the chain that you want to link
+        @param[in] last This is the last CNode of the chain that you want to link
+     */
+    inline void linkBefore (const CNodePtr &first, const CNodePtr &last) noexcept
+    {
+        first->m_previous = m_previous;
+        last->m_next = m_previous->m_next;
+        m_previous->m_next = first;
+        m_previous = last;
+    }
+
+    /*!
+        @fn inline void linkAfter (const CNodePtr &first, const CNodePtr &last) noexcept
+        @brief This function links the unlinked chain of CNode from @p first to @p last (included) after this one.
+        @param[in] first This is the first CNode of the chain that you want to link
+        @param[in] last This is the last CNode of the chain that you want to link
+     */
+    inline void linkAfter (const CNodePtr &first, const CNodePtr &last) noexcept
+    {
+        first->m_previous = m_next->m_previous;
+        last->m_next = m_next;
+        m_next->m_previous = last;
+        m_next = first;
+    }
+
+    /*!
+        @fn static inline void unlinkRing (const CNodePtr &first, const CNodePtr &last) noexcept
+        @brief This function unlinks the chain of CNode from @p first to @p last (included) and closes it in a ring,
+                by swapping links: no reference count changes.
+        @param[in] first This is the first CNode of the chain that you want to unlink
+        @param[in] last This is the last CNode of the chain that you want to unlink
+     */
+    static inline void unlinkRing (const CNodePtr &first, const CNodePtr &last) noexcept
+    {
+        CNodePtr &before = first->m_previous->m_next;
+
+        std::swap (before, last->m_next);
+        std::swap (before->m_previous, first->m_previous);
+    }
+
+    /*!
+        @fn inline void linkRingBefore (const CNodePtr &first, const CNodePtr &last) noexcept
+        @brief This function links the ring of CNode from @p first to @p last, closed by unlinkRing, before this
+                one, by swapping links.
+        @param[in] first This is the first CNode of the ring that you want to link
+        @param[in] last This is the last CNode of the ring that you want to link
+     */
+    inline void linkRingBefore (const CNodePtr &first, const CNodePtr &last) noexcept
+    {
+        std::swap (m_previous->m_next, last->m_next);
+        std::swap (m_previous, first->m_previous);
+    }
+
+    /*!
+        @fn inline void linkRingAfter (const CNodePtr &first, const CNodePtr &last) noexcept
+        @brief This function links the ring of CNode from @p first to @p last, closed by unlinkRing, after this
+                one, by swapping links.
+        @param[in] first This is the first CNode of the ring that you want to link
+        @param[in] last This is the last CNode of the ring that you want to link
+     */
+    inline void linkRingAfter (const CNodePtr &first, const CNodePtr &last) noexcept
+    {
+        m_next->linkRingBefore (first, last);
+    }
+
     /*!
         @fn inline CNodePtr addBefore (const T &val) noexcept
         @brief This function adds a CNode before
@@ -147,7 +216,7 @@ public:
      */
     inline CNodePtr addBefore (const T &val) noexcept
     {
-        CNodePtr newNode = std::make_shared<CNode> (val, m_previous->m_next, m_previous);
+        CNodePtr newNode = CList<T, Policy>::makeNode (val, m_previous->m_next, m_previous);
         m_previous->m_next = newNode;
         m_previous = newNode;
         return newNode;
@@ -160,7 +229,7 @@ public:
      */
     inline CNodePtr addAfter (const T &val) noexcept
     {
-        CNodePtr newNode = std::make_shared<CNode> (val, m_next, m_next->m_previous);
+        CNodePtr newNode = CList<T, Policy>::makeNode (val, m_next, m_next->m_previous);
         m_next->m_previous = newNode;
         m_next = newNode;
         return newNode;
@@ -0,0 +1,304 @@
+/*!
+@file CNodeCache.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Thread-local caches of the nodes of CList, and the allocator giving them to std::allocate_shared.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "CHugePageArena.h"
+
+namespace nsSdD
+{
+    /*!
+        @brief CNodeCache is the cache of the slots of one size owned by one thread.
+
+               Each thread allocates its nodes from slabs of its own caches, one per size class, without locks.
+               A slot starts with a header naming the cache owning it: a node freed by its owner goes back to the
+               owner's free list, a node freed by another thread is returned to its owner through a lock-free stack
+               (remote free). The freeing thread groups the nodes of a same owner, so that a producer-consumer
+               handoff pushes a whole batch with one compare-and-swap; the owner takes all the returned nodes at
+               once when its free list is empty. Neither side goes through malloc in the steady state.
+
+               A cache outlives its thread as long as nodes of its slabs are alive elsewhere: the last one freed
+               releases the slabs.
+
+               The slabs come from operator new, or from the CHugePageArena when it is enabled.
+     */
+    class CNodeCache
+    {
+    public:
+        /*!
+            @brief The alignment of the slots, and the step between the size classes.
+         */
+        static const size_t slotAlignment = 16;
+
+        /*!
+            @brief The largest object kept in a cache, the bigger ones are allocated with operator new.
+         */
+        static const size_t maxObjectSize = 512;
+
+        /*!
+            @brief The bytes of a slab of slots, a block of the CHugePageArena.
+         */
+        static const size_t slabBytes = CHugePageArena::blockBytes;
+
+        /*!
+            @brief The number of nodes freed by another thread that are returned to their owner at once.
+         */
+        static const size_t remoteBatch = 64;
+
+        /*!
+            @brief The state of the cache of the calling thread for a size.
+         */
+        struct CStats
+        {
+            /*!
+                @var slotSize
+                @brief The bytes of a slot, its header included.
+             */
+            size_t slotSize;
+
+            /*!
+                @var slabs
+                @brief The number of slabs allocated.
+             */
+            size_t slabs;
+
+            /*!
+                @var live
+                @brief The number of slots in use, here or in other threads.
+             */
+            size_t live;
+
+            /*!
+                @var remoteFreed
+                @brief The number of slots freed by other threads.
+             */
+            size_t remoteFreed;
+        };
+
+        /*!
+            @brief  Return a slot for an object of @p size bytes, from the cache of the calling thread.
+         */
+        static void *allocate (size_t size);
+
+        /*!
+            @brief  Gives back the slot @p p returned by @p allocate, to its owner.
+         */
+        static void deallocate (void *p) noexcept;
+
+        /*!
+            @brief  Return the bytes taken by an object of @p size bytes, the header of its slot included.
+         */
+        static size_t slotSize (size_t size) noexcept;
+
+        /*!
+            @brief  Return the state of the cache of the calling thread for the objects of @p size bytes.
+         */
+        static CStats stats (size_t size) noexcept;
+
+        CNodeCache (const CNodeCache &) = delete;
+
+        CNodeCache &operator= (const CNodeCache &) = delete;
+
+    private:
+        /*!
+            @brief The header of a slot, followed by the object.
+         */
+        struct alignas (slotAlignment) CSlot
+        {
+            CNodeCache *owner;
+            CSlot *next;
+        };
+
+        /*!
+            @brief The slots freed by a thread for another one, not returned yet.
+         */
+        struct CRemoteBatch
+        {
+            CNodeCache *owner = nullptr;
+            CSlot *first = nullptr;
+            CSlot *last = nullptr;
+            size_t count = 0;
+        };
+
+        static const size_t classCount = maxObjectSize / slotAlignment;
+
+        /*!
+            @brief The caches of a thread, one per size class, and its pending remote frees.
+         */
+        struct CThreadState
+        {
+            CNodeCache *caches[classCount] = {};
+            CRemoteBatch batch;
+        };
+
+        /*!
+            @brief Releases the state of its thread when the thread exits.
+         */
+        struct CThreadGuard
+        {
+            ~CThreadGuard () noexcept;
+        };
+
+        explicit CNodeCache (size_t sizeClass) noexcept;
+
+        ~CNodeCache () noexcept;
+
+        /*!
+            @brief  Return the state of the calling thread, created on first use, nullptr once the thread exited.
+         */
+        static CThreadState *localState () noexcept;
+
+        static CThreadState *&threadState () noexcept;
+
+        static bool &threadExited () noexcept;
+
+        /*!
+            @brief  Return the size class of the objects of @p size bytes.
+         */
+        static size_t sizeClass (size_t size) noexcept;
+
+        /*!
+            @brief  Returns the slots of @p batch to their owner.
+         */
+        static void flush (CRemoteBatch &batch) noexcept;
+
+        /*!
+            @brief  Return a new slab, from the CHugePageArena if it is enabled and has room.
+         */
+        static void *allocateSlab ();
+
+        /*!
+            @brief  Return a free slot, taking back the returned ones or allocating a slab if there is none.
+         */
+        CSlot *pop ();
+
+        /*!
+            @brief  Puts back a slot freed by the owner.
+         */
+        void push (CSlot *slot) noexcept;
+
+        /*!
+            @brief  Returns the @p count slots chained from @p first to @p last, freed by another thread.
+         */
+        void remoteFree (CSlot *first, CSlot *last, size_t count) noexcept;
+
+        /*!
+            @brief  Called when the owner exits: the cache is deleted once all its slots are freed.
+         */
+        void orphan () noexcept;
+
+        /*!
+            @var m_sizeClass
+            @brief The index of the size of the slots.
+         */
+        size_t m_sizeClass;
+
+        /*!
+            @var m_slotSize
+            @brief The bytes of a slot.
+         */
+        size_t m_slotSize;
+
+        /*!
+            @var m_free
+            @brief The free slots, only used by the owner.
+         */
+        CSlot *m_free = nullptr;
+
+        /*!
+            @var m_allocated
+            @brief The number of slots given by the owner.
+         */
+        size_t m_allocated = 0;
+
+        /*!
+            @var m_freedLocally
+            @brief The number of slots freed by the owner.
+         */
+        size_t m_freedLocally = 0;
+
+        /*!
+            @var m_slabs
+            @brief The slabs of the slots, released with the cache.
+         */
+        std::vector<void *> m_slabs;
+
+        /*!
+            @var m_padding
+            @brief Keeps the fields of the owner out of the cache line written by the other threads.
+         */
+        char m_padding[64];
+
+        /*!
+            @var m_remote
+            @brief The slots freed by other threads.
+         */
+        std::atomic<CSlot *> m_remote;
+
+        /*!
+            @var m_remoteFreed
+            @brief The number of slots freed by other threads, minus the slots alive when the owner exited.
+                    The cache is deleted when it goes back to 0 after its owner exited.
+         */
+        std::atomic<std::ptrdiff_t> m_remoteFreed;
+    };
+
+    /*!
+        @brief Allocator of std::allocate_shared taking the blocks of the nodes from the CNodeCache of the calling
+               thread. It is empty, so that the control blocks are as small as with std::make_shared.
+     */
+    template<typename T>
+    struct CNodeAllocator
+    {
+        typedef T value_type;
+
+        CNodeAllocator () noexcept = default;
+
+        template<typename U>
+        CNodeAllocator (const CNodeAllocator<U> &) noexcept
+        {
+        }
+
+        T *allocate (size_t n)
+        {
+            static_assert (alignof (T) <= CNodeCache::slotAlignment, "The nodes are aligned on CNodeCache::slotAlignment at most");
+
+            if (n != 1)
+                return static_cast<T *> (::operator new (n * sizeof (T)));
+
+            return static_cast<T *> (CNodeCache::allocate (sizeof (T)));
+        }
+
+        void deallocate (T *p, size_t n) noexcept
+        {
+            if (n != 1)
+                ::operator delete (p);
+            else
+                CNodeCache::deallocate (p);
+        }
+
+        template<typename U>
+        bool operator== (const CNodeAllocator<U> &) const noexcept
+        {
+            return true;
+        }
+
+        template<typename U>
+        bool operator!= (const CNodeAllocator<U> &) const noexcept
+        {
+            return false;
+        }
+    };
+}
+
+#include "CNodeCache.hxx"
@@ -0,0 +1,231 @@
+/*!
+@file CNodeCache.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CNodeCache class implementation.
+*/
+#pragma once
+
+#include "CNodeCache.h"
+
+inline nsSdD::CNodeCache::CNodeCache (size_t sizeClass) noexcept
+        : m_sizeClass (sizeClass), m_slotSize (sizeof (CSlot) + (sizeClass + 1) * slotAlignment),
+          m_remote (nullptr), m_remoteFreed (0)
+{
+}
+
+inline nsSdD::CNodeCache::~CNodeCache () noexcept
+{
+    CHugePageArena &arena = CHugePageArena::instance ();
+
+    for (void *slab : m_slabs)
+        if (arena.owns (slab))
+            arena.deallocate (slab);
+        else
+            ::operator delete (slab);
+}
+
+inline size_t nsSdD::CNodeCache::sizeClass (size_t size) noexcept
+{
+    return size == 0 ? 0 : (size - 1) / slotAlignment;
+}
+
+inline size_t nsSdD::CNodeCache::slotSize (size_t size) noexcept
+{
+    return sizeof (CSlot) + (sizeClass (size) + 1) * slotAlignment;
+}
+
+inline nsSdD::CNodeCache::CThreadState *&nsSdD::CNodeCache::threadState () noexcept
+{
+    static thread_local CThreadState *state = nullptr;
+    return state;
+}
+
+inline bool &nsSdD::CNodeCache::threadExited () noexcept
+{
+    static thread_local bool exited = false;
+    return exited;
+}
+
+inline nsSdD::CNodeCache::CThreadState *nsSdD::CNodeCache::localState () noexcept
+{
+    CThreadState *&state = threadState ();
+
+    if (state == nullptr && !threadExited ())
+    {
+        // Constructed once per thread, its destructor runs when the thread exits.
+        static thread_local CThreadGuard guard;
+        (void) guard;
+
+        state = new CThreadState ();
+    }
+
+    return state;
+}
+
+inline nsSdD::CNodeCache::CThreadGuard::~CThreadGuard () noexcept
+{
+    CThreadState *state = threadState ();
+
+    threadState () = nullptr;
+    threadExited () = true;
+
+    if (state == nullptr)
+        return;
+
+    flush (state->batch);
+    for (CNodeCache *cache : state->caches)
+        if (cache != nullptr)
+            cache->orphan ();
+
+    delete state;
+}
+
+inline void *nsSdD::CNodeCache::allocate (size_t size)
+{
+    CThreadState *state = size <= maxObjectSize ? localState () : nullptr;
+
+    if (state == nullptr)
+    {
+        // Too big, or the thread exited: a slot of no cache, given back to operator delete.
+        CSlot *slot = static_cast<CSlot *> (::operator new (slotSize (size)));
+        slot->owner = nullptr;
+        return slot + 1;
+    }
+
+    CNodeCache *&cache = state->caches[sizeClass (size)];
+    if (cache == nullptr)
+        cache = new CNodeCache (sizeClass (size));
+
+    return cache->pop () + 1;
+}
+
+inline void nsSdD::CNodeCache::deallocate (void *p) noexcept
+{
+    CSlot *slot = static_cast<CSlot *> (p) - 1;
+    CNodeCache *owner = slot->owner;
+
+    if (owner == nullptr)
+    {
+        ::operator delete (slot);
+        return;
+    }
+
+    CThreadState *state = localState ();
+    if (state == nullptr)
+    {
+        owner->remoteFree (slot, slot, 1);
+        return;
+    }
+
+    if (state->caches[owner->m_sizeClass] == owner)
+    {
+        owner->push (slot);
+        return;
+    }
+
+    CRemoteBatch &batch = state->batch;
+    if (batch.owner != owner)
+    {
+        flush (batch);
+        batch.owner = owner;
+        batch.first = slot;
+    }
+    else
+        batch.last->next = slot;
+
+    batch.last = slot;
+    if (++batch.count == remoteBatch)
+        flush (batch);
+}
+
+inline nsSdD::CNodeCache::CStats nsSdD::CNodeCache::stats (size_t size) noexcept
+{
+    CStats stats = { slotSize (size), 0, 0, 0 };
+
+    CThreadState *state = localState ();
+    if (state == nullptr || size > maxObjectSize || state->caches[sizeClass (size)] == nullptr)
+        return stats;
+
+    const CNodeCache *cache = state->caches[sizeClass (size)];
+    stats.slabs = cache->m_slabs.size ();
+    stats.remoteFreed = static_cast<size_t> (cache->m_remoteFreed.load (std::memory_order_acquire));
+    stats.live = cache->m_allocated - cache->m_freedLocally - stats.remoteFreed;
+
+    return stats;
+}
+
+inline void nsSdD::CNodeCache::flush (CRemoteBatch &batch) noexcept
+{
+    if (batch.count == 0)
+        return;
+
+    batch.owner->remoteFree (batch.first, batch.last, batch.count);
+    batch = CRemoteBatch ();
+}
+
+inline void *nsSdD::CNodeCache::allocateSlab ()
+{
+    void *slab = CHugePageArena::enabled () ? CHugePageArena::instance ().allocate () : nullptr;
+
+    return slab != nullptr ? slab : ::operator new (slabBytes);
+}
+
+inline nsSdD::CNodeCache::CSlot *nsSdD::CNodeCache::pop ()
+{
+    // Takes back all the slots returned by the other threads at once.
+    if (m_free == nullptr)
+        m_free = m_remote.exchange (nullptr, std::memory_order_acquire);
+
+    if (m_free == nullptr)
+    {
+        char *slab = static_cast<char *> (allocateSlab ());
+        m_slabs.push_back (slab);
+
+        for (size_t offset = (slabBytes / m_slotSize - 1) * m_slotSize; ; offset -= m_slotSize)
+        {
+            CSlot *slot = reinterpret_cast<CSlot *> (slab + offset);
+            slot->owner = this;
+            slot->next = m_free;
+            m_free = slot;
+
+            if (offset == 0)
+                break;
+        }
+    }
+
+    CSlot *slot = m_free;
+    m_free = slot->next;
+    ++m_allocated;
+
+    return slot;
+}
+
+inline void nsSdD::CNodeCache::push (CSlot *slot) noexcept
+{
+    slot->next = m_free;
+    m_free = slot;
+    ++m_freedLocally;
+}
+
+inline void nsSdD::CNodeCache::remoteFree (CSlot *first, CSlot *last, size_t count) noexcept
+{
+    // Only the owner pops, and it takes the whole stack: pushes can't suffer from ABA.
+    CSlot *head = m_remote.load (std::memory_order_relaxed);
+    do
+        last->next = head;
+    while (!m_remote.compare_exchange_weak (head, first, std::memory_order_release, std::memory_order_relaxed));
+
+    std::ptrdiff_t freed = static_cast<std::ptrdiff_t> (count);
+    if (m_remoteFreed.fetch_add (freed, std::memory_order_acq_rel) + freed == 0)
+        delete this;
+}
+
+inline void nsSdD::CNodeCache::orphan () noexcept
+{
+    std::ptrdiff_t alive = static_cast<std::ptrdiff_t> (m_allocated - m_freedLocally);
+
+    if (m_remoteFreed.fetch_sub (alive, std::memory_order_acq_rel) - alive == 0)
+        delete this;
+}
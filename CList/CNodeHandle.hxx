@@ -0,0 +1,89 @@
+/*!
+@file CNodeHandle.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Implementation of the node handle of the CList class.
+*/
+
+#pragma once
+
+#include <utility>
+
+#include "CList.h"
+
+/*!
+    @brief The owner of a node extracted from a CList, with its value, until it is inserted in a CList again.
+           It can only be moved, and frees the node if it is destroyed while still owning it.
+ */
+template<typename T, class Policy>
+class nsSdD::CList<T, Policy>::CNodeHandle
+{
+private:
+    friend class nsSdD::CList<T, Policy>;
+
+    /*!
+        @var m_node
+        @brief The unlinked node, nullptr if the handle is empty.
+    */
+    CNodePtr m_node;
+
+    /*!
+        @fn             explicit CNodeHandle (CNodePtr node) noexcept
+        @brief          The constructor of the handle owning the unlinked @p node.
+    */
+    explicit CNodeHandle (CNodePtr node) noexcept : m_node (std::move (node))
+    {
+    }
+
+public:
+    /*!
+        @fn             CNodeHandle () noexcept
+        @brief          The constructor of an empty handle.
+    */
+    CNodeHandle () noexcept = default;
+
+    /*!
+        @fn             CNodeHandle (CNodeHandle &&other) noexcept
+        @brief          The move-constructor, @p other is empty afterwards.
+    */
+    CNodeHandle (CNodeHandle &&other) noexcept = default;
+
+    /*!
+        @fn             operator= (CNodeHandle &&other) noexcept
+        @brief          The move-assignment, the node owned before is freed and @p other is empty afterwards.
+    */
+    CNodeHandle &operator= (CNodeHandle &&other) noexcept = default;
+
+    CNodeHandle (const CNodeHandle &) = delete;
+
+    CNodeHandle &operator= (const CNodeHandle &) = delete;
+
+    /*!
+        @fn             empty () const noexcept
+        @brief          Return true if the handle owns no node, false otherwise.
+    */
+    bool empty () const noexcept
+    {
+        return m_node == nullptr;
+    }
+
+    /*!
+        @fn             operator bool () const noexcept
+        @brief          Return true if the handle owns a node, false otherwise.
+    */
+    explicit operator bool () const noexcept
+    {
+        return m_node != nullptr;
+    }
+
+    /*!
+        @fn             value () const noexcept
+        @brief          Return the value of the node, which may be modified before it is inserted again.
+                        The handle must not be empty.
+    */
+    T &value () const noexcept
+    {
+        return m_node->getInfo ();
+    }
+};
@@ -0,0 +1,141 @@
+#include "CPerfCounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+using namespace nsBench;
+
+namespace
+{
+#ifdef __linux__
+    /*!
+        @brief The perf_event_attr type and config of each counter.
+     */
+    const struct
+    {
+        std::uint32_t type;
+        std::uint64_t config;
+    } g_events[CPerfCounters::CounterCount] =
+    {
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES }
+    };
+
+    /*!
+        @brief Opens a disabled counter of the user-space events of the calling thread, on any CPU.
+        @return int The file descriptor, -1 on failure.
+     */
+    int openCounter (std::uint32_t type, std::uint64_t config) noexcept
+    {
+        perf_event_attr attr;
+        std::memset (&attr, 0, sizeof (attr));
+        attr.size = sizeof (attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        return static_cast<int> (syscall (__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+}
+
+CPerfCounters::CPerfCounters () noexcept
+{
+    for (int i = 0; i < CounterCount; ++i)
+#ifdef __linux__
+        m_fds[i] = openCounter (g_events[i].type, g_events[i].config);
+#else
+        m_fds[i] = -1;
+#endif
+}
+
+CPerfCounters::~CPerfCounters () noexcept
+{
+#ifdef __linux__
+    for (int fd : m_fds)
+        if (fd != -1)
+            close (fd);
+#endif
+}
+
+bool CPerfCounters::isAvailable (ECounter counter) const noexcept
+{
+    return m_fds[counter] != -1;
+}
+
+bool CPerfCounters::anyAvailable () const noexcept
+{
+    for (int fd : m_fds)
+        if (fd != -1)
+            return true;
+
+    return false;
+}
+
+const char *CPerfCounters::name (ECounter counter) noexcept
+{
+    static const char *const names[CounterCount] =
+    {
+        "cycles", "instr", "L1D-miss", "LLC-miss", "dTLB-miss", "br-miss"
+    };
+
+    return names[counter];
+}
+
+void CPerfCounters::start () noexcept
+{
+#ifdef __linux__
+    for (int fd : m_fds)
+        if (fd != -1)
+        {
+            ioctl (fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl (fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+
+    m_start = std::chrono::steady_clock::now ();
+}
+
+CPerfCounters::CSample CPerfCounters::stop () noexcept
+{
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+    CSample sample;
+
+    for (int i = 0; i < CounterCount; ++i)
+    {
+        sample.values[i] = 0;
+        sample.available[i] = false;
+
+#ifdef __linux__
+        if (m_fds[i] == -1)
+            continue;
+
+        ioctl (m_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+
+        // The value, then the times the counter was enabled and running, in the order of read_format.
+        std::uint64_t counts[3];
+        if (read (m_fds[i], counts, sizeof (counts)) != sizeof (counts) || counts[2] == 0)
+            continue;
+
+        sample.values[i] = static_cast<double> (counts[0]) * counts[1] / counts[2];
+        sample.available[i] = true;
+#endif
+    }
+
+    sample.nanoseconds = std::chrono::duration<double, std::nano> (end - m_start).count ();
+
+    return sample;
+}
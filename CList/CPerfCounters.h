@@ -0,0 +1,132 @@
+/*!
+@file CPerfCounters.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Hardware performance counters around the measured regions of the benchmarks.
+*/
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/*!
+    @brief Regroups everything related to benchmarks.
+ */
+namespace nsBench
+{
+    /*!
+        @brief CPerfCounters counts the hardware events of the calling thread during a region, with perf_event_open.
+
+               Each counter is opened on its own, so that an event the CPU or the kernel doesn't support, or
+               forbids (perf_event_paranoid, containers), only loses that counter. When none can be opened, or
+               out of Linux, only the wall-clock time is measured. Counters multiplexed by the kernel are scaled
+               to the time the region was running.
+     */
+    class CPerfCounters
+    {
+    public:
+        /*!
+            @brief The events counted.
+         */
+        enum ECounter
+        {
+            Cycles,
+            Instructions,
+            L1DMisses,
+            LLCMisses,
+            DTLBMisses,
+            BranchMisses,
+            CounterCount
+        };
+
+        /*!
+            @brief The counts of a region.
+         */
+        struct CSample
+        {
+            /*!
+                @var nanoseconds
+                @brief The wall-clock time of the region, always measured.
+             */
+            double nanoseconds;
+
+            /*!
+                @var values
+                @brief The count of each event, meaningless if it is not available.
+             */
+            double values[CounterCount];
+
+            /*!
+                @var available
+                @brief If the event could be counted.
+             */
+            bool available[CounterCount];
+        };
+
+        /*!
+            @brief Opens the counters of the calling thread, disabled.
+         */
+        CPerfCounters () noexcept;
+
+        /*!
+            @brief Closes the counters.
+         */
+        ~CPerfCounters () noexcept;
+
+        CPerfCounters (const CPerfCounters &) = delete;
+
+        CPerfCounters &operator= (const CPerfCounters &) = delete;
+
+        /*!
+            @brief  Return true if @p counter could be opened.
+         */
+        bool isAvailable (ECounter counter) const noexcept;
+
+        /*!
+            @brief  Return true if at least one counter could be opened.
+         */
+        bool anyAvailable () const noexcept;
+
+        /*!
+            @brief  Return the short name of @p counter, for the reports.
+         */
+        static const char *name (ECounter counter) noexcept;
+
+        /*!
+            @brief  Resets and enables the counters, then starts the clock.
+         */
+        void start () noexcept;
+
+        /*!
+            @brief  Stops the clock and the counters.
+            @return CSample The counts since @p start.
+         */
+        CSample stop () noexcept;
+
+        /*!
+            @brief  Return the counts of a call to @p f.
+         */
+        template<class Function>
+        CSample measure (Function f) noexcept
+        {
+            start ();
+            f ();
+            return stop ();
+        }
+
+    private:
+        /*!
+            @var m_fds
+            @brief The file descriptor of each counter, -1 if it couldn't be opened.
+         */
+        int m_fds[CounterCount];
+
+        /*!
+            @var m_start
+            @brief When the region started.
+         */
+        std::chrono::steady_clock::time_point m_start;
+    };
+}
@@ -0,0 +1,232 @@
+/*!
+@file CPersistentList.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CPersistentList class.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "CList.h"
+
+namespace nsSdD
+{
+    template<typename T>
+    /*!
+       @brief CPersistentList is a list whose versions are immutable and share their structure, so that it can be
+              published to many reader threads while one writer keeps modifying it.
+
+              The elements are held by a balanced tree (AVL) ordered by position, whose nodes are never modified
+              once built: a write copies only the O(log n) nodes on the path to the position it touches, and
+              shares all the other ones with the previous version. Taking a @p snapshot is O(1), it's a new
+              CPersistentList sharing the current version; a version is freed when the last snapshot holding
+              it is dropped.
+
+              The current version is published atomically: @p snapshot can be called from any thread while the
+              writer modifies the list, readers only ever see complete versions and never wait for the writer.
+              Modifications, and the other accesses to the live list, must come from the writer thread:
+              the other threads read through their snapshots.
+    */
+    class CPersistentList
+    {
+        // Types
+    private:
+        struct CConstIterator;
+
+        struct CTreeNode;
+
+        /*!
+            @typedef CTreePtr
+            @brief A shared pointer to an immutable node of the tree.
+        */
+        typedef std::shared_ptr<const CTreeNode> CTreePtr;
+
+    public:
+        /*!
+            @typedef size_type
+            @brief This define a @p size_t.
+         */
+        typedef size_t size_type;
+
+        /*!
+            @typedef const_iterator
+            @brief Forward iterator on the version it was created from, which it keeps alive.
+         */
+        typedef CConstIterator const_iterator;
+
+        /*!
+            @brief This is the default constructor of an empty CPersistentList.
+         */
+        CPersistentList () noexcept;
+
+        /*!
+            @brief  This is the constructor building the CPersistentList of the elements from @p first to @p last, in O(n).
+            @param[in] first The first element we want to copy.
+            @param[in] last The element following the last one we want to copy.
+         */
+        template<class InputIterator>
+        CPersistentList (InputIterator first, InputIterator last) noexcept;
+
+        /*!
+            @brief This is the copy-constructor, in O(1): the copy shares the current version of @p x.
+         */
+        CPersistentList (const CPersistentList &x) noexcept;
+
+        /*!
+            @brief This is the operator=, in O(1): the CPersistentList shares the current version of @p x.
+         */
+        CPersistentList &operator= (const CPersistentList &x) noexcept;
+
+        /*!
+            @brief  Return the current version, in O(1). Can be called from any thread during modifications.
+         */
+        CPersistentList snapshot () const noexcept;
+
+        /*!
+            @brief  Copies the elements of the current version in a CList.
+         */
+        CList<T> toList () const noexcept;
+
+        // iterators
+        /*!
+            @brief  This function return a const_iterator to the begin of the current version.
+         */
+        const_iterator cbegin () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the end of any version.
+         */
+        const_iterator cend () const noexcept;
+
+        // Capacity
+        /*!
+            @brief  This function return true if the CPersistentList is empty, false otherwise.
+         */
+        bool empty () const noexcept;
+
+        /*!
+            @brief  This function return the number of elements, in O(1).
+         */
+        size_type size () const noexcept;
+
+        // Element access
+        /*!
+            @brief  This function return the element at @p index, in O(log n).
+         */
+        const T &at (size_type index) const noexcept;
+
+        /*!
+            @brief  This function return the first element.
+         */
+        const T &front () const noexcept;
+
+        /*!
+            @brief  This function return the last element.
+         */
+        const T &back () const noexcept;
+
+        // Modifiers, O(log n) each
+        /*!
+            @brief  This function adds @p x at the end.
+         */
+        void push_back (const T &x) noexcept;
+
+        /*!
+            @brief  This function adds @p x at the beginning.
+         */
+        void push_front (const T &x) noexcept;
+
+        /*!
+            @brief  This function removes the last element, if any.
+         */
+        void pop_back () noexcept;
+
+        /*!
+            @brief  This function removes the first element, if any.
+         */
+        void pop_front () noexcept;
+
+        /*!
+            @brief  This function inserts @p val so that it becomes the element at @p index.
+            @param[in] index The position of the new element, up to size ().
+            @param[in] val The value we want to insert.
+         */
+        void insert (size_type index, const T &val) noexcept;
+
+        /*!
+            @brief  This function erases the element at @p index.
+         */
+        void erase (size_type index) noexcept;
+
+        /*!
+            @brief  This function replaces the element at @p index by @p val.
+         */
+        void set (size_type index, const T &val) noexcept;
+
+        /*!
+            @brief  This function removes all the elements, the snapshots keep theirs.
+         */
+        void clear () noexcept;
+
+    private:
+        /*!
+            @brief  Return the number of elements under @p node.
+         */
+        static size_type sizeOf (const CTreePtr &node) noexcept;
+
+        /*!
+            @brief  Return the height of @p node, 0 for none.
+         */
+        static int heightOf (const CTreePtr &node) noexcept;
+
+        /*!
+            @brief  Return a new node holding @p val between @p left and @p right, rotated if their heights differ by 2.
+         */
+        static CTreePtr balance (const T &val, const CTreePtr &left, const CTreePtr &right) noexcept;
+
+        /*!
+            @brief  Return the tree of the elements from @p first to @p last, perfectly balanced.
+         */
+        template<class RandomIterator>
+        static CTreePtr build (RandomIterator first, RandomIterator last) noexcept;
+
+        /*!
+            @brief  Return a copy of @p node in which @p val was inserted at @p index.
+         */
+        static CTreePtr insertAt (const CTreePtr &node, size_type index, const T &val) noexcept;
+
+        /*!
+            @brief  Return a copy of @p node from which the element at @p index was erased.
+         */
+        static CTreePtr eraseAt (const CTreePtr &node, size_type index) noexcept;
+
+        /*!
+            @brief  Return a copy of @p node in which the element at @p index was replaced by @p val.
+         */
+        static CTreePtr setAt (const CTreePtr &node, size_type index, const T &val) noexcept;
+
+        /*!
+            @brief  Return the node holding the element at @p index under @p node.
+         */
+        static const CTreeNode *nodeAt (const CTreeNode *node, size_type index) noexcept;
+
+        /*!
+            @brief  Publishes @p root as the current version.
+         */
+        void publish (CTreePtr root) noexcept;
+
+        /*!
+          @var     m_root
+          @brief  The root of the current version, only modified through atomic stores.
+       */
+        CTreePtr m_root;
+    };
+}
+
+#include "CPersistentList.hxx"
@@ -0,0 +1,363 @@
+/*!
+@file CPersistentList.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CPersistentList class and iterator implementation.
+*/
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+
+#include "CPersistentList.h"
+
+/*!
+    @brief Immutable node of the tree: its value, its children, and the size and height of its subtree.
+ */
+template<typename T>
+struct nsSdD::CPersistentList<T>::CTreeNode
+{
+    const T value;
+    const CTreePtr left;
+    const CTreePtr right;
+    const size_type size;
+    const int height;
+
+    CTreeNode (const T &val, const CTreePtr &l, const CTreePtr &r) noexcept
+            : value (val), left (l), right (r), size (sizeOf (l) + sizeOf (r) + 1),
+              height (std::max (heightOf (l), heightOf (r)) + 1)
+    {
+    }
+};
+
+/*!
+    @brief In-order iterator of a version of CPersistentList. It holds the root of its version, which can't be
+            freed nor modified while it exists.
+ */
+template<typename T>
+struct nsSdD::CPersistentList<T>::CConstIterator : public std::iterator<std::forward_iterator_tag, const T, std::ptrdiff_t, const T *, const T &>
+{
+private:
+    /*!
+        @var root
+        @brief The root of the version iterated.
+    */
+    CTreePtr root;
+
+    /*!
+        @var path
+        @brief The nodes whose element is still to visit, the current one on top. Empty at the end.
+    */
+    std::vector<const CTreeNode *> path;
+
+    /*!
+        @brief Pushes @p node and its leftmost descendants on the path.
+    */
+    void descend (const CTreeNode *node) noexcept
+    {
+        for (; node; node = node->left.get ())
+            path.push_back (node);
+    }
+
+public:
+    CConstIterator () noexcept
+    {
+    }
+
+    explicit CConstIterator (const CTreePtr &r) noexcept : root (r)
+    {
+        descend (root.get ());
+    }
+
+    bool operator== (const CConstIterator &other) const noexcept
+    {
+        return path.empty () ? other.path.empty () : !other.path.empty () && path.back () == other.path.back ();
+    }
+
+    bool operator!= (const CConstIterator &other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    CConstIterator &operator++ () noexcept
+    {
+        const CTreeNode *current = path.back ();
+        path.pop_back ();
+        descend (current->right.get ());
+        return *this;
+    }
+
+    CConstIterator operator++ (int) noexcept
+    {
+        CConstIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    const T *operator-> () const noexcept
+    {
+        return &path.back ()->value;
+    }
+
+    const T &operator* () const noexcept
+    {
+        return path.back ()->value;
+    }
+};
+
+template<typename T>
+nsSdD::CPersistentList<T>::CPersistentList () noexcept
+{
+}
+
+template<typename T>
+template<class InputIterator>
+nsSdD::CPersistentList<T>::CPersistentList (InputIterator first, InputIterator last) noexcept
+{
+    std::vector<T> values (first, last);
+    m_root = build (values.cbegin (), values.cend ());
+}
+
+template<typename T>
+nsSdD::CPersistentList<T>::CPersistentList (const CPersistentList &x) noexcept : m_root (std::atomic_load (&x.m_root))
+{
+}
+
+template<typename T>
+nsSdD::CPersistentList<T> &nsSdD::CPersistentList<T>::operator= (const CPersistentList &x) noexcept
+{
+    publish (std::atomic_load (&x.m_root));
+    return *this;
+}
+
+template<typename T>
+nsSdD::CPersistentList<T> nsSdD::CPersistentList<T>::snapshot () const noexcept
+{
+    return *this;
+}
+
+template<typename T>
+nsSdD::CList<T> nsSdD::CPersistentList<T>::toList () const noexcept
+{
+    CList<T> list;
+    for (const_iterator itr = cbegin (); itr != cend (); ++itr)
+        list.push_back (*itr);
+
+    return list;
+}
+
+template<typename T>
+typename nsSdD::CPersistentList<T>::const_iterator nsSdD::CPersistentList<T>::cbegin () const noexcept
+{
+    return const_iterator (std::atomic_load (&m_root));
+}
+
+template<typename T>
+typename nsSdD::CPersistentList<T>::const_iterator nsSdD::CPersistentList<T>::cend () const noexcept
+{
+    return const_iterator ();
+}
+
+template<typename T>
+bool nsSdD::CPersistentList<T>::empty () const noexcept
+{
+    return size () == 0;
+}
+
+template<typename T>
+typename nsSdD::CPersistentList<T>::size_type nsSdD::CPersistentList<T>::size () const noexcept
+{
+    return sizeOf (m_root);
+}
+
+template<typename T>
+const T &nsSdD::CPersistentList<T>::at (size_type index) const noexcept
+{
+    return nodeAt (m_root.get (), index)->value;
+}
+
+template<typename T>
+const T &nsSdD::CPersistentList<T>::front () const noexcept
+{
+    return at (0);
+}
+
+template<typename T>
+const T &nsSdD::CPersistentList<T>::back () const noexcept
+{
+    return at (size () - 1);
+}
+
+template<typename T>
+void nsSdD::CPersistentList<T>::push_back (const T &x) noexcept
+{
+    insert (size (), x);
+}
+
+template<typename T>
+void nsSdD::CPersistentList<T>::push_front (const T &x) noexcept
+{
+    insert (0, x);
+}
+
+template<typename T>
+void nsSdD::CPersistentList<T>::pop_back () noexcept
+{
+    if (!empty ())
+        erase (size () - 1);
+}
+
+template<typename T>
+void nsSdD::CPersistentList<T>::pop_front () noexcept
+{
+    if (!empty ())
+        erase (0);
+}
+
+template<typename T>
+void nsSdD::CPersistentList<T>::insert (size_type index, const T &val) noexcept
+{
+    publish (insertAt (m_root, index, val));
+}
+
+template<typename T>
+void nsSdD::CPersistentList<T>::erase (size_type index) noexcept
+{
+    publish (eraseAt (m_root, index));
+}
+
+template<typename T>
+void nsSdD::CPersistentList<T>::set (size_type index, const T &val) noexcept
+{
+    publish (setAt (m_root, index, val));
+}
+
+template<typename T>
+void nsSdD::CPersistentList<T>::clear () noexcept
+{
+    publish (nullptr);
+}
+
+template<typename T>
+typename nsSdD::CPersistentList<T>::size_type nsSdD::CPersistentList<T>::sizeOf (const CTreePtr &node) noexcept
+{
+    return node ? node->size : 0;
+}
+
+template<typename T>
+int nsSdD::CPersistentList<T>::heightOf (const CTreePtr &node) noexcept
+{
+    return node ? node->height : 0;
+}
+
+template<typename T>
+typename nsSdD::CPersistentList<T>::CTreePtr nsSdD::CPersistentList<T>::balance (const T &val, const CTreePtr &left, const CTreePtr &right) noexcept
+{
+    const int leftHeight = heightOf (left), rightHeight = heightOf (right);
+
+    if (leftHeight > rightHeight + 1)
+    {
+        if (heightOf (left->left) >= heightOf (left->right))
+            return std::make_shared<const CTreeNode> (left->value, left->left,
+                                                      std::make_shared<const CTreeNode> (val, left->right, right));
+
+        const CTreePtr &pivot = left->right;
+        return std::make_shared<const CTreeNode> (pivot->value,
+                                                  std::make_shared<const CTreeNode> (left->value, left->left, pivot->left),
+                                                  std::make_shared<const CTreeNode> (val, pivot->right, right));
+    }
+
+    if (rightHeight > leftHeight + 1)
+    {
+        if (heightOf (right->right) >= heightOf (right->left))
+            return std::make_shared<const CTreeNode> (right->value,
+                                                      std::make_shared<const CTreeNode> (val, left, right->left), right->right);
+
+        const CTreePtr &pivot = right->left;
+        return std::make_shared<const CTreeNode> (pivot->value,
+                                                  std::make_shared<const CTreeNode> (val, left, pivot->left),
+                                                  std::make_shared<const CTreeNode> (right->value, pivot->right, right->right));
+    }
+
+    return std::make_shared<const CTreeNode> (val, left, right);
+}
+
+template<typename T>
+template<class RandomIterator>
+typename nsSdD::CPersistentList<T>::CTreePtr nsSdD::CPersistentList<T>::build (RandomIterator first, RandomIterator last) noexcept
+{
+    if (first == last)
+        return nullptr;
+
+    RandomIterator middle = first + (last - first) / 2;
+    return std::make_shared<const CTreeNode> (*middle, build (first, middle), build (middle + 1, last));
+}
+
+template<typename T>
+typename nsSdD::CPersistentList<T>::CTreePtr nsSdD::CPersistentList<T>::insertAt (const CTreePtr &node, size_type index, const T &val) noexcept
+{
+    if (!node)
+        return std::make_shared<const CTreeNode> (val, nullptr, nullptr);
+
+    const size_type leftSize = sizeOf (node->left);
+    if (index <= leftSize)
+        return balance (node->value, insertAt (node->left, index, val), node->right);
+
+    return balance (node->value, node->left, insertAt (node->right, index - leftSize - 1, val));
+}
+
+template<typename T>
+typename nsSdD::CPersistentList<T>::CTreePtr nsSdD::CPersistentList<T>::eraseAt (const CTreePtr &node, size_type index) noexcept
+{
+    const size_type leftSize = sizeOf (node->left);
+    if (index < leftSize)
+        return balance (node->value, eraseAt (node->left, index), node->right);
+    if (index > leftSize)
+        return balance (node->value, node->left, eraseAt (node->right, index - leftSize - 1));
+
+    if (!node->left)
+        return node->right;
+    if (!node->right)
+        return node->left;
+
+    // The erased node is replaced by the first element of its right subtree.
+    return balance (nodeAt (node->right.get (), 0)->value, node->left, eraseAt (node->right, 0));
+}
+
+template<typename T>
+typename nsSdD::CPersistentList<T>::CTreePtr nsSdD::CPersistentList<T>::setAt (const CTreePtr &node, size_type index, const T &val) noexcept
+{
+    const size_type leftSize = sizeOf (node->left);
+    if (index < leftSize)
+        return std::make_shared<const CTreeNode> (node->value, setAt (node->left, index, val), node->right);
+    if (index > leftSize)
+        return std::make_shared<const CTreeNode> (node->value, node->left, setAt (node->right, index - leftSize - 1, val));
+
+    return std::make_shared<const CTreeNode> (val, node->left, node->right);
+}
+
+template<typename T>
+const typename nsSdD::CPersistentList<T>::CTreeNode *nsSdD::CPersistentList<T>::nodeAt (const CTreeNode *node, size_type index) noexcept
+{
+    for (;;)
+    {
+        const size_type leftSize = sizeOf (node->left);
+        if (index == leftSize)
+            return node;
+
+        if (index < leftSize)
+            node = node->left.get ();
+        else
+        {
+            index -= leftSize + 1;
+            node = node->right.get ();
+        }
+    }
+}
+
+template<typename T>
+void nsSdD::CPersistentList<T>::publish (CTreePtr root) noexcept
+{
+    std::atomic_store (&m_root, std::move (root));
+}
@@ -0,0 +1,409 @@
+/*!
+@file CRcuList.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CRcuList class.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace nsSdD
+{
+    template<typename T>
+    /*!
+       @brief CRcuList is a list read without locks by many threads while a single writer modifies it, in the
+              manner of read-copy-update.
+
+              Readers traverse the list inside read-side critical sections (CReadGuard), which only store the
+              current epoch in a slot of their own: no lock, no atomic read-modify-write, so that reading scales
+              with the number of reader threads. The writer publishes every insertion, erasure and splice with
+              a single release store of a link, readers see each of them entirely or not at all.
+
+              Erased nodes are not freed at once, since readers may still be on them: they are retired with the
+              current epoch, and freed once every reader that may have seen them left its critical section
+              (epoch-based reclamation). The elements are immutable once published: @p replace publishes a
+              new node instead of modifying one.
+
+              All the modifiers, and the writer side iterators, must be used by one thread at a time.
+    */
+    class CRcuList
+    {
+        // Types
+    private:
+        /*!
+            @brief The links of a node, alone in the sentinel before the first node.
+                    Readers only follow m_next, m_previous is only used by the writer.
+         */
+        struct CLink
+        {
+            std::atomic<CLink *> m_next;
+            CLink *m_previous;
+        };
+
+        struct CNode;
+
+        struct CIterator;
+
+        struct CConstIterator;
+
+        /*!
+            @brief The epoch announced by a reader, alone in its cache line so that readers don't share lines.
+         */
+        struct alignas (64) CReaderSlot
+        {
+            std::atomic<std::uint64_t> epoch;
+            bool used;
+        };
+
+        /*!
+            @brief An erased node, and the epoch when it was erased.
+         */
+        struct CRetired
+        {
+            CNode *node;
+            std::uint64_t epoch;
+        };
+
+    public:
+        class CReader;
+
+        class CReadGuard;
+
+        /*!
+            @typedef size_type
+            @brief This define a @p size_t.
+         */
+        typedef size_t size_type;
+
+        /*!
+            @typedef iterator
+            @brief Forward iterator of the writer, giving the positions of the modifiers.
+         */
+        typedef CIterator iterator;
+
+        /*!
+            @typedef const_iterator
+            @brief Forward iterator of the readers, only valid inside a read-side critical section.
+         */
+        typedef CConstIterator const_iterator;
+
+        /*!
+            @brief  This is the constructor of an empty CRcuList.
+            @param[in] maxReaders The maximum number of CReader registered at the same time.
+         */
+        explicit CRcuList (size_type maxReaders = 64) noexcept;
+
+        CRcuList (const CRcuList &) = delete;
+
+        CRcuList &operator= (const CRcuList &) = delete;
+
+        /*!
+            @brief The destructor frees all the nodes, no reader may be registered anymore.
+         */
+        ~CRcuList () noexcept;
+
+        // Readers
+        /*!
+            @brief  Registers a reader, to be kept by a thread for its read-side critical sections.
+                    Registering takes a lock, entering a critical section doesn't.
+            @return CReader The reader, invalid if @p maxReaders are already registered.
+         */
+        CReader reader () noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the begin, inside a read-side critical section.
+         */
+        const_iterator cbegin () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the end.
+         */
+        const_iterator cend () const noexcept;
+
+        /*!
+            @brief  This function return the number of elements, as last published by the writer.
+         */
+        size_type size () const noexcept;
+
+        /*!
+            @brief  This function return true if the CRcuList is empty, false otherwise.
+         */
+        bool empty () const noexcept;
+
+        // Writer
+        /*!
+            @brief  This function return an iterator to the begin, for the writer.
+         */
+        iterator begin () noexcept;
+
+        /*!
+            @brief  This function return an iterator to the end, for the writer.
+         */
+        iterator end () noexcept;
+
+        /*!
+            @brief  This function publishes @p val before @p position.
+            @return An iterator to the new element.
+         */
+        iterator insert (iterator position, const T &val) noexcept;
+
+        /*!
+            @brief  This function publishes @p x at the end.
+         */
+        void push_back (const T &x) noexcept;
+
+        /*!
+            @brief  This function publishes @p x at the beginning.
+         */
+        void push_front (const T &x) noexcept;
+
+        /*!
+            @brief  This function unlinks the element at @p position and retires its node.
+            @return An iterator to the element that followed it.
+         */
+        iterator erase (iterator position) noexcept;
+
+        /*!
+            @brief  This function unlinks the first element and retires its node, if the CRcuList is not empty.
+         */
+        void pop_front () noexcept;
+
+        /*!
+            @brief  This function publishes a copy of the element at @p position holding @p val, and retires the old one.
+            @return An iterator to the new element.
+         */
+        iterator replace (iterator position, const T &val) noexcept;
+
+        /*!
+            @brief  This function moves the elements of @p x between @p first and @p last before @p position.
+                    The range is unlinked from @p x, then relinked once the readers of @p x that may be on it
+                    left their critical sections: no reader ever follows a moved node into another list or
+                    another place. @p x may be this CRcuList, @p position must not be in the range.
+         */
+        void splice (iterator position, CRcuList &x, iterator first, iterator last) noexcept;
+
+        /*!
+            @brief  This function moves all the elements of @p x before @p position.
+         */
+        void splice (iterator position, CRcuList &x) noexcept;
+
+        /*!
+            @brief  This function unlinks all the elements and retires their nodes.
+         */
+        void clear () noexcept;
+
+        // Reclamation
+        /*!
+            @brief  Waits until every reader in a critical section that started before the call has left it,
+                    then frees all the retired nodes.
+         */
+        void synchronize () noexcept;
+
+        /*!
+            @brief  Frees the retired nodes that no reader can see anymore, without waiting.
+         */
+        void reclaim () noexcept;
+
+        /*!
+            @brief  This function return the number of retired nodes not freed yet.
+         */
+        size_type pending () const noexcept;
+
+    private:
+        /*!
+            @brief  Adds @p node to the retired nodes, reclaiming them when there are enough of them.
+         */
+        void retire (CNode *node) noexcept;
+
+        /*!
+            @brief  Starts a new epoch and return the previous one: the nodes retired until then are freed
+                    once no reader announces this epoch or an older one.
+         */
+        std::uint64_t advanceEpoch () noexcept;
+
+        /*!
+            @brief  Return the oldest epoch announced by a reader in its critical section, or @p none if there is none.
+         */
+        std::uint64_t oldestReader (std::uint64_t none) const noexcept;
+
+        /*!
+            @brief  Frees the retired nodes older than @p epoch.
+         */
+        void freeRetired (std::uint64_t epoch) noexcept;
+
+        /*!
+            @brief  Links the unpublished chain from @p first to @p last before @p position, publishing it with
+                    a single release store.
+         */
+        void link (CLink *position, CLink *first, CLink *last) noexcept;
+
+        /*!
+            @brief  Unlinks the chain from @p first to @p last with a single release store. Readers on the chain
+                    still follow it to the rest of the list.
+         */
+        void unlink (CLink *first, CLink *last) noexcept;
+
+        /*!
+            @brief  Return the link after which @p position, nullptr being the end, links.
+         */
+        CLink *previousOf (CLink *position) noexcept;
+
+        /*!
+          @var     m_head
+          @brief  The sentinel before the first node, holding no value.
+       */
+        CLink m_head;
+
+        /*!
+          @var     m_tail
+          @brief  The last node, &m_head if the list is empty. Only used by the writer.
+       */
+        CLink *m_tail;
+
+        /*!
+          @var     m_size
+          @brief  The number of elements, stored by the writer.
+       */
+        std::atomic<size_type> m_size;
+
+        /*!
+          @var     m_epoch
+          @brief  The current epoch, only advanced by the writer.
+       */
+        std::atomic<std::uint64_t> m_epoch;
+
+        /*!
+          @var     m_slotBuffer
+          @brief  The memory of the slots, allocated with room to align them on a cache line.
+       */
+        std::unique_ptr<char[]> m_slotBuffer;
+
+        /*!
+          @var     m_slots
+          @brief  The epochs announced by the readers, 0 when out of a critical section.
+       */
+        CReaderSlot *m_slots;
+
+        /*!
+          @var     m_slotCount
+          @brief  The number of slots.
+       */
+        size_type m_slotCount;
+
+        /*!
+          @var     m_slotsMutex
+          @brief  Protects the registration of the readers.
+       */
+        std::mutex m_slotsMutex;
+
+        /*!
+          @var     m_retired
+          @brief  The nodes erased but maybe still seen by readers, oldest first.
+       */
+        std::vector<CRetired> m_retired;
+    };
+
+    template<typename T>
+    /*!
+       @brief A reader registered to a CRcuList, owning a slot where it announces its critical sections.
+              It must be used by a single thread at a time.
+    */
+    class CRcuList<T>::CReader
+    {
+    public:
+        /*!
+            @brief This is the move-constructor, @p x doesn't own its slot anymore.
+         */
+        CReader (CReader &&x) noexcept;
+
+        CReader (const CReader &) = delete;
+
+        CReader &operator= (const CReader &) = delete;
+
+        /*!
+            @brief The destructor releases the slot.
+         */
+        ~CReader () noexcept;
+
+        /*!
+            @brief  Return true if a slot was available for this reader, false otherwise.
+         */
+        bool isValid () const noexcept;
+
+        /*!
+            @brief  Enters a read-side critical section: the nodes seen until @p unlock won't be freed.
+         */
+        void lock () noexcept;
+
+        /*!
+            @brief  Leaves the read-side critical section.
+         */
+        void unlock () noexcept;
+
+    private:
+        friend class CRcuList<T>;
+
+        /*!
+            @brief This is the constructor of the reader owning @p slot in @p list.
+         */
+        CReader (CRcuList<T> *list, CReaderSlot *slot) noexcept;
+
+        /*!
+            @var m_list
+            @brief The CRcuList read.
+         */
+        CRcuList<T> *m_list;
+
+        /*!
+            @var m_slot
+            @brief The slot of the reader, nullptr if none was available.
+         */
+        CReaderSlot *m_slot;
+    };
+
+    template<typename T>
+    /*!
+       @brief Read-side critical section for the lifetime of the guard.
+    */
+    class CRcuList<T>::CReadGuard
+    {
+    public:
+        /*!
+            @brief Enters a critical section with @p reader.
+         */
+        explicit CReadGuard (CReader &reader) noexcept : m_reader (reader)
+        {
+            m_reader.lock ();
+        }
+
+        /*!
+            @brief Leaves the critical section.
+         */
+        ~CReadGuard () noexcept
+        {
+            m_reader.unlock ();
+        }
+
+        CReadGuard (const CReadGuard &) = delete;
+
+        CReadGuard &operator= (const CReadGuard &) = delete;
+
+    private:
+        /*!
+            @var m_reader
+            @brief The reader in the critical section.
+         */
+        CReader &m_reader;
+    };
+}
+
+#include "CRcuList.hxx"
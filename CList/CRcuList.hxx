@@ -0,0 +1,492 @@
+/*!
+@file CRcuList.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CRcuList class, readers and iterators implementation.
+*/
+#pragma once
+
+#include <limits>
+#include <new>
+#include <thread>
+
+#include "CRcuList.h"
+
+namespace
+{
+    /*!
+        @brief The number of retired nodes from which the writer tries to free them.
+     */
+    const size_t g_rcuReclaimThreshold = 64;
+}
+
+/*!
+    @brief A node of CRcuList, whose value never changes once published.
+ */
+template<typename T>
+struct nsSdD::CRcuList<T>::CNode : public CLink
+{
+    const T m_value;
+
+    explicit CNode (const T &val) noexcept : m_value (val)
+    {
+        this->m_next.store (nullptr, std::memory_order_relaxed);
+        this->m_previous = nullptr;
+    }
+};
+
+/*!
+    @brief Forward iterator of the writer, it reads the links it wrote itself.
+ */
+template<typename T>
+struct nsSdD::CRcuList<T>::CIterator : public std::iterator<std::forward_iterator_tag, const T, std::ptrdiff_t, const T *, const T &>
+{
+private:
+    /*!
+        @var node
+        @brief The current node of the iterator, nullptr at the end.
+    */
+    CLink *node;
+
+public:
+    CIterator (CLink *p = nullptr) noexcept : node (p)
+    {
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return node == other.node;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return node != other.node;
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        node = node->m_next.load (std::memory_order_relaxed);
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    const T *operator-> () const noexcept
+    {
+        return &static_cast<CNode *> (node)->m_value;
+    }
+
+    const T &operator* () const noexcept
+    {
+        return static_cast<CNode *> (node)->m_value;
+    }
+
+    /*!
+      @brief The function return the node the iterator is on.
+   */
+    CLink *getNode () const noexcept
+    {
+        return node;
+    }
+};
+
+/*!
+    @brief Forward iterator of the readers, acquiring every link so that the nodes published are seen complete.
+ */
+template<typename T>
+struct nsSdD::CRcuList<T>::CConstIterator : public std::iterator<std::forward_iterator_tag, const T, std::ptrdiff_t, const T *, const T &>
+{
+private:
+    /*!
+        @var node
+        @brief The current node of the iterator, nullptr at the end.
+    */
+    const CLink *node;
+
+public:
+    CConstIterator (const CLink *p = nullptr) noexcept : node (p)
+    {
+    }
+
+    bool operator== (const CConstIterator &other) const noexcept
+    {
+        return node == other.node;
+    }
+
+    bool operator!= (const CConstIterator &other) const noexcept
+    {
+        return node != other.node;
+    }
+
+    CConstIterator &operator++ () noexcept
+    {
+        node = node->m_next.load (std::memory_order_acquire);
+        return *this;
+    }
+
+    CConstIterator operator++ (int) noexcept
+    {
+        CConstIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    const T *operator-> () const noexcept
+    {
+        return &static_cast<const CNode *> (node)->m_value;
+    }
+
+    const T &operator* () const noexcept
+    {
+        return static_cast<const CNode *> (node)->m_value;
+    }
+};
+
+template<typename T>
+nsSdD::CRcuList<T>::CReader::CReader (CRcuList<T> *list, CReaderSlot *slot) noexcept : m_list (list), m_slot (slot)
+{
+}
+
+template<typename T>
+nsSdD::CRcuList<T>::CReader::CReader (CReader &&x) noexcept : m_list (x.m_list), m_slot (x.m_slot)
+{
+    x.m_slot = nullptr;
+}
+
+template<typename T>
+nsSdD::CRcuList<T>::CReader::~CReader () noexcept
+{
+    if (!m_slot)
+        return;
+
+    std::lock_guard<std::mutex> lock (m_list->m_slotsMutex);
+    m_slot->used = false;
+}
+
+template<typename T>
+bool nsSdD::CRcuList<T>::CReader::isValid () const noexcept
+{
+    return m_slot != nullptr;
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::CReader::lock () noexcept
+{
+    // Acquiring the epoch makes the unlinks done before it visible. It may be stale, which only delays the
+    // reclamation. The fence orders the announce before the reads of the links, against the fence of the
+    // writer between its unlinks and its scan of the slots.
+    m_slot->epoch.store (m_list->m_epoch.load (std::memory_order_acquire), std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::CReader::unlock () noexcept
+{
+    m_slot->epoch.store (0, std::memory_order_release);
+}
+
+template<typename T>
+nsSdD::CRcuList<T>::CRcuList (size_type maxReaders) noexcept
+        : m_tail (&m_head), m_size (0), m_epoch (1), m_slotBuffer (new char[(maxReaders + 1) * sizeof (CReaderSlot)]),
+          m_slotCount (maxReaders)
+{
+    m_head.m_next.store (nullptr, std::memory_order_relaxed);
+    m_head.m_previous = nullptr;
+
+    void *buffer = m_slotBuffer.get ();
+    size_t space = (maxReaders + 1) * sizeof (CReaderSlot);
+    m_slots = static_cast<CReaderSlot *> (std::align (alignof (CReaderSlot), maxReaders * sizeof (CReaderSlot), buffer, space));
+    for (size_type i = 0; i < m_slotCount; ++i)
+    {
+        new (m_slots + i) CReaderSlot ();
+        m_slots[i].epoch.store (0, std::memory_order_relaxed);
+        m_slots[i].used = false;
+    }
+}
+
+template<typename T>
+nsSdD::CRcuList<T>::~CRcuList () noexcept
+{
+    for (CLink *node = m_head.m_next.load (std::memory_order_relaxed); node;)
+    {
+        CLink *next = node->m_next.load (std::memory_order_relaxed);
+        delete static_cast<CNode *> (node);
+        node = next;
+    }
+
+    freeRetired (std::numeric_limits<std::uint64_t>::max ());
+
+    for (size_type i = 0; i < m_slotCount; ++i)
+        m_slots[i].~CReaderSlot ();
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::CReader nsSdD::CRcuList<T>::reader () noexcept
+{
+    std::lock_guard<std::mutex> lock (m_slotsMutex);
+    for (size_type i = 0; i < m_slotCount; ++i)
+        if (!m_slots[i].used)
+        {
+            m_slots[i].used = true;
+            return CReader (this, m_slots + i);
+        }
+
+    return CReader (this, nullptr);
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::const_iterator nsSdD::CRcuList<T>::cbegin () const noexcept
+{
+    return const_iterator (m_head.m_next.load (std::memory_order_acquire));
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::const_iterator nsSdD::CRcuList<T>::cend () const noexcept
+{
+    return const_iterator ();
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::size_type nsSdD::CRcuList<T>::size () const noexcept
+{
+    return m_size.load (std::memory_order_relaxed);
+}
+
+template<typename T>
+bool nsSdD::CRcuList<T>::empty () const noexcept
+{
+    return size () == 0;
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::iterator nsSdD::CRcuList<T>::begin () noexcept
+{
+    return iterator (m_head.m_next.load (std::memory_order_relaxed));
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::iterator nsSdD::CRcuList<T>::end () noexcept
+{
+    return iterator ();
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::iterator nsSdD::CRcuList<T>::insert (iterator position, const T &val) noexcept
+{
+    CNode *node = new CNode (val);
+    link (position.getNode (), node, node);
+    m_size.store (size () + 1, std::memory_order_relaxed);
+
+    return iterator (node);
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::push_back (const T &x) noexcept
+{
+    insert (end (), x);
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::push_front (const T &x) noexcept
+{
+    insert (begin (), x);
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::iterator nsSdD::CRcuList<T>::erase (iterator position) noexcept
+{
+    CLink *node = position.getNode ();
+    CLink *next = node->m_next.load (std::memory_order_relaxed);
+
+    unlink (node, node);
+    m_size.store (size () - 1, std::memory_order_relaxed);
+    retire (static_cast<CNode *> (node));
+
+    return iterator (next);
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::pop_front () noexcept
+{
+    if (!empty ())
+        erase (begin ());
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::iterator nsSdD::CRcuList<T>::replace (iterator position, const T &val) noexcept
+{
+    CLink *old = position.getNode ();
+    CLink *previous = old->m_previous;
+    CLink *next = old->m_next.load (std::memory_order_relaxed);
+    CNode *node = new CNode (val);
+
+    // Readers on the old node keep following it to the next one.
+    node->m_next.store (next, std::memory_order_relaxed);
+    node->m_previous = previous;
+    if (next)
+        next->m_previous = node;
+    else
+        m_tail = node;
+    previous->m_next.store (node, std::memory_order_release);
+
+    retire (static_cast<CNode *> (old));
+
+    return iterator (node);
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::splice (iterator position, CRcuList &x, iterator first, iterator last) noexcept
+{
+    if (first == last)
+        return;
+
+    size_type count = 1;
+    CLink *lastNode = first.getNode ();
+    for (CLink *next; (next = lastNode->m_next.load (std::memory_order_relaxed)) != last.getNode (); lastNode = next)
+        ++count;
+
+    x.unlink (first.getNode (), lastNode);
+    if (&x != this)
+    {
+        x.m_size.store (x.size () - count, std::memory_order_relaxed);
+        m_size.store (size () + count, std::memory_order_relaxed);
+    }
+
+    // The readers of x on the range must be gone before its last link is redirected.
+    x.synchronize ();
+    link (position.getNode (), first.getNode (), lastNode);
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::splice (iterator position, CRcuList &x) noexcept
+{
+    splice (position, x, x.begin (), x.end ());
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::clear () noexcept
+{
+    CLink *node = m_head.m_next.load (std::memory_order_relaxed);
+    if (!node)
+        return;
+
+    unlink (node, m_tail);
+    m_size.store (0, std::memory_order_relaxed);
+
+    while (node)
+    {
+        CLink *next = node->m_next.load (std::memory_order_relaxed);
+        retire (static_cast<CNode *> (node));
+        node = next;
+    }
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::synchronize () noexcept
+{
+    const std::uint64_t epoch = advanceEpoch ();
+
+    while (oldestReader (std::numeric_limits<std::uint64_t>::max ()) <= epoch)
+        std::this_thread::yield ();
+
+    freeRetired (epoch + 1);
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::reclaim () noexcept
+{
+    if (m_retired.empty ())
+        return;
+
+    advanceEpoch ();
+    freeRetired (oldestReader (std::numeric_limits<std::uint64_t>::max ()));
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::size_type nsSdD::CRcuList<T>::pending () const noexcept
+{
+    return m_retired.size ();
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::retire (CNode *node) noexcept
+{
+    m_retired.push_back (CRetired {node, m_epoch.load (std::memory_order_relaxed)});
+    if (m_retired.size () >= g_rcuReclaimThreshold)
+        reclaim ();
+}
+
+template<typename T>
+std::uint64_t nsSdD::CRcuList<T>::advanceEpoch () noexcept
+{
+    // Only the writer advances the epoch, a plain store is enough.
+    const std::uint64_t epoch = m_epoch.load (std::memory_order_relaxed);
+    m_epoch.store (epoch + 1, std::memory_order_release);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+
+    return epoch;
+}
+
+template<typename T>
+std::uint64_t nsSdD::CRcuList<T>::oldestReader (std::uint64_t none) const noexcept
+{
+    std::uint64_t oldest = none;
+    for (size_type i = 0; i < m_slotCount; ++i)
+    {
+        const std::uint64_t epoch = m_slots[i].epoch.load (std::memory_order_acquire);
+        if (epoch && epoch < oldest)
+            oldest = epoch;
+    }
+
+    return oldest;
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::freeRetired (std::uint64_t epoch) noexcept
+{
+    size_type freed = 0;
+    for (; freed < m_retired.size () && m_retired[freed].epoch < epoch; ++freed)
+        delete m_retired[freed].node;
+
+    m_retired.erase (m_retired.begin (), m_retired.begin () + freed);
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::link (CLink *position, CLink *first, CLink *last) noexcept
+{
+    CLink *previous = previousOf (position);
+
+    last->m_next.store (position, std::memory_order_relaxed);
+    first->m_previous = previous;
+    if (position)
+        position->m_previous = last;
+    else
+        m_tail = last;
+
+    previous->m_next.store (first, std::memory_order_release);
+}
+
+template<typename T>
+void nsSdD::CRcuList<T>::unlink (CLink *first, CLink *last) noexcept
+{
+    CLink *previous = first->m_previous;
+    CLink *next = last->m_next.load (std::memory_order_relaxed);
+
+    previous->m_next.store (next, std::memory_order_release);
+    if (next)
+        next->m_previous = previous;
+    else
+        m_tail = previous;
+}
+
+template<typename T>
+typename nsSdD::CRcuList<T>::CLink *nsSdD::CRcuList<T>::previousOf (CLink *position) noexcept
+{
+    return position ? position->m_previous : m_tail;
+}
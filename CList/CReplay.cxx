@@ -0,0 +1,627 @@
+#include "CReplay.h"
+#include "CHugePageArena.h"
+#include "CList.h"
+#include "CListTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace nsBench;
+using namespace nsSdD;
+using namespace std;
+
+namespace
+{
+    typedef CListTrace::EOperation EOperation;
+    typedef CListTrace::EPosition EPosition;
+    typedef CListTrace::CRecord CRecord;
+    typedef chrono::steady_clock clock_type;
+
+    /*!
+        @brief The latencies of the calls, in nanoseconds, for each operation.
+     */
+    typedef vector<vector<uint32_t>> CLatencies;
+
+    /*!
+        @brief Keeps the values read by the replayed calls alive, so that the compiler doesn't remove them.
+     */
+    volatile uint64_t g_sink = 0;
+
+    /*!
+        @brief The seed of the replayed values, the same for every list.
+     */
+    const uint64_t g_seed = 20141208;
+
+    /*!
+        @brief A replayed element of @p Bytes bytes, compared by its key.
+     */
+    template<size_t Bytes>
+    struct CPayload
+    {
+        uint64_t key;
+        unsigned char padding[Bytes - sizeof (uint64_t)];
+
+        explicit CPayload (uint64_t k = 0) noexcept : key (k), padding ()
+        {
+        }
+
+        bool operator== (const CPayload &other) const noexcept
+        {
+            return key == other.key;
+        }
+
+        bool operator< (const CPayload &other) const noexcept
+        {
+            return key < other.key;
+        }
+    };
+
+    /*!
+        @brief The calls without an equivalent of the same name in a replayed list.
+     */
+    template<class List>
+    struct CVariant;
+
+    template<typename T>
+    struct CVariant<CList<T>>
+    {
+        typedef T value_type;
+
+        /*!
+            @brief The extracted nodes, reinserted by the next insert_node.
+         */
+        typedef vector<typename CList<T>::node_type> pool_type;
+
+        static void assign (CList<T> &x, size_t n, const T &value) noexcept
+        {
+            x.assign (unsigned (n), value);
+        }
+
+        static void resize (CList<T> &x, size_t n, const T &value) noexcept
+        {
+            x.resize (unsigned (n), value);
+        }
+
+        static void extract (CList<T> &x, typename CList<T>::iterator position, pool_type &pool) noexcept
+        {
+            pool.push_back (x.extract (position));
+        }
+
+        static typename CList<T>::iterator insertNode (CList<T> &x, typename CList<T>::iterator position,
+                                                       pool_type &pool, const T &value) noexcept
+        {
+            if (pool.empty ())
+                return x.insert (position, value);
+
+            typename CList<T>::iterator inserted = x.insert (position, std::move (pool.back ()));
+            pool.pop_back ();
+            return inserted;
+        }
+
+        static size_t dedup (CList<T> &x) noexcept
+        {
+            return x.dedup ([] (const T &value)
+            {
+                return hash<uint64_t> () (value.key);
+            }, equal_to<T> ());
+        }
+
+        static void partition (CList<T> &x) noexcept
+        {
+            x.stable_partition ([] (const T &value)
+            {
+                return (value.key & 1) != 0;
+            });
+        }
+
+        static void nthElement (CList<T> &x, size_t n) noexcept
+        {
+            if (!x.empty ())
+                x.nth_element (min (n, x.size () - 1));
+        }
+
+        static void partialSort (CList<T> &x, size_t k) noexcept
+        {
+            x.partial_sort (k);
+        }
+
+        static void merge (CList<T> &x, CList<T> &other) noexcept
+        {
+            x.merge (other);
+        }
+
+        static void materializeReverse (CList<T> &x) noexcept
+        {
+            x.materialize_reverse ();
+        }
+    };
+
+    template<typename T>
+    struct CVariant<list<T>>
+    {
+        typedef T value_type;
+
+        /*!
+            @brief The extracted elements, spliced back by the next insert_node.
+         */
+        typedef list<T> pool_type;
+
+        static void assign (list<T> &x, size_t n, const T &value) noexcept
+        {
+            x.assign (n, value);
+        }
+
+        static void resize (list<T> &x, size_t n, const T &value) noexcept
+        {
+            x.resize (n, value);
+        }
+
+        static void extract (list<T> &x, typename list<T>::iterator position, pool_type &pool) noexcept
+        {
+            pool.splice (pool.end (), x, position);
+        }
+
+        static typename list<T>::iterator insertNode (list<T> &x, typename list<T>::iterator position,
+                                                      pool_type &pool, const T &value) noexcept
+        {
+            if (pool.empty ())
+                return x.insert (position, value);
+
+            typename list<T>::iterator node = --pool.end ();
+            x.splice (position, pool, node);
+            return node;
+        }
+
+        static size_t dedup (list<T> &x) noexcept
+        {
+            size_t size = x.size ();
+            unordered_set<uint64_t> seen;
+            x.remove_if ([&seen] (const T &value)
+            {
+                return !seen.insert (value.key).second;
+            });
+
+            return size - x.size ();
+        }
+
+        static void partition (list<T> &x) noexcept
+        {
+            // Relinking the rejected elements, as CList does
+            list<T> rejected;
+            for (auto itr = x.begin (); itr != x.end ();)
+            {
+                auto current = itr++;
+                if ((current->key & 1) == 0)
+                    rejected.splice (rejected.end (), x, current);
+            }
+
+            x.splice (x.end (), rejected);
+        }
+
+        // std::list has no selection, its elements are sorted instead
+        static void nthElement (list<T> &x, size_t) noexcept
+        {
+            x.sort ();
+        }
+
+        static void partialSort (list<T> &x, size_t) noexcept
+        {
+            x.sort ();
+        }
+
+        // As CList::merge, which doesn't require sorted lists
+        static void merge (list<T> &x, list<T> &other) noexcept
+        {
+            x.splice (x.end (), other);
+            x.sort ();
+        }
+
+        static void materializeReverse (list<T> &) noexcept
+        {
+        }
+    };
+
+    /*!
+        @brief A replayed list, and the position its calls in the middle are replayed at.
+     */
+    template<class List>
+    struct CState
+    {
+        unique_ptr<List> list;
+
+        typename List::iterator cursor;
+
+        bool cursorValid = false;
+    };
+
+    template<class List>
+    CState<List> &StateOf (vector<unique_ptr<CState<List>>> &states, uint32_t list) noexcept
+    {
+        if (states.size () <= list)
+            states.resize (list + 1);
+
+        if (!states[list])
+            states[list].reset (new CState<List> ());
+
+        return *states[list];
+    }
+
+    /*!
+        @brief Return where a call at @p position is replayed. The calls in the middle are replayed at a cursor,
+               moved by them and placed again in the middle once another call may have invalidated it.
+     */
+    template<class List>
+    typename List::iterator PositionOf (CState<List> &state, EPosition position, bool element) noexcept
+    {
+        List &list = *state.list;
+
+        switch (position)
+        {
+            case EPosition::Front:
+                return list.begin ();
+
+            case EPosition::Back:
+                return element && !list.empty () ? --list.end () : list.end ();
+
+            case EPosition::Middle:
+                if (!state.cursorValid || (element && state.cursor == list.end ()))
+                {
+                    state.cursor = list.begin ();
+                    advance (state.cursor, list.size () / 2);
+                    state.cursorValid = true;
+                }
+                return state.cursor;
+
+            default:
+                return list.end ();
+        }
+    }
+
+    /*!
+        @brief Replays @p records against lists of type @p List, and adds the latency of each call to @p latencies.
+               Finding the position of a call is not measured, the caller had it already.
+     */
+    template<class List>
+    void Replay (const vector<CRecord> &records, CLatencies &latencies) noexcept
+    {
+        typedef CVariant<List> variant;
+        typedef typename variant::value_type T;
+        typedef typename List::iterator iterator;
+
+        vector<unique_ptr<CState<List>>> states;
+        typename variant::pool_type pool;
+        mt19937_64 generator (g_seed);
+
+        for (const CRecord &record : records)
+        {
+            const EOperation operation = EOperation (record.operation);
+            const EPosition position = EPosition (record.position);
+            CState<List> &state = StateOf (states, record.list);
+            clock_type::time_point start;
+
+            if (operation == EOperation::Construct || operation == EOperation::Destroy)
+            {
+                start = clock_type::now ();
+                state.list.reset (operation == EOperation::Construct ? new List () : nullptr);
+            }
+            else
+            {
+                // A list constructed during another call, like the lists of sort, is created on its first call
+                if (!state.list)
+                    state.list.reset (new List ());
+
+                List &list = *state.list;
+                CState<List> *other = record.other && record.other != record.list ? &StateOf (states, record.other) : nullptr;
+                if (other && !other->list)
+                    other->list.reset (new List ());
+
+                const bool element = operation == EOperation::Erase || operation == EOperation::Extract;
+                iterator itr = PositionOf (state, position, element), last = list.end ();
+                if (element && itr == list.end ())
+                    continue;
+
+                size_t count = record.count;
+                if (operation == EOperation::Erase && count > 1)
+                    for (last = itr; last != list.end () && count > 0; --count)
+                        ++last;
+
+                if (operation == EOperation::Splice && other)
+                {
+                    count = min<size_t> (count, other->list->size ());
+                    last = other->list->begin ();
+                    advance (last, count);
+                }
+
+                const T value (generator ());
+                size_t removed = 0;
+
+                start = clock_type::now ();
+                switch (operation)
+                {
+                    case EOperation::Assign:
+                        variant::assign (list, record.count, value);
+                        break;
+
+                    case EOperation::PushFront:
+                        list.push_front (value);
+                        break;
+
+                    case EOperation::PushBack:
+                        list.push_back (value);
+                        break;
+
+                    case EOperation::PopFront:
+                        if (!list.empty ())
+                            list.pop_front ();
+                        break;
+
+                    case EOperation::PopBack:
+                        if (!list.empty ())
+                            list.pop_back ();
+                        break;
+
+                    case EOperation::Insert:
+                        itr = record.count > 1 ? list.insert (itr, size_t (record.count), value) : list.insert (itr, value);
+                        break;
+
+                    case EOperation::Erase:
+                        itr = record.count > 1 ? list.erase (itr, last) : list.erase (itr);
+                        break;
+
+                    case EOperation::Extract:
+                        variant::extract (list, itr, pool);
+                        break;
+
+                    case EOperation::InsertNode:
+                        itr = variant::insertNode (list, itr, pool, value);
+                        break;
+
+                    case EOperation::Front:
+                        if (!list.empty ())
+                            g_sink = g_sink + list.front ().key;
+                        break;
+
+                    case EOperation::Back:
+                        if (!list.empty ())
+                            g_sink = g_sink + list.back ().key;
+                        break;
+
+                    case EOperation::Swap:
+                        if (other)
+                            list.swap (*other->list);
+                        break;
+
+                    case EOperation::Resize:
+                        variant::resize (list, record.count, value);
+                        break;
+
+                    case EOperation::Clear:
+                        list.clear ();
+                        break;
+
+                    // The values aren't recorded, as many elements as recorded are removed
+                    case EOperation::Remove:
+                        list.remove_if ([&removed, &record] (const T &)
+                        {
+                            return removed < record.count && ++removed;
+                        });
+                        break;
+
+                    case EOperation::Unique:
+                        list.unique ([&removed, &record] (const T &, const T &)
+                        {
+                            return removed < record.count && ++removed;
+                        });
+                        break;
+
+                    case EOperation::Dedup:
+                        g_sink = g_sink + variant::dedup (list);
+                        break;
+
+                    case EOperation::Splice:
+                        if (!other || count == 0)
+                            break;
+                        if (count == other->list->size ())
+                            list.splice (itr, *other->list);
+                        else if (count == 1)
+                            list.splice (itr, *other->list, other->list->begin ());
+                        else
+                            list.splice (itr, *other->list, other->list->begin (), last);
+                        break;
+
+                    case EOperation::Merge:
+                        if (other)
+                            variant::merge (list, *other->list);
+                        break;
+
+                    case EOperation::Sort:
+                        list.sort ();
+                        break;
+
+                    case EOperation::Partition:
+                        variant::partition (list);
+                        break;
+
+                    case EOperation::NthElement:
+                        variant::nthElement (list, record.count);
+                        break;
+
+                    case EOperation::PartialSort:
+                        variant::partialSort (list, record.count);
+                        break;
+
+                    case EOperation::Reverse:
+                        list.reverse ();
+                        break;
+
+                    case EOperation::MaterializeReverse:
+                        variant::materializeReverse (list);
+                        break;
+
+                    default:
+                        break;
+                }
+
+                // The cursor follows the calls in the middle, and is placed again after a call which may remove
+                // or move its element
+                bool inserted = operation == EOperation::Insert || operation == EOperation::InsertNode;
+                if (position == EPosition::Middle && (inserted || operation == EOperation::Erase))
+                {
+                    state.cursor = itr;
+                    state.cursorValid = itr != list.end ();
+                }
+                else if (!inserted && operation != EOperation::PushFront && operation != EOperation::PushBack
+                         && operation != EOperation::Front && operation != EOperation::Back
+                         && operation != EOperation::Sort)
+                    state.cursorValid = false;
+
+                if (other)
+                    other->cursorValid = false;
+            }
+
+            uint64_t nanoseconds = chrono::duration_cast<chrono::nanoseconds> (clock_type::now () - start).count ();
+            latencies[record.operation].push_back (uint32_t (min<uint64_t> (nanoseconds, UINT32_MAX)));
+        }
+    }
+
+    /*!
+        @brief Replays @p records against lists of type @p List in a new thread, whose node caches are empty.
+     */
+    template<class List>
+    CLatencies ReplayInThread (const vector<CRecord> &records) noexcept
+    {
+        CLatencies latencies (CListTrace::operationCount);
+
+        thread replayer ([&records, &latencies] ()
+        {
+            Replay<List> (records, latencies);
+        });
+        replayer.join ();
+
+        return latencies;
+    }
+
+    /*!
+        @brief Prints the number of calls, the mean and the percentiles of @p latencies, sorted.
+     */
+    void PrintRow (const char *operation, vector<uint32_t> &latencies) noexcept
+    {
+        sort (latencies.begin (), latencies.end ());
+
+        uint64_t total = 0;
+        for (uint32_t latency : latencies)
+            total += latency;
+
+        cout << left << setw (22) << operation << right << setw (10) << latencies.size ()
+             << fixed << setprecision (1) << setw (10) << double (total) / latencies.size ();
+
+        for (double percentile : { 0.5, 0.9, 0.99, 0.999 })
+            cout << setw (10) << latencies[min (latencies.size () - 1, size_t (percentile * latencies.size ()))];
+
+        cout << endl;
+    }
+
+    void Report (const string &variant, CLatencies &latencies) noexcept
+    {
+        vector<uint32_t> all;
+        for (const vector<uint32_t> &operation : latencies)
+            all.insert (all.end (), operation.cbegin (), operation.cend ());
+
+        uint64_t total = 0;
+        for (uint32_t latency : all)
+            total += latency;
+
+        cout << endl << variant << ": " << all.size () << " calls in " << fixed << setprecision (2) << total / 1e6
+             << " ms, " << (total ? all.size () * 1e3 / total : 0) << " M calls/s" << endl
+             << left << setw (22) << "operation" << right << setw (10) << "calls" << setw (10) << "mean"
+             << setw (10) << "p50" << setw (10) << "p90" << setw (10) << "p99" << setw (10) << "p99.9" << endl;
+
+        for (size_t i = 0; i < latencies.size (); ++i)
+            if (!latencies[i].empty ())
+                PrintRow (CListTrace::name (EOperation (i)), latencies[i]);
+
+        if (!all.empty ())
+            PrintRow ("all", all);
+    }
+
+    /*!
+        @brief Return the least time measured between two reads of the clock, included in each latency.
+     */
+    uint64_t ClockOverhead () noexcept
+    {
+        uint64_t overhead = UINT64_MAX;
+        for (int i = 0; i < 1000; ++i)
+        {
+            clock_type::time_point start = clock_type::now ();
+            overhead = min<uint64_t> (overhead, chrono::duration_cast<chrono::nanoseconds> (clock_type::now () - start).count ());
+        }
+
+        return overhead;
+    }
+
+    template<typename T>
+    void ReplayVariants (const vector<CRecord> &records) noexcept
+    {
+        cout << "Replayed with elements of " << sizeof (T) << " bytes, latencies in ns including "
+             << ClockOverhead () << " ns of clock reads" << endl;
+
+        CLatencies latencies = ReplayInThread<CList<T>> (records);
+        Report ("CList", latencies);
+
+        CHugePageArena::setEnabled (true);
+        latencies = ReplayInThread<CList<T>> (records);
+        CHugePageArena::setEnabled (false);
+        Report ("CList, huge pages", latencies);
+
+        latencies = ReplayInThread<list<T>> (records);
+        Report ("std::list", latencies);
+    }
+}
+
+bool CReplay::RunReplay (const string &path) noexcept
+{
+    vector<CRecord> records;
+    if (!CListTrace::read (path, records))
+    {
+        cerr << "Can't read the trace " << path << endl;
+        return false;
+    }
+
+    // The chunks of the threads are written in the order they are full
+    stable_sort (records.begin (), records.end (), [] (const CRecord &a, const CRecord &b)
+    {
+        return a.time < b.time;
+    });
+
+    size_t valueSize = 0;
+    uint32_t lists = 0;
+    for (const CRecord &record : records)
+    {
+        valueSize = max<size_t> (valueSize, record.valueSize);
+        lists = max (lists, record.list);
+    }
+
+    cout << "Replaying " << records.size () << " calls on " << lists << " lists of elements of " << valueSize
+         << " bytes at most" << endl;
+
+    if (valueSize <= 16)
+        ReplayVariants<CPayload<16>> (records);
+    else if (valueSize <= 64)
+        ReplayVariants<CPayload<64>> (records);
+    else
+        ReplayVariants<CPayload<256>> (records);
+
+    return true;
+}
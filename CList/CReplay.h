@@ -0,0 +1,30 @@
+/*!
+@file CReplay.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CList trace replay runner
+*/
+#pragma once
+
+#include <string>
+
+namespace nsBench
+{
+    /*!
+        @brief Trace replay runnable. The calls recorded by CListTrace are replayed against CList, CList with its
+               nodes on huge pages, and std::list, and reported per operation: throughput, and latency percentiles.
+     */
+    class CReplay
+    {
+    public:
+        /*!
+            @brief Replay the trace file @p path against each list.
+            @return False if @p path can't be read or isn't a trace.
+         */
+        static bool RunReplay (const std::string &path) noexcept;
+
+    private:
+        CReplay () = delete;
+    };
+}
@@ -0,0 +1,597 @@
+/*!
+@file CSerializer.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Chunked binary serialization tools used by CList::write_to and CList::read_from.
+
+A serialized CList is a stream header followed by chunks of about 1 MiB: each chunk starts with its number of
+elements and its size in bytes, an empty chunk ends the list. Trivially copyable elements are copied as raw bytes,
+the other types need a specialization of CSerializer. Pointers are never serialized: the addresses they hold
+would be meaningless once read back.
+*/
+
+#pragma once
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <poll.h>
+#include <unistd.h>
+
+namespace nsSdD
+{
+    /*!
+        @brief Appends binary data to a chunk being written.
+     */
+    class CByteWriter
+    {
+    public:
+        /*!
+            @brief This is the constructor of a CByteWriter appending to @p buffer.
+         */
+        explicit CByteWriter (std::vector<char> &buffer) noexcept : m_buffer (buffer)
+        {
+        }
+
+        /*!
+            @brief  Appends @p length bytes at @p data.
+         */
+        void write (const void *data, size_t length) noexcept
+        {
+            const char *bytes = static_cast<const char *> (data);
+            m_buffer.insert (m_buffer.end (), bytes, bytes + length);
+        }
+
+        /*!
+            @brief  Appends the bytes of the trivially copyable @p x.
+         */
+        template<typename U>
+        void write (const U &x) noexcept
+        {
+            static_assert (std::is_trivially_copyable<U>::value, "Only trivially copyable values are written as raw bytes");
+            write (&x, sizeof (U));
+        }
+
+        /*!
+            @brief  Appends the length of @p s, then its characters.
+         */
+        void write (const std::string &s) noexcept
+        {
+            write (static_cast<std::uint32_t> (s.size ()));
+            write (s.data (), s.size ());
+        }
+
+    private:
+        /*!
+            @var m_buffer
+            @brief The chunk being written.
+         */
+        std::vector<char> &m_buffer;
+    };
+
+    /*!
+        @brief Reads binary data from a received chunk, never past its end.
+     */
+    class CByteReader
+    {
+    public:
+        /*!
+            @brief This is the constructor of a CByteReader reading the @p length bytes at @p data.
+         */
+        CByteReader (const char *data, size_t length) noexcept : m_data (data), m_remaining (length)
+        {
+        }
+
+        /*!
+            @brief  Reads @p length bytes in @p data.
+            @return bool If there were enough bytes left.
+         */
+        bool read (void *data, size_t length) noexcept
+        {
+            if (length > m_remaining)
+                return false;
+
+            std::memcpy (data, m_data, length);
+            m_data += length;
+            m_remaining -= length;
+
+            return true;
+        }
+
+        /*!
+            @brief  Reads the bytes of the trivially copyable @p x.
+            @return bool If there were enough bytes left.
+         */
+        template<typename U>
+        bool read (U &x) noexcept
+        {
+            static_assert (std::is_trivially_copyable<U>::value, "Only trivially copyable values are read as raw bytes");
+            return read (static_cast<void *> (&x), sizeof (U));
+        }
+
+        /*!
+            @brief  Reads a string written by CByteWriter::write.
+            @return bool If there were enough bytes left.
+         */
+        bool read (std::string &s) noexcept
+        {
+            std::uint32_t length;
+            if (!read (length) || length > m_remaining)
+                return false;
+
+            s.assign (m_data, length);
+            m_data += length;
+            m_remaining -= length;
+
+            return true;
+        }
+
+        /*!
+            @brief  Return the number of bytes left in the chunk.
+         */
+        size_t remaining () const noexcept
+        {
+            return m_remaining;
+        }
+
+    private:
+        /*!
+            @var m_data
+            @brief The next byte to read.
+         */
+        const char *m_data;
+
+        /*!
+            @var m_remaining
+            @brief The number of bytes left.
+         */
+        size_t m_remaining;
+    };
+
+    /*!
+        @brief Tells if the values of @p T are written as their raw bytes: trivially copyable types, except the pointers,
+                and aligned by operator new so that a received chunk can be read in place.
+     */
+    template<typename T>
+    struct CIsRawSerializable : public std::integral_constant<bool, std::is_trivially_copyable<T>::value
+                                                                    && !std::is_pointer<T>::value
+                                                                    && !std::is_member_pointer<T>::value
+                                                                    && alignof (T) <= alignof (std::max_align_t)>
+    {
+    };
+
+    /*!
+        @brief Customization point telling how a T is serialized.
+                Types satisfying CIsRawSerializable are copied as raw bytes, in bulk.
+                Other types must provide a specialization such as:
+                @code
+                template<>
+                struct nsSdD::CSerializer<MyType>
+                {
+                    static const bool bulk = false;
+                    static void write (CByteWriter &out, const MyType &x) noexcept;
+                    static bool read (CByteReader &in, MyType &x) noexcept;
+                };
+                @endcode
+     */
+    template<typename T, bool = CIsRawSerializable<T>::value>
+    struct CSerializer;
+
+    /*!
+        @brief Serializer of the types copied as raw bytes.
+     */
+    template<typename T>
+    struct CSerializer<T, true>
+    {
+        static const bool bulk = true;
+
+        static void write (CByteWriter &out, const T &x) noexcept
+        {
+            out.write (&x, sizeof (T));
+        }
+
+        static bool read (CByteReader &in, T &x) noexcept
+        {
+            return in.read (static_cast<void *> (&x), sizeof (T));
+        }
+    };
+
+    /*!
+        @brief Serializer of the strings, as their length followed by their characters.
+     */
+    template<>
+    struct CSerializer<std::string, false>
+    {
+        static const bool bulk = false;
+
+        static void write (CByteWriter &out, const std::string &x) noexcept
+        {
+            out.write (x);
+        }
+
+        static bool read (CByteReader &in, std::string &x) noexcept
+        {
+            return in.read (x);
+        }
+    };
+
+    /*!
+        @brief Serializer of the shared pointers, as a flag telling if they are null followed by the object they
+                point to. Reading gives a new object to each pointer: the sharing is not kept.
+     */
+    template<typename T>
+    struct CSerializer<std::shared_ptr<T>, false>
+    {
+        static const bool bulk = false;
+
+        static void write (CByteWriter &out, const std::shared_ptr<T> &x) noexcept
+        {
+            out.write (static_cast<std::uint8_t> (x != nullptr));
+            if (x != nullptr)
+                CSerializer<T>::write (out, *x);
+        }
+
+        static bool read (CByteReader &in, std::shared_ptr<T> &x) noexcept
+        {
+            std::uint8_t present;
+            if (!in.read (present))
+                return false;
+
+            if (!present)
+            {
+                x = nullptr;
+                return true;
+            }
+
+            T value;
+            if (!CSerializer<T>::read (in, value))
+                return false;
+
+            x = std::make_shared<T> (value);
+            return true;
+        }
+    };
+
+    /*!
+        @brief Reads the chunks of a serialized CList. When the input is a file descriptor, the chunks are read ahead
+                in a background thread, so that the list is built from one chunk while the next ones are read.
+                The thread polls the descriptor together with a wake-up pipe, so that it can be stopped while it waits
+                for input that may never come. Other inputs can't be interrupted and are read in the calling thread.
+     */
+    class CChunkReader
+    {
+    public:
+        /*!
+            @typedef source_type
+            @brief Reads up to the given number of bytes, returns how many were read, 0 at the end of the input.
+         */
+        typedef std::function<size_t (char *, size_t)> source_type;
+
+        /*!
+            @brief  Starts reading the chunks from @p source.
+            @param[in] source The input, only used by the background thread from now on if there is one.
+            @param[in] maxChunkSize The size above which a chunk is malformed, checked before allocating it.
+            @param[in] elementSize The size of each element of a chunk, 0 if the elements have variable sizes.
+            @param[in] descriptor The file descriptor read by @p source, or -1 to read in the calling thread.
+            @param[in] depth The number of chunks read ahead.
+         */
+        CChunkReader (source_type source, size_t maxChunkSize, size_t elementSize, int descriptor = -1,
+                      size_t depth = 2) noexcept
+                : m_source (source), m_descriptor (descriptor), m_maxChunkSize (maxChunkSize),
+                  m_elementSize (elementSize), m_depth (depth)
+        {
+            m_background = descriptor >= 0 && depth != 0 && ::pipe (m_wakeUp) == 0;
+            if (m_background)
+                m_thread = std::thread (&CChunkReader::run, this);
+        }
+
+        /*!
+            @brief The destructor wakes the background thread up, even in the middle of a read, and waits for it.
+         */
+        ~CChunkReader () noexcept
+        {
+            if (!m_background)
+                return;
+
+            {
+                std::lock_guard<std::mutex> lock (m_mutex);
+                m_stopped = true;
+            }
+            m_condition.notify_all ();
+
+            const char wakeUp = 0;
+            while (::write (m_wakeUp[1], &wakeUp, 1) < 0 && errno == EINTR)
+                continue;
+
+            m_thread.join ();
+            ::close (m_wakeUp[0]);
+            ::close (m_wakeUp[1]);
+        }
+
+        CChunkReader (const CChunkReader &) = delete;
+
+        CChunkReader &operator= (const CChunkReader &) = delete;
+
+        /*!
+            @brief  Waits for the next chunk and swaps it with @p chunk, whose buffer is reused for a later chunk.
+            @param[out] chunk The content of the chunk.
+            @param[out] count The number of elements in the chunk.
+            @return bool False at the end of the list or if the input is malformed, see @p failed.
+         */
+        bool next (std::vector<char> &chunk, std::uint32_t &count) noexcept
+        {
+            if (!m_background)
+            {
+                bool failed;
+                if (readChunk (chunk, count, failed))
+                    return true;
+
+                m_failed = failed;
+                return false;
+            }
+
+            std::unique_lock<std::mutex> lock (m_mutex);
+            m_condition.wait (lock, [this] ()
+            {
+                return !m_ready.empty () || m_finished;
+            });
+
+            if (m_ready.empty ())
+                return false;
+
+            count = m_ready.front ().first;
+            chunk.swap (m_ready.front ().second);
+            m_free.push_back (std::move (m_ready.front ().second));
+            m_ready.pop_front ();
+
+            lock.unlock ();
+            m_condition.notify_all ();
+
+            return true;
+        }
+
+        /*!
+            @brief  Return true if the input ended before the last chunk or holds a malformed chunk.
+         */
+        bool failed () const noexcept
+        {
+            std::lock_guard<std::mutex> lock (m_mutex);
+            return m_failed;
+        }
+
+        /*!
+            @brief  Reads exactly @p length bytes from @p source.
+            @return bool If all of them were read.
+         */
+        static bool readAll (const source_type &source, char *data, size_t length) noexcept
+        {
+            while (length)
+            {
+                size_t read = source (data, length);
+                if (!read)
+                    return false;
+
+                data += read;
+                length -= read;
+            }
+
+            return true;
+        }
+
+    private:
+        /*!
+            @brief  Waits until the descriptor can be read without blocking.
+            @return bool False if the reader is stopped meanwhile.
+         */
+        bool waitForInput () noexcept
+        {
+            pollfd descriptors[2] = {{m_descriptor, POLLIN, 0}, {m_wakeUp[0], POLLIN, 0}};
+            while (::poll (descriptors, 2, -1) < 0)
+                if (errno != EINTR)
+                    return false;
+
+            return !descriptors[1].revents;
+        }
+
+        /*!
+            @brief  Reads exactly @p length bytes from the source, waiting for each read to be ready in the background.
+            @return bool If all of them were read.
+         */
+        bool fill (char *data, size_t length) noexcept
+        {
+            while (length)
+            {
+                if (m_background && !waitForInput ())
+                    return false;
+
+                size_t read = m_source (data, length);
+                if (!read)
+                    return false;
+
+                data += read;
+                length -= read;
+            }
+
+            return true;
+        }
+
+        /*!
+            @brief  Reads the header then the content of the next chunk in @p buffer.
+            @param[out] failed Set if the input ended early, or the chunk or the end of the list is malformed.
+            @return bool False at the end of the list or on failure.
+         */
+        bool readChunk (std::vector<char> &buffer, std::uint32_t &count, bool &failed) noexcept
+        {
+            std::uint32_t header[2];
+            failed = !fill (reinterpret_cast<char *> (header), sizeof (header));
+            if (failed)
+                return false;
+
+            count = header[0];
+            if (!count)
+            {
+                failed = header[1] != 0;
+                return false;
+            }
+
+            // The sizes come from the input: they are checked before the buffer grows to them
+            failed = header[1] > m_maxChunkSize
+                     || (m_elementSize && header[1] != std::uint64_t (count) * m_elementSize);
+            if (failed)
+                return false;
+
+            buffer.resize (header[1]);
+            failed = !fill (buffer.data (), buffer.size ());
+
+            return !failed;
+        }
+
+        /*!
+            @brief  The loop of the background thread.
+         */
+        void run () noexcept
+        {
+            for (;;)
+            {
+                std::vector<char> buffer;
+                {
+                    std::unique_lock<std::mutex> lock (m_mutex);
+                    m_condition.wait (lock, [this] ()
+                    {
+                        return m_ready.size () < m_depth || m_stopped;
+                    });
+
+                    if (m_stopped)
+                        break;
+
+                    if (!m_free.empty ())
+                    {
+                        buffer.swap (m_free.back ());
+                        m_free.pop_back ();
+                    }
+                }
+
+                std::uint32_t count;
+                bool failed;
+                bool ok = readChunk (buffer, count, failed);
+
+                std::lock_guard<std::mutex> lock (m_mutex);
+                if (!ok)
+                {
+                    m_failed = failed && !m_stopped;
+                    break;
+                }
+
+                m_ready.emplace_back (count, std::vector<char> ());
+                m_ready.back ().second.swap (buffer);
+                m_condition.notify_all ();
+            }
+
+            std::lock_guard<std::mutex> lock (m_mutex);
+            m_finished = true;
+            m_condition.notify_all ();
+        }
+
+        /*!
+            @var m_source
+            @brief The input of the chunks.
+         */
+        source_type m_source;
+
+        /*!
+            @var m_descriptor
+            @brief The file descriptor read by the source, -1 if unknown.
+         */
+        int m_descriptor;
+
+        /*!
+            @var m_maxChunkSize
+            @brief The size above which a chunk is malformed.
+         */
+        size_t m_maxChunkSize;
+
+        /*!
+            @var m_elementSize
+            @brief The size of each element of a chunk, 0 if the elements have variable sizes.
+         */
+        size_t m_elementSize;
+
+        /*!
+            @var m_depth
+            @brief The maximum number of chunks read ahead.
+         */
+        size_t m_depth;
+
+        /*!
+            @var m_background
+            @brief If the chunks are read ahead by the background thread.
+         */
+        bool m_background = false;
+
+        /*!
+            @var m_wakeUp
+            @brief The pipe written by the destructor to interrupt the background thread waiting for input.
+         */
+        int m_wakeUp[2] = {-1, -1};
+
+        /*!
+            @var m_ready
+            @brief The chunks read and not consumed yet, with their number of elements.
+         */
+        std::deque<std::pair<std::uint32_t, std::vector<char>>> m_ready;
+
+        /*!
+            @var m_free
+            @brief The consumed buffers, reused to read the next chunks.
+         */
+        std::vector<std::vector<char>> m_free;
+
+        /*!
+            @var m_mutex
+            @brief Protects everything shared with the background thread.
+         */
+        mutable std::mutex m_mutex;
+
+        /*!
+            @var m_condition
+            @brief Signals a chunk read, a chunk consumed, or the end of the reading.
+         */
+        std::condition_variable m_condition;
+
+        /*!
+            @var m_stopped
+            @brief Asks the background thread to stop.
+         */
+        bool m_stopped = false;
+
+        /*!
+            @var m_finished
+            @brief Set once the background thread won't read any more chunk.
+         */
+        bool m_finished = false;
+
+        /*!
+            @var m_failed
+            @brief Set if the input ended early or a chunk was malformed.
+         */
+        bool m_failed = false;
+
+        /*!
+            @var m_thread
+            @brief The background thread, started last once everything else is initialized.
+         */
+        std::thread m_thread;
+    };
+}
@@ -0,0 +1,485 @@
+/*!
+@file CStaticList.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CStaticList class.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace nsSdD
+{
+    template<typename T, size_t N>
+    /*!
+       @brief CStaticList is the fixed-capacity sibling of CList, for the paths where the number of elements is
+              bounded and no allocation is allowed. Its N nodes live inside the object: they are linked by
+              their indexes, the smallest unsigned type able to hold N, and the erased ones are kept in a
+              freelist. Inserting and erasing never call the allocator.
+
+              An element is held by value in its node, whose value is assigned when inserted and reset to T ()
+              when erased: T must be default constructible and assignable.
+
+              The interface is the one of CList. The overflows are reported instead of allocating: an insertion
+              into a full CStaticList inserts nothing and returns false, or end () for the functions returning
+              an iterator; the ones of several elements insert all of them or none.
+
+              The default constructor is constexpr, and so are the observers of the size and capacity: a
+              CStaticList of a literal type is a literal type, which can be constant-initialized. Being stored
+              by value, it is copied, moved and swapped in O(N), and splicing the elements of another
+              CStaticList moves their values, in O(1) per element.
+    */
+    class CStaticList
+    {
+        static_assert (N > 0 && N < UINT32_MAX, "The capacity of a CStaticList is from 1 to UINT32_MAX - 1");
+
+        // Types
+    private:
+        struct CIterator;
+
+        struct CConstIterator;
+
+        /*!
+            @typedef index_type
+            @brief The index of a node, N being the end.
+         */
+        typedef typename std::conditional<(N < UINT8_MAX), std::uint8_t,
+                typename std::conditional<(N < UINT16_MAX), std::uint16_t, std::uint32_t>::type>::type index_type;
+
+        /*!
+            @brief The index after the last node and before the first one.
+         */
+        static constexpr index_type nil = index_type (N);
+
+        /*!
+            @brief A node, holding a value of type T and the indexes of its neighbours.
+         */
+        struct CNode
+        {
+            T m_info;
+
+            index_type m_next;
+
+            index_type m_previous;
+
+            constexpr CNode () noexcept : m_info (), m_next (nil), m_previous (nil)
+            {
+            }
+        };
+
+    public:
+        /*!
+            @typedef value_type
+            @brief This define a @p T.
+         */
+        typedef T value_type;
+
+        /*!
+            @typedef size_type
+            @brief This define a @p size_t.
+         */
+        typedef size_t size_type;
+
+        /*!
+            @typedef iterator
+            @brief This define a @p CIterator, a bidirectional iterator.
+         */
+        typedef CIterator iterator;
+
+        /*!
+            @typedef const_iterator
+            @brief This define a @p CConstIterator, a bidirectional const iterator.
+         */
+        typedef CConstIterator const_iterator;
+
+        /*!
+            @typedef reverse_iterator
+            @brief This define a @p std::reverse_iterator of @p iterator.
+         */
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+
+        /*!
+            @typedef const_reverse_iterator
+            @brief This define a @p std::reverse_iterator of @p const_iterator.
+         */
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /*!
+            @brief This is the default constructor of the class CStaticList, constexpr.
+         */
+        constexpr CStaticList () noexcept;
+
+        /*!
+            @brief  This is the constructor of a CStaticList of @p n elements equal to @p val, or of N if @p n
+                    is greater.
+            @param[in] n The size of the CStaticList we want.
+            @param[in] val The value we want to insert in each element.
+         */
+        explicit CStaticList (size_type n, const T &val = T ()) noexcept;
+
+        /*!
+            @brief  This is the constructor copying the elements from @p first to @p last, or the N first ones.
+                    Only iterators take this overload, so that (n, val) of integers isn't a range.
+            @param[in] first The first element we want to copy.
+            @param[in] last The element following the last one we want to copy.
+         */
+        template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        CStaticList (InputIterator first, InputIterator last) noexcept;
+
+        // iterators
+        /*!
+            @brief  This function return an iterator to the begin of the CStaticList.
+         */
+        iterator begin () noexcept;
+
+        /*!
+            @brief  This function return an iterator to the end of the CStaticList.
+         */
+        iterator end () noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the begin of the CStaticList.
+         */
+        const_iterator cbegin () const noexcept;
+
+        /*!
+            @brief  This function return a const_iterator to the end of the CStaticList.
+         */
+        const_iterator cend () const noexcept;
+
+        /*!
+            @brief  This function return a reverse_iterator to the last element.
+         */
+        reverse_iterator rbegin () noexcept;
+
+        /*!
+            @brief  This function return a reverse_iterator before the first element.
+         */
+        reverse_iterator rend () noexcept;
+
+        /*!
+            @brief  This function return a const_reverse_iterator to the last element.
+         */
+        const_reverse_iterator crbegin () const noexcept;
+
+        /*!
+            @brief  This function return a const_reverse_iterator before the first element.
+         */
+        const_reverse_iterator crend () const noexcept;
+
+        // Capacity
+        /*!
+            @brief  This function return true if the CStaticList is empty, false otherwise.
+         */
+        constexpr bool empty () const noexcept;
+
+        /*!
+            @brief  This function return true if the CStaticList holds N elements, false otherwise.
+         */
+        constexpr bool full () const noexcept;
+
+        /*!
+            @brief  This function return the number of elements, in O(1).
+         */
+        constexpr size_type size () const noexcept;
+
+        /*!
+            @brief  This function return the number of elements the CStaticList can hold, N.
+         */
+        static constexpr size_type capacity () noexcept;
+
+        /*!
+            @brief  This function return the number of elements the CStaticList can hold, N.
+         */
+        static constexpr size_type max_size () noexcept;
+
+        // Element access
+        /*!
+            @brief  This function return a reference to the first element.
+         */
+        T &front () noexcept;
+
+        /*!
+            @brief  This function return a const reference to the first element.
+         */
+        const T &front () const noexcept;
+
+        /*!
+            @brief  This function return a reference to the last element.
+         */
+        T &back () noexcept;
+
+        /*!
+            @brief  This function return a const reference to the last element.
+         */
+        const T &back () const noexcept;
+
+        // Modifiers
+        /*!
+            @brief  This function replaces the content by @p n elements equal to @p val.
+            @return False if @p n is greater than N, the CStaticList being left unchanged.
+         */
+        bool assign (size_type n, const T &val) noexcept;
+
+        /*!
+            @brief  This function replaces the content by the elements from @p first to @p last.
+            @return False if there are more than N elements, the CStaticList being left empty.
+         */
+        template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        bool assign (InputIterator first, InputIterator last) noexcept;
+
+        /*!
+            @brief  This function adds @p x at the beginning.
+            @return False if the CStaticList is full.
+         */
+        bool push_front (const T &x) noexcept;
+
+        /*!
+            @brief  This function adds @p x at the end.
+            @return False if the CStaticList is full.
+         */
+        bool push_back (const T &x) noexcept;
+
+        /*!
+            @brief  This function removes the first element, if any.
+         */
+        void pop_front () noexcept;
+
+        /*!
+            @brief  This function removes the last element, if any.
+         */
+        void pop_back () noexcept;
+
+        /*!
+            @brief  This function constructs an element before @p position from @p args.
+            @return An iterator to the new element, end () if the CStaticList is full.
+         */
+        template<typename... Args>
+        iterator emplace (const_iterator position, Args &&... args) noexcept;
+
+        /*!
+            @brief  This function constructs an element at the beginning from @p args.
+            @return An iterator to the new element, end () if the CStaticList is full.
+         */
+        template<typename... Args>
+        iterator emplace_front (Args &&... args) noexcept;
+
+        /*!
+            @brief  This function constructs an element at the end from @p args.
+            @return An iterator to the new element, end () if the CStaticList is full.
+         */
+        template<typename... Args>
+        iterator emplace_back (Args &&... args) noexcept;
+
+        /*!
+            @brief  This function inserts @p val before @p position.
+            @return An iterator to the new element, end () if the CStaticList is full.
+         */
+        iterator insert (const_iterator position, const T &val) noexcept;
+
+        /*!
+            @brief  This function inserts @p n elements equal to @p val before @p position, or none if they don't
+                    fit.
+            @return An iterator to the first new element, @p position if @p n is 0, end () if they don't fit.
+         */
+        iterator insert (const_iterator position, size_type n, const T &val) noexcept;
+
+        /*!
+            @brief  This function inserts the elements from @p first to @p last before @p position, or none if
+                    they don't fit.
+            @return An iterator to the first new element, @p position if the range is empty, end () if they
+                    don't fit.
+         */
+        template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        iterator insert (const_iterator position, InputIterator first, InputIterator last) noexcept;
+
+        /*!
+            @brief  This function erases the element at @p position, its node going back to the freelist.
+            @return An iterator to the element following the erased one.
+         */
+        iterator erase (const_iterator position) noexcept;
+
+        /*!
+            @brief  This function erases the elements from @p first to @p last (excluded).
+            @return @p last
+         */
+        iterator erase (const_iterator first, const_iterator last) noexcept;
+
+        /*!
+            @brief  This function swaps the content of the two CStaticList, in O(N).
+         */
+        void swap (CStaticList &x) noexcept;
+
+        /*!
+            @brief  This function resizes the CStaticList to @p n elements, adding copies of @p val if needed.
+            @return False if @p n is greater than N, the CStaticList being left unchanged.
+         */
+        bool resize (size_type n, const T &val = T ()) noexcept;
+
+        /*!
+            @brief  This function erases all the elements.
+         */
+        void clear () noexcept;
+
+        // Operations
+        /*!
+            @brief  This function moves all the elements of @p x before @p position.
+            @param[in] position The element before which we want to move the elements.
+            @param[in] x The CStaticList we take the elements of, empty afterwards.
+            @return False if they don't fit, nothing being moved.
+         */
+        bool splice (const_iterator position, CStaticList &x) noexcept;
+
+        /*!
+            @brief  This function moves the element @p i of @p x before @p position, relinked in O(1) if @p x is
+                    this CStaticList.
+            @return False if it doesn't fit, nothing being moved.
+         */
+        bool splice (const_iterator position, CStaticList &x, const_iterator i) noexcept;
+
+        /*!
+            @brief  This function moves the elements of @p x from @p first to @p last (excluded) before
+                    @p position, relinked in O(1) if @p x is this CStaticList.
+            @return False if they don't fit, nothing being moved.
+         */
+        bool splice (const_iterator position, CStaticList &x, const_iterator first, const_iterator last) noexcept;
+
+        /*!
+            @brief  This function removes the elements equal to @p val.
+         */
+        void remove (const T &val) noexcept;
+
+        /*!
+            @brief  This function removes the elements for which @p pred is true.
+         */
+        template<class Predicate>
+        void remove_if (Predicate pred) noexcept;
+
+        /*!
+            @brief  This function removes the elements equal to the one before them.
+         */
+        void unique () noexcept;
+
+        /*!
+            @brief  This function removes the elements for which @p pred is true with the one before them.
+         */
+        template<class Compare>
+        void unique (Compare pred) noexcept;
+
+        /*!
+            @brief  This function merges the sorted @p x into the sorted CStaticList, in linear time. Stable.
+            @return False if the elements of @p x don't fit, nothing being moved.
+         */
+        bool merge (CStaticList &x) noexcept;
+
+        /*!
+            @brief  This function merges @p x, sorted by @p comp, into the CStaticList sorted by @p comp.
+            @return False if the elements of @p x don't fit, nothing being moved.
+         */
+        template<class Compare>
+        bool merge (CStaticList &x, Compare comp) noexcept;
+
+        /*!
+            @brief  This function sorts the CStaticList in ascending order, in O(n log n), by relinking. Stable.
+         */
+        void sort () noexcept;
+
+        /*!
+            @brief  This function sorts the CStaticList with @p comp, in O(n log n), by relinking. Stable.
+         */
+        template<class Compare>
+        void sort (Compare comp) noexcept;
+
+        /*!
+            @brief  This function reverses the order of the elements by relinking.
+         */
+        void reverse () noexcept;
+
+    private:
+        /*!
+            @brief  Takes a node from the freelist, or one never used, and assigns it the value made of @p args.
+            @return The index of the node, nil if the CStaticList is full.
+         */
+        template<typename... Args>
+        index_type acquire (Args &&... args) noexcept;
+
+        /*!
+            @brief  Resets the value of the unlinked node @p node and gives it back to the freelist.
+         */
+        void release (index_type node) noexcept;
+
+        /*!
+            @brief  Links the unlinked node @p node before @p position.
+         */
+        void linkBefore (index_type position, index_type node) noexcept;
+
+        /*!
+            @brief  Unlinks the node @p node, without releasing it.
+         */
+        void unlink (index_type node) noexcept;
+
+        /*!
+            @brief  Return a reference to the link to the node following @p node, m_first for nil.
+         */
+        index_type &nextLink (index_type node) noexcept;
+
+        /*!
+            @brief  Return a reference to the link to the node preceding @p node, m_last for nil.
+         */
+        index_type &previousLink (index_type node) noexcept;
+
+        /*!
+            @brief  Merges the sorted chains @p a and @p b, linked forward and ending by nil, @p a going first
+                    among equal elements.
+            @param[out] last The last node of the merged chain.
+            @return The first node of the merged chain.
+         */
+        template<class Compare>
+        index_type mergeChains (index_type a, index_type b, Compare comp, index_type &last) noexcept;
+
+        /*!
+          @var     m_nodes
+          @brief  The nodes, used or not.
+       */
+        CNode m_nodes[N];
+
+        /*!
+          @var     m_first
+          @brief  The first node, nil if the CStaticList is empty.
+       */
+        index_type m_first;
+
+        /*!
+          @var     m_last
+          @brief  The last node, nil if the CStaticList is empty.
+       */
+        index_type m_last;
+
+        /*!
+          @var     m_free
+          @brief  The first node of the freelist, linked by m_next, nil if it is empty.
+       */
+        index_type m_free;
+
+        /*!
+          @var     m_unused
+          @brief  The first of the nodes never used, which follow it, so that the freelist isn't built by the
+                  constructor.
+       */
+        index_type m_unused;
+
+        /*!
+          @var     m_size
+          @brief  The number of elements.
+       */
+        index_type m_size;
+    };
+}
+
+#include "CStaticList.hxx"
@@ -0,0 +1,772 @@
+/*!
+@file CStaticList.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CStaticList class and iterators implementation.
+*/
+#pragma once
+
+#include <algorithm>
+
+#include "CStaticList.h"
+
+template<typename T, size_t N>
+constexpr typename nsSdD::CStaticList<T, N>::index_type nsSdD::CStaticList<T, N>::nil;
+
+/*!
+    @brief Bidirectional iterator of CStaticList.
+ */
+template<typename T, size_t N>
+struct nsSdD::CStaticList<T, N>::CIterator : public std::iterator<std::bidirectional_iterator_tag, T>
+{
+private:
+    /*!
+        @var list
+        @brief The CStaticList holding the node.
+    */
+    CStaticList *list;
+
+    /*!
+        @var node
+        @brief The index of the current node of the iterator, nil at the end.
+    */
+    index_type node;
+
+public:
+    CIterator (CStaticList *owner = nullptr, index_type index = nil) noexcept : list (owner), node (index)
+    {
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return node == other.node && list == other.list;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        node = list->m_nodes[node].m_next;
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    CIterator &operator-- () noexcept
+    {
+        node = node == nil ? list->m_last : list->m_nodes[node].m_previous;
+        return *this;
+    }
+
+    CIterator operator-- (int) noexcept
+    {
+        CIterator temp = *this;
+        --*this;
+        return temp;
+    }
+
+    T *operator-> () const noexcept
+    {
+        return &list->m_nodes[node].m_info;
+    }
+
+    T &operator* () const noexcept
+    {
+        return list->m_nodes[node].m_info;
+    }
+
+    /*!
+      @brief The function return the CStaticList the iterator is in.
+   */
+    CStaticList *getList () const noexcept
+    {
+        return list;
+    }
+
+    /*!
+      @brief The function return the index of the node the iterator is on.
+   */
+    index_type getNode () const noexcept
+    {
+        return node;
+    }
+};
+
+/*!
+    @brief Sister const class to CIterator
+ */
+template<typename T, size_t N>
+struct nsSdD::CStaticList<T, N>::CConstIterator : public std::iterator<std::bidirectional_iterator_tag, const T, std::ptrdiff_t, const T *, const T &>
+{
+private:
+    /*!
+        @var list
+        @brief The CStaticList holding the node.
+    */
+    const CStaticList *list;
+
+    /*!
+        @var node
+        @brief The index of the current node of the iterator, nil at the end.
+    */
+    index_type node;
+
+public:
+    CConstIterator (const CStaticList *owner = nullptr, index_type index = nil) noexcept : list (owner), node (index)
+    {
+    }
+
+    CConstIterator (const CIterator &other) noexcept : list (other.getList ()), node (other.getNode ())
+    {
+    }
+
+    bool operator== (const CConstIterator &other) const noexcept
+    {
+        return node == other.node && list == other.list;
+    }
+
+    bool operator!= (const CConstIterator &other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    CConstIterator &operator++ () noexcept
+    {
+        node = list->m_nodes[node].m_next;
+        return *this;
+    }
+
+    CConstIterator operator++ (int) noexcept
+    {
+        CConstIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    CConstIterator &operator-- () noexcept
+    {
+        node = node == nil ? list->m_last : list->m_nodes[node].m_previous;
+        return *this;
+    }
+
+    CConstIterator operator-- (int) noexcept
+    {
+        CConstIterator temp = *this;
+        --*this;
+        return temp;
+    }
+
+    const T *operator-> () const noexcept
+    {
+        return &list->m_nodes[node].m_info;
+    }
+
+    const T &operator* () const noexcept
+    {
+        return list->m_nodes[node].m_info;
+    }
+
+    /*!
+      @brief The function return the index of the node the iterator is on.
+   */
+    index_type getNode () const noexcept
+    {
+        return node;
+    }
+};
+
+template<typename T, size_t N>
+constexpr nsSdD::CStaticList<T, N>::CStaticList () noexcept
+        : m_nodes (), m_first (nil), m_last (nil), m_free (nil), m_unused (0), m_size (0)
+{
+}
+
+template<typename T, size_t N>
+nsSdD::CStaticList<T, N>::CStaticList (size_type n, const T &val) noexcept : CStaticList ()
+{
+    insert (cend (), std::min (n, N), val);
+}
+
+template<typename T, size_t N>
+template<class InputIterator, class>
+nsSdD::CStaticList<T, N>::CStaticList (InputIterator first, InputIterator last) noexcept : CStaticList ()
+{
+    for (; first != last && push_back (*first); ++first)
+        ;
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::begin () noexcept
+{
+    return iterator (this, m_first);
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::end () noexcept
+{
+    return iterator (this, nil);
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::const_iterator nsSdD::CStaticList<T, N>::cbegin () const noexcept
+{
+    return const_iterator (this, m_first);
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::const_iterator nsSdD::CStaticList<T, N>::cend () const noexcept
+{
+    return const_iterator (this, nil);
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::reverse_iterator nsSdD::CStaticList<T, N>::rbegin () noexcept
+{
+    return reverse_iterator (end ());
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::reverse_iterator nsSdD::CStaticList<T, N>::rend () noexcept
+{
+    return reverse_iterator (begin ());
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::const_reverse_iterator nsSdD::CStaticList<T, N>::crbegin () const noexcept
+{
+    return const_reverse_iterator (cend ());
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::const_reverse_iterator nsSdD::CStaticList<T, N>::crend () const noexcept
+{
+    return const_reverse_iterator (cbegin ());
+}
+
+template<typename T, size_t N>
+constexpr bool nsSdD::CStaticList<T, N>::empty () const noexcept
+{
+    return m_size == 0;
+}
+
+template<typename T, size_t N>
+constexpr bool nsSdD::CStaticList<T, N>::full () const noexcept
+{
+    return m_size == N;
+}
+
+template<typename T, size_t N>
+constexpr typename nsSdD::CStaticList<T, N>::size_type nsSdD::CStaticList<T, N>::size () const noexcept
+{
+    return m_size;
+}
+
+template<typename T, size_t N>
+constexpr typename nsSdD::CStaticList<T, N>::size_type nsSdD::CStaticList<T, N>::capacity () noexcept
+{
+    return N;
+}
+
+template<typename T, size_t N>
+constexpr typename nsSdD::CStaticList<T, N>::size_type nsSdD::CStaticList<T, N>::max_size () noexcept
+{
+    return N;
+}
+
+template<typename T, size_t N>
+T &nsSdD::CStaticList<T, N>::front () noexcept
+{
+    return m_nodes[m_first].m_info;
+}
+
+template<typename T, size_t N>
+const T &nsSdD::CStaticList<T, N>::front () const noexcept
+{
+    return m_nodes[m_first].m_info;
+}
+
+template<typename T, size_t N>
+T &nsSdD::CStaticList<T, N>::back () noexcept
+{
+    return m_nodes[m_last].m_info;
+}
+
+template<typename T, size_t N>
+const T &nsSdD::CStaticList<T, N>::back () const noexcept
+{
+    return m_nodes[m_last].m_info;
+}
+
+template<typename T, size_t N>
+bool nsSdD::CStaticList<T, N>::assign (size_type n, const T &val) noexcept
+{
+    if (n > N)
+        return false;
+
+    clear ();
+    insert (cend (), n, val);
+
+    return true;
+}
+
+template<typename T, size_t N>
+template<class InputIterator, class>
+bool nsSdD::CStaticList<T, N>::assign (InputIterator first, InputIterator last) noexcept
+{
+    clear ();
+
+    for (; first != last; ++first)
+        if (!push_back (*first))
+        {
+            clear ();
+            return false;
+        }
+
+    return true;
+}
+
+template<typename T, size_t N>
+bool nsSdD::CStaticList<T, N>::push_front (const T &x) noexcept
+{
+    return emplace (cbegin (), x) != end ();
+}
+
+template<typename T, size_t N>
+bool nsSdD::CStaticList<T, N>::push_back (const T &x) noexcept
+{
+    return emplace (cend (), x) != end ();
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::pop_front () noexcept
+{
+    if (!empty ())
+        erase (cbegin ());
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::pop_back () noexcept
+{
+    if (!empty ())
+        erase (const_iterator (this, m_last));
+}
+
+template<typename T, size_t N>
+template<typename... Args>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::emplace (const_iterator position, Args &&... args) noexcept
+{
+    index_type node = acquire (std::forward<Args> (args)...);
+    if (node == nil)
+        return end ();
+
+    linkBefore (position.getNode (), node);
+
+    return iterator (this, node);
+}
+
+template<typename T, size_t N>
+template<typename... Args>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::emplace_front (Args &&... args) noexcept
+{
+    return emplace (cbegin (), std::forward<Args> (args)...);
+}
+
+template<typename T, size_t N>
+template<typename... Args>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::emplace_back (Args &&... args) noexcept
+{
+    return emplace (cend (), std::forward<Args> (args)...);
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::insert (const_iterator position, const T &val) noexcept
+{
+    return emplace (position, val);
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::insert (const_iterator position, size_type n, const T &val) noexcept
+{
+    if (n > N - size ())
+        return end ();
+
+    iterator first (this, position.getNode ());
+    for (size_type i = 0; i < n; ++i)
+    {
+        iterator inserted = emplace (position, val);
+        if (i == 0)
+            first = inserted;
+    }
+
+    return first;
+}
+
+template<typename T, size_t N>
+template<class InputIterator, class>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::insert (const_iterator position, InputIterator first, InputIterator last) noexcept
+{
+    // The length of an input range is only known once inserted: the elements inserted are erased on overflow.
+    iterator inserted (this, position.getNode ());
+    for (bool any = false; first != last; ++first)
+    {
+        iterator node = emplace (position, *first);
+        if (node == end ())
+        {
+            if (any)
+                erase (inserted, position);
+            return end ();
+        }
+
+        if (!any)
+            inserted = node;
+        any = true;
+    }
+
+    return inserted;
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::erase (const_iterator position) noexcept
+{
+    index_type node = position.getNode (), next = m_nodes[node].m_next;
+
+    unlink (node);
+    release (node);
+
+    return iterator (this, next);
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::iterator nsSdD::CStaticList<T, N>::erase (const_iterator first, const_iterator last) noexcept
+{
+    while (first != last)
+        first = erase (first);
+
+    return iterator (this, last.getNode ());
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::swap (CStaticList &x) noexcept
+{
+    std::swap (*this, x);
+}
+
+template<typename T, size_t N>
+bool nsSdD::CStaticList<T, N>::resize (size_type n, const T &val /*= T ()*/) noexcept
+{
+    if (n > N)
+        return false;
+
+    while (size () > n)
+        pop_back ();
+
+    insert (cend (), n - size (), val);
+
+    return true;
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::clear () noexcept
+{
+    for (index_type node = m_first; node != nil;)
+    {
+        index_type next = m_nodes[node].m_next;
+        release (node);
+        node = next;
+    }
+
+    m_first = m_last = nil;
+}
+
+template<typename T, size_t N>
+bool nsSdD::CStaticList<T, N>::splice (const_iterator position, CStaticList &x) noexcept
+{
+    return splice (position, x, x.cbegin (), x.cend ());
+}
+
+template<typename T, size_t N>
+bool nsSdD::CStaticList<T, N>::splice (const_iterator position, CStaticList &x, const_iterator i) noexcept
+{
+    const_iterator last = i;
+    return splice (position, x, i, ++last);
+}
+
+template<typename T, size_t N>
+bool nsSdD::CStaticList<T, N>::splice (const_iterator position, CStaticList &x, const_iterator first, const_iterator last) noexcept
+{
+    if (first == last || (&x == this && (position == first || position == last)))
+        return true;
+
+    if (&x == this)
+    {
+        // Relinked: the chain from first to before last is cut, then linked before position
+        index_type chainFirst = first.getNode (), previous = m_nodes[chainFirst].m_previous;
+        index_type chainLast = last.getNode () == nil ? m_last : m_nodes[last.getNode ()].m_previous;
+
+        nextLink (previous) = last.getNode ();
+        previousLink (last.getNode ()) = previous;
+
+        index_type before = previousLink (position.getNode ());
+        nextLink (before) = chainFirst;
+        m_nodes[chainFirst].m_previous = before;
+        m_nodes[chainLast].m_next = position.getNode ();
+        previousLink (position.getNode ()) = chainLast;
+
+        return true;
+    }
+
+    if (size_type (std::distance (first, last)) > N - size ())
+        return false;
+
+    // Another CStaticList: the values are moved into nodes of this one
+    while (first != last)
+    {
+        index_type node = first.getNode ();
+        ++first;
+
+        linkBefore (position.getNode (), acquire (std::move (x.m_nodes[node].m_info)));
+        x.unlink (node);
+        x.release (node);
+    }
+
+    return true;
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::remove (const T &val) noexcept
+{
+    remove_if ([val] (const T &x)
+    {
+        return x == val;
+    });
+}
+
+template<typename T, size_t N>
+template<class Predicate>
+void nsSdD::CStaticList<T, N>::remove_if (Predicate pred) noexcept
+{
+    for (index_type node = m_first; node != nil;)
+    {
+        index_type next = m_nodes[node].m_next;
+        if (pred (m_nodes[node].m_info))
+        {
+            unlink (node);
+            release (node);
+        }
+        node = next;
+    }
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::unique () noexcept
+{
+    unique ([] (const T &a, const T &b)
+    {
+        return a == b;
+    });
+}
+
+template<typename T, size_t N>
+template<class Compare>
+void nsSdD::CStaticList<T, N>::unique (Compare pred) noexcept
+{
+    for (index_type node = m_first; node != nil; node = m_nodes[node].m_next)
+        while (m_nodes[node].m_next != nil && pred (m_nodes[node].m_info, m_nodes[m_nodes[node].m_next].m_info))
+        {
+            index_type duplicate = m_nodes[node].m_next;
+            unlink (duplicate);
+            release (duplicate);
+        }
+}
+
+template<typename T, size_t N>
+bool nsSdD::CStaticList<T, N>::merge (CStaticList &x) noexcept
+{
+    return merge (x, [] (const T &a, const T &b)
+    {
+        return a < b;
+    });
+}
+
+template<typename T, size_t N>
+template<class Compare>
+bool nsSdD::CStaticList<T, N>::merge (CStaticList &x, Compare comp) noexcept
+{
+    if (&x == this || x.empty ())
+        return true;
+
+    if (x.size () > N - size ())
+        return false;
+
+    // Each element of x goes after the elements of the CStaticList which are not greater
+    index_type position = m_first;
+    while (!x.empty ())
+    {
+        index_type moved = x.m_first;
+        while (position != nil && !comp (x.m_nodes[moved].m_info, m_nodes[position].m_info))
+            position = m_nodes[position].m_next;
+
+        linkBefore (position, acquire (std::move (x.m_nodes[moved].m_info)));
+        x.unlink (moved);
+        x.release (moved);
+    }
+
+    return true;
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::sort () noexcept
+{
+    sort ([] (const T &a, const T &b)
+    {
+        return a < b;
+    });
+}
+
+template<typename T, size_t N>
+template<class Compare>
+void nsSdD::CStaticList<T, N>::sort (Compare comp) noexcept
+{
+    if (m_size < 2)
+        return;
+
+    // Bottom-up merge sort on the forward links: buckets[i] holds a sorted chain of 2^i nodes, older than any
+    // node carried in.
+    index_type buckets[64];
+    std::fill (buckets, buckets + 64, nil);
+    size_t fill = 0;
+    index_type last = nil;
+
+    for (index_type node = m_first; node != nil;)
+    {
+        index_type carry = node;
+        node = m_nodes[node].m_next;
+        m_nodes[carry].m_next = nil;
+
+        size_t i = 0;
+        for (; i < fill && buckets[i] != nil; ++i)
+        {
+            carry = mergeChains (buckets[i], carry, comp, last);
+            buckets[i] = nil;
+        }
+
+        buckets[i] = carry;
+        if (i == fill)
+            ++fill;
+    }
+
+    index_type sorted = nil;
+    for (size_t i = 0; i < fill; ++i)
+        if (buckets[i] != nil)
+            sorted = mergeChains (buckets[i], sorted, comp, last);
+
+    // The backward links are rebuilt from the forward ones
+    m_first = sorted;
+    m_last = last;
+    for (index_type node = m_first, previous = nil; node != nil; previous = node, node = m_nodes[node].m_next)
+        m_nodes[node].m_previous = previous;
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::reverse () noexcept
+{
+    for (index_type node = m_first; node != nil; node = m_nodes[node].m_previous)
+        std::swap (m_nodes[node].m_next, m_nodes[node].m_previous);
+
+    std::swap (m_first, m_last);
+}
+
+template<typename T, size_t N>
+template<typename... Args>
+typename nsSdD::CStaticList<T, N>::index_type nsSdD::CStaticList<T, N>::acquire (Args &&... args) noexcept
+{
+    if (full ())
+        return nil;
+
+    index_type node = m_free;
+    if (node != nil)
+        m_free = m_nodes[node].m_next;
+    else
+        node = m_unused++;
+
+    m_nodes[node].m_info = T (std::forward<Args> (args)...);
+    ++m_size;
+
+    return node;
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::release (index_type node) noexcept
+{
+    m_nodes[node].m_info = T ();
+    m_nodes[node].m_next = m_free;
+    m_free = node;
+    --m_size;
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::linkBefore (index_type position, index_type node) noexcept
+{
+    index_type previous = previousLink (position);
+
+    m_nodes[node].m_next = position;
+    m_nodes[node].m_previous = previous;
+    nextLink (previous) = node;
+    previousLink (position) = node;
+}
+
+template<typename T, size_t N>
+void nsSdD::CStaticList<T, N>::unlink (index_type node) noexcept
+{
+    nextLink (m_nodes[node].m_previous) = m_nodes[node].m_next;
+    previousLink (m_nodes[node].m_next) = m_nodes[node].m_previous;
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::index_type &nsSdD::CStaticList<T, N>::nextLink (index_type node) noexcept
+{
+    return node == nil ? m_first : m_nodes[node].m_next;
+}
+
+template<typename T, size_t N>
+typename nsSdD::CStaticList<T, N>::index_type &nsSdD::CStaticList<T, N>::previousLink (index_type node) noexcept
+{
+    return node == nil ? m_last : m_nodes[node].m_previous;
+}
+
+template<typename T, size_t N>
+template<class Compare>
+typename nsSdD::CStaticList<T, N>::index_type nsSdD::CStaticList<T, N>::mergeChains (index_type a, index_type b, Compare comp, index_type &last) noexcept
+{
+    index_type first = nil;
+    index_type *link = &first;
+
+    while (a != nil && b != nil)
+    {
+        if (comp (m_nodes[b].m_info, m_nodes[a].m_info))
+        {
+            *link = last = b;
+            b = m_nodes[b].m_next;
+        }
+        else
+        {
+            *link = last = a;
+            a = m_nodes[a].m_next;
+        }
+        link = &m_nodes[last].m_next;
+    }
+
+    for (*link = a != nil ? a : b; *link != nil; link = &m_nodes[last].m_next)
+        last = *link;
+
+    return first;
+}
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <functional>
 #include <string>
 
+#include "CSerializer.h"
+
 namespace nsTests
 {
     /*!
@@ -62,4 +65,48 @@ namespace nsTests
     {
         return os << "PERS. " << p.getName () << ". " << p.getA ();
     }
+}
+
+namespace std
+{
+    /*!
+        @brief Hashes a TestClass, so that it can be used as a key of hashed containers.
+     */
+    template<>
+    struct hash<nsTests::TestClass>
+    {
+        size_t operator() (const nsTests::TestClass &c) const noexcept
+        {
+            return hash<int> () (c.getA ()) ^ (hash<string> () (c.getName ()) << 1);
+        }
+    };
+}
+
+namespace nsSdD
+{
+    /*!
+        @brief Serializes a TestClass as its int followed by its name.
+     */
+    template<>
+    struct CSerializer<nsTests::TestClass>
+    {
+        static const bool bulk = false;
+
+        static void write (CByteWriter &out, const nsTests::TestClass &x) noexcept
+        {
+            out.write (static_cast<std::int32_t> (x.getA ()));
+            out.write (x.getName ());
+        }
+
+        static bool read (CByteReader &in, nsTests::TestClass &x) noexcept
+        {
+            std::int32_t a;
+            std::string name;
+            if (!in.read (a) || !in.read (name))
+                return false;
+
+            x = nsTests::TestClass (a, name);
+            return true;
+        }
+    };
 }
\ No newline at end of file
@@ -1,11 +1,36 @@
 #include "CTests.h"
 #include "IziAssert.h"
 #include "CList.h"
+#include "CIndexedList.h"
+#include "CListStream.h"
+#include "CLruCache.h"
+#include "CIntrusiveList.h"
+#include "CMappedList.h"
+#include "CForwardList.h"
+#include "CPersistentList.h"
+#include "CRcuList.h"
+#include "CStaticList.h"
+#include "CBlockingList.h"
+#include "CTimerWheel.h"
+#include "CView.h"
+#include "CGenerator.h"
 #include "CTestClass.h"
 #include "CValueProvider.h"
 
 #include <ctime>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 using namespace nsTests;
 using namespace std;
@@ -16,6 +41,11 @@ namespace
     //template<typename T> using CTestedList = list<T>;
     template<typename T> using CTestedList = CList<T>;
 
+    /*!
+        @brief The number of operator new calls since the start of the program.
+     */
+    atomic<size_t> g_allocations (0);
+
     template<typename T>
     void CreateEmptyList () noexcept
     {
@@ -78,6 +108,43 @@ namespace
         }
     }
 
+    template<typename T>
+    void AssignList () noexcept
+    {
+        const int listSize = 10;
+        CCollection<T> data = CValueProvider<T> () (listSize + 1);
+        CTestedList<T> source (data.cbegin (), data.cbegin () + listSize);
+
+        // The target is destroyed after the assignment, the source keeps its own nodes
+        {
+            CTestedList<T> target;
+            target.push_back (data[listSize]);
+            target = source;
+            IZI_ASSERT(target.size () == size_t (listSize));
+            IZI_ASSERT(equal (target.cbegin (), target.cend (), source.cbegin ()));
+
+            target.pop_front ();
+            IZI_ASSERT(source.size () == size_t (listSize) && source.front () == data[0]);
+        }
+        IZI_ASSERT(source.size () == size_t (listSize));
+        IZI_ASSERT(equal (source.cbegin (), source.cend (), data.cbegin ()));
+
+        source = source;
+        IZI_ASSERT(source.size () == size_t (listSize));
+
+        // The moved-from list is left empty and usable
+        CTestedList<T> moved;
+        moved.push_back (data[listSize]);
+        moved = std::move (source);
+        IZI_ASSERT(source.empty () && source.cbegin () == source.cend ());
+        IZI_ASSERT(equal (moved.cbegin (), moved.cend (), data.cbegin ()) && moved.size () == size_t (listSize));
+
+        CTestedList<T> constructed (std::move (moved));
+        IZI_ASSERT(moved.empty () && constructed.size () == size_t (listSize));
+        source.push_back (data[0]);
+        IZI_ASSERT(source.size () == 1);
+    }
+
     template<typename T>
     void CreateListByImplicitCopy () noexcept
     {
@@ -544,6 +611,11 @@ namespace
         for (T x : list)
             IZI_ASSERT(x == data[0]);
         IZI_ASSERT(list.size () == listSize);
+
+        // Growing a non-empty CList adds only the missing elements
+        list.resize (listSize + 5, data[1]);
+        IZI_ASSERT(list.size () == listSize + 5);
+        IZI_ASSERT(list.back () == data[1] && list.front () == data[0]);
     }
 
     template<typename T>
@@ -685,6 +757,11 @@ namespace
         IZI_ASSERT(list.size () == data.size ());
         for (auto itr = list.cbegin (); itr != list.cend (); ++itr)
             IZI_ASSERT(*itr == data[distance (list.cbegin (), itr)]);
+
+        // The last element equals the value of the sentinels
+        CTestedList<T> defaults (typename CTestedList<T>::size_type (3), T ());
+        defaults.unique ();
+        IZI_ASSERT(defaults.size () == 1 && defaults.front () == T ());
     }
 
     template<typename T>
@@ -709,6 +786,40 @@ namespace
             IZI_ASSERT(*itr == data[distance (list.cbegin (), itr)]);
     }
 
+    template<typename T>
+    void Dedup () noexcept
+    {
+        for (EDistribution distribution : { EDistribution::Random, EDistribution::ManyDuplicates, EDistribution::AllEqual })
+        {
+            CCollection<T> data = CValueProvider<T> () (300, distribution);
+            CCollection<T> expected;
+            for (const T &x : data)
+                if (find (expected.cbegin (), expected.cend (), x) == expected.cend ())
+                    expected.push_back (x);
+
+            CTestedList<T> list (data.cbegin (), data.cend ());
+            IZI_ASSERT(list.dedup () == data.size () - expected.size ());
+            IZI_ASSERT(list.size () == expected.size ());
+            IZI_ASSERT(equal (list.cbegin (), list.cend (), expected.cbegin ()));
+            IZI_ASSERT(list.dedup () == 0);
+        }
+
+        // All the elements collide and are equal: only the first one is kept
+        CCollection<T> data = CValueProvider<T> () (50);
+        CTestedList<T> list (data.cbegin (), data.cend ());
+        IZI_ASSERT(list.dedup ([] (const T &)
+        {
+            return size_t (0);
+        }, [] (const T &, const T &)
+        {
+            return true;
+        }) == data.size () - 1);
+        IZI_ASSERT(list.size () == 1 && list.front () == data.front ());
+
+        CTestedList<T> empty;
+        IZI_ASSERT(empty.dedup () == 0 && empty.empty ());
+    }
+
     template<typename T>
     void Merge () noexcept
     {
@@ -741,10 +852,16 @@ namespace
         CCollection<T> data = CValueProvider<T> () (20);
 
         list.insert (list.begin (), data.cbegin (), data.cend ());
+        auto first = list.cbegin ();
+        const T firstValue = *first;
         list.sort ();
 
         for (auto itr = list.cbegin (); itr != --list.cend ();)
             IZI_ASSERT(*itr <= *++itr)
+
+        // The nodes are relinked: an iterator keeps its element
+        IZI_ASSERT(*first == firstValue);
+        IZI_ASSERT(is_permutation (list.cbegin (), list.cend (), data.cbegin ()));
     }
 
     template<typename T>
@@ -763,6 +880,145 @@ namespace
             IZI_ASSERT(*itr >= *++itr)
     }
 
+    template<typename T>
+    void Partition () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (100);
+        CCollection<T> sorted (data);
+        sort (sorted.begin (), sorted.end ());
+        const T median = sorted[sorted.size () / 2];
+        auto isLess = [&median] (const T &x)
+        {
+            return x < median;
+        };
+
+        CCollection<T> expected;
+        copy_if (data.cbegin (), data.cend (), back_inserter (expected), isLess);
+        size_t lessCount = expected.size ();
+        remove_copy_if (data.cbegin (), data.cend (), back_inserter (expected), isLess);
+
+        // Both parts keep their order, also against the links of a reversed list
+        for (bool reversed : { false, true })
+        {
+            CTestedList<T> list (data.cbegin (), data.cend ());
+            if (reversed)
+            {
+                list.reverse ();
+                list.materialize_reverse ();
+                list.reverse ();
+            }
+
+            vector<const T *> nodes;
+            for (const T &x : list)
+                nodes.push_back (&x);
+
+            auto split = reversed ? list.stable_partition (isLess) : list.partition (isLess);
+            IZI_ASSERT(list.size () == data.size ());
+            IZI_ASSERT(size_t (distance (list.begin (), split)) == lessCount);
+            IZI_ASSERT(equal (list.cbegin (), list.cend (), expected.cbegin ()));
+
+            // The nodes were relinked, not copied
+            for (const T &x : list)
+                IZI_ASSERT(find (nodes.cbegin (), nodes.cend (), &x) != nodes.cend ());
+        }
+
+        CTestedList<T> list (data.cbegin (), data.cend ());
+        IZI_ASSERT(list.partition ([] (const T &)
+        {
+            return true;
+        }) == list.end ());
+        IZI_ASSERT(list.stable_partition ([] (const T &)
+        {
+            return false;
+        }) == list.begin ());
+        IZI_ASSERT(equal (list.cbegin (), list.cend (), data.cbegin ()));
+    }
+
+    template<typename T>
+    void NthElement () noexcept
+    {
+        for (EDistribution distribution : { EDistribution::Random, EDistribution::Sorted, EDistribution::ReverseSorted,
+                                            EDistribution::ManyDuplicates, EDistribution::AllEqual })
+        {
+            CCollection<T> data = CValueProvider<T> () (200, distribution);
+            CCollection<T> sorted (data);
+            sort (sorted.begin (), sorted.end ());
+
+            for (size_t n : { size_t (0), size_t (1), size_t (57), size_t (100), size_t (199) })
+            {
+                CTestedList<T> list (data.cbegin (), data.cend ());
+                auto nth = list.nth_element (n);
+
+                IZI_ASSERT(list.size () == data.size ());
+                IZI_ASSERT(size_t (distance (list.begin (), nth)) == n);
+                IZI_ASSERT(*nth == sorted[n]);
+                for (auto itr = list.cbegin (); itr != list.cend (); ++itr)
+                    IZI_ASSERT(size_t (distance (list.cbegin (), itr)) < n ? !(*nth < *itr) : !(*itr < *nth));
+                IZI_ASSERT(is_permutation (list.cbegin (), list.cend (), data.cbegin ()));
+            }
+
+            // Equal elements keep their order
+            CTestedList<T> list (data.cbegin (), data.cend ());
+            unordered_map<const T *, size_t> origins;
+            for (const T &x : list)
+                origins.emplace (&x, origins.size ());
+            list.nth_element (100);
+            for (auto itr1 = list.cbegin (); itr1 != list.cend (); ++itr1)
+                for (auto itr2 = next (itr1); itr2 != list.cend (); ++itr2)
+                    if (*itr1 == *itr2)
+                        IZI_ASSERT(origins[&*itr1] < origins[&*itr2]);
+
+            IZI_ASSERT(list.nth_element (data.size ()) == list.end ());
+            IZI_ASSERT(*list.nth_element (10, [] (const T &a, const T &b)
+            {
+                return b < a;
+            }) == sorted[sorted.size () - 11]);
+        }
+    }
+
+    template<typename T>
+    void PartialSort () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (300, EDistribution::ManyDuplicates);
+        CCollection<T> sorted (data);
+        sort (sorted.begin (), sorted.end ());
+
+        for (size_t k : { size_t (0), size_t (1), size_t (25), size_t (299), size_t (300), size_t (1000) })
+        {
+            CTestedList<T> list (data.cbegin (), data.cend ());
+            list.partial_sort (k);
+
+            size_t sortedCount = min (k, data.size ());
+            IZI_ASSERT(list.size () == data.size ());
+            IZI_ASSERT(equal (sorted.cbegin (), sorted.cbegin () + sortedCount, list.cbegin ()));
+            IZI_ASSERT(is_permutation (list.cbegin (), list.cend (), data.cbegin ()));
+        }
+
+        // Stable, whether everything is sorted or only a prefix: equal elements keep their order
+        for (size_t k : { data.size (), size_t (25) })
+        {
+            CTestedList<T> list (data.cbegin (), data.cend ());
+            vector<const T *> nodes;
+            for (const T &x : list)
+                nodes.push_back (&x);
+            list.partial_sort (k, [] (const T &a, const T &b)
+            {
+                return b < a;
+            });
+            IZI_ASSERT(equal (sorted.crbegin (), sorted.crbegin () + k, list.cbegin ()));
+
+            auto last = list.cbegin ();
+            advance (last, k - 1);
+            for (auto itr = list.cbegin (); itr != last;)
+            {
+                const T *current = &*itr;
+                const T *next = &*++itr;
+                if (*current == *next)
+                    IZI_ASSERT(find (nodes.cbegin (), nodes.cend (), current) < find (nodes.cbegin (), nodes.cend (), next));
+            }
+        }
+    }
+
     template<typename T>
     void Reverse () noexcept
     {
@@ -774,6 +1030,198 @@ namespace
             IZI_ASSERT(*itrList == *itrData);
     }
 
+    template<typename T>
+    void ReverseFlag () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (20);
+        CCollection<T> expected (data.crbegin (), data.crend ());
+        CTestedList<T> list (data.cbegin (), data.cend ());
+
+        list.reverse ();
+        IZI_ASSERT(list.isReversed ());
+        IZI_ASSERT(list.front () == data.back () && list.back () == data.front ());
+
+        list.push_front (data[1]);
+        expected.insert (expected.begin (), data[1]);
+        list.push_back (data[2]);
+        expected.push_back (data[2]);
+        list.insert (++list.begin (), typename CTestedList<T>::size_type (2), data[3]);
+        expected.insert (expected.begin () + 1, 2, data[3]);
+        list.insert (list.end (), data.cbegin (), data.cbegin () + 3);
+        expected.insert (expected.end (), data.cbegin (), data.cbegin () + 3);
+        list.erase (--list.end ());
+        expected.pop_back ();
+        list.pop_front ();
+        expected.erase (expected.begin ());
+        IZI_ASSERT(list.size () == expected.size ());
+        IZI_ASSERT(equal (list.cbegin (), list.cend (), expected.cbegin ()));
+        IZI_ASSERT(equal (expected.crbegin (), expected.crend (), list.crbegin ()));
+
+        // Splices between lists of both orientations
+        CTestedList<T> other (data.cbegin (), data.cbegin () + 5);
+        list.splice (list.begin (), other, ++other.begin (), --other.end ());
+        expected.insert (expected.begin (), data.cbegin () + 1, data.cbegin () + 4);
+        list.splice (list.end (), other, other.begin ());
+        expected.push_back (data[0]);
+        other.reverse ();
+        list.splice (++list.begin (), other);
+        expected.insert (expected.begin () + 1, data[4]);
+        IZI_ASSERT(other.empty () && list.size () == expected.size ());
+        IZI_ASSERT(equal (list.cbegin (), list.cend (), expected.cbegin ()));
+
+        CTestedList<T> unreversed;
+        unreversed.splice (unreversed.end (), list, list.begin (), list.end ());
+        IZI_ASSERT(list.empty () && !unreversed.isReversed ());
+        IZI_ASSERT(equal (unreversed.cbegin (), unreversed.cend (), expected.cbegin ()));
+        list.splice (list.end (), unreversed);
+
+        // The physical reversal keeps the order, which the links then follow
+        list.materialize_reverse ();
+        IZI_ASSERT(!list.isReversed ());
+        IZI_ASSERT(equal (list.cbegin (), list.cend (), expected.cbegin ()));
+        auto ptr = list.getHead ();
+        for (const T &x : expected)
+        {
+            ptr = ptr->getNext ();
+            IZI_ASSERT(x == ptr->getInfo ());
+        }
+        IZI_ASSERT(ptr->getNext () == list.getTail ());
+
+        list.reverse ();
+        list.reverse ();
+        IZI_ASSERT(!list.isReversed ());
+        IZI_ASSERT(equal (list.cbegin (), list.cend (), expected.cbegin ()));
+
+        // Erasing a range returns an iterator in the orientation of the CList
+        list.reverse ();
+        reverse (expected.begin (), expected.end ());
+        auto following = list.erase (list.begin (), next (list.begin (), 2));
+        expected.erase (expected.begin (), expected.begin () + 2);
+        IZI_ASSERT(following == list.begin () && *following == expected[0]);
+        IZI_ASSERT(*++following == expected[1]);
+        IZI_ASSERT(equal (list.cbegin (), list.cend (), expected.cbegin ()));
+    }
+
+    template<typename T>
+    void MemoryUsage () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (50);
+        CTestedList<T> list (data.cbegin (), data.cend ());
+
+        CMemoryUsage usage = list.memory_usage ();
+        IZI_ASSERT(!usage.deep);
+        IZI_ASSERT(usage.payload == data.size () * sizeof (T));
+        IZI_ASSERT(usage.links >= data.size () * 2 * sizeof (void *));
+        IZI_ASSERT(usage.allocationSize >= sizeof (T) + 2 * sizeof (void *));
+        IZI_ASSERT(usage.sentinels == 2 * usage.allocationSize);
+        IZI_ASSERT(usage.total () == usage.payload + usage.links + usage.allocatorOverhead + usage.sentinels);
+        IZI_ASSERT(usage.total () == (data.size () + 2) * usage.allocationSize);
+
+        usage = list.memory_usage (true);
+        IZI_ASSERT(usage.deep);
+        IZI_ASSERT(usage.nodes == data.size ());
+        IZI_ASSERT(usage.addressSpread >= usage.nodes * usage.allocationSize);
+        IZI_ASSERT(usage.pages >= 1 && usage.adjacentSteps < usage.nodes);
+        IZI_ASSERT(usage.fragmentation >= 0 && usage.fragmentation < 1);
+
+        list.reverse ();
+        IZI_ASSERT(list.memory_usage (true).nodes == data.size ());
+        list.reverse ();
+
+        // The nodes are freed by clear, resize and the destructor
+        weak_ptr<typename decltype (list.getHead ())::element_type> cleared = list.getHead ()->getNext ();
+        list.clear ();
+        IZI_ASSERT(cleared.expired ());
+        IZI_ASSERT(list.memory_usage (true).nodes == 0 && list.memory_usage ().payload == 0);
+
+        list.assign (data.cbegin (), data.cend ());
+        weak_ptr<typename decltype (list.getHead ())::element_type> cut = list.getTail ()->getPrevious ();
+        list.resize (data.size () / 2);
+        IZI_ASSERT(cut.expired ());
+
+        weak_ptr<typename decltype (list.getHead ())::element_type> destroyed, sentinel;
+        {
+            CTestedList<T> scoped (data.cbegin (), data.cend ());
+            destroyed = scoped.getHead ()->getNext ();
+            sentinel = scoped.getHead ();
+        }
+        IZI_ASSERT(destroyed.expired () && sentinel.expired ());
+    }
+
+    template<typename T>
+    void NodeCacheHandoff () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (1000);
+        CTestedList<T> list (data.cbegin (), data.cend ());
+
+        CNodeCache::CStats before = CTestedList<T>::node_cache_stats ();
+        IZI_ASSERT(before.slabs > 0 && before.live >= data.size ());
+        IZI_ASSERT(before.slotSize == list.memory_usage ().allocationSize);
+
+        // The nodes freed by another thread come back to this one
+        thread consumer ([&list, &data] ()
+        {
+            for (const T &x : data)
+            {
+                IZI_ASSERT(list.front () == x);
+                list.pop_front ();
+            }
+        });
+        consumer.join ();
+
+        CNodeCache::CStats freed = CTestedList<T>::node_cache_stats ();
+        IZI_ASSERT(freed.remoteFreed == before.remoteFreed + data.size ());
+        IZI_ASSERT(freed.live == before.live - data.size ());
+
+        // And are reused without new slabs
+        list.assign (data.cbegin (), data.cend ());
+        IZI_ASSERT(CTestedList<T>::node_cache_stats ().slabs == before.slabs);
+
+        // The nodes of a thread which exited are still valid, and freed here
+        CTestedList<T> orphans;
+        thread producer ([&orphans, &data] ()
+        {
+            orphans.assign (data.cbegin (), data.cend ());
+        });
+        producer.join ();
+
+        IZI_ASSERT(orphans.size () == data.size ());
+        IZI_ASSERT(equal (orphans.cbegin (), orphans.cend (), data.cbegin ()));
+        orphans.clear ();
+    }
+
+    template<typename T>
+    void HugePageArena () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (1000);
+        CHugePageArena &arena = CHugePageArena::instance ();
+        CHugePageArena::CStats before = arena.stats ();
+
+        // The caches of a new thread take their slabs from the arena
+        CHugePageArena::setEnabled (true);
+        thread user ([&data, &arena] ()
+        {
+            CTestedList<T> list (data.cbegin (), data.cend ());
+            IZI_ASSERT(equal (list.cbegin (), list.cend (), data.cbegin ()));
+
+            // No region out of Linux, or when mmap fails: the slabs come from operator new
+            CHugePageArena::CStats stats = arena.stats ();
+            IZI_ASSERT(stats.regions == 0 || arena.owns (&*list.begin ()));
+            IZI_ASSERT(stats.regions == 0 || stats.usedBytes >= CHugePageArena::blockBytes);
+            IZI_ASSERT(stats.hugetlbBytes + stats.advisedBytes == stats.mappedBytes);
+            IZI_ASSERT(stats.hugeBytes <= stats.mappedBytes);
+            IZI_ASSERT(stats.coverage () >= 0 && stats.coverage () <= 1);
+        });
+        user.join ();
+        CHugePageArena::setEnabled (false);
+
+        // The slabs of the exited thread went back to the arena
+        IZI_ASSERT(arena.stats ().usedBytes == before.usedBytes);
+
+        CTestedList<T> list (data.cbegin (), data.cend ());
+        IZI_ASSERT(!arena.owns (&*list.begin ()));
+    }
+
     template <class T>
     void TestCNode () noexcept
     {
@@ -806,92 +1254,1803 @@ namespace
     }
 
     template<typename T>
-    void RunTemplatedTests () noexcept
+    void IndexedListFind () noexcept
     {
-        IZI_SUBTEST(CreateEmptyList<T> ());
-        IZI_SUBTEST(CreateSizedList<T> ());
+        CIndexedList<T> list;
+        CCollection<T> data = CValueProvider<T> () ();
+        CCollection<T> inserted;
 
-        for (T x : CValueProvider<T> () (5))
-        IZI_SUBTEST(CreateSizeListWithValue<T> (x));
+        for (T x : data)
+            if (list.push_back (x).second)
+                inserted.push_back (x);
 
-        IZI_SUBTEST(CreateListByExplicitCopy<T> ());
-        IZI_SUBTEST(CreateListByImplicitCopy<T> ());
+        IZI_ASSERT(list.size () == inserted.size ());
+        for (T x : inserted)
+        {
+            IZI_ASSERT(list.contains (x));
+            IZI_ASSERT(*list.find (x) == x);
+        }
 
-        IZI_SUBTEST(Iterate<T> ());
-        IZI_SUBTEST(ConstIterate<T> ());
-        IZI_SUBTEST(ReverseIterate<T> ());
-        IZI_SUBTEST(ReverseConstIterate<T> ());
+        IZI_ASSERT(!list.push_front (inserted[0]).second);
+        IZI_ASSERT(list.size () == inserted.size ());
+        IZI_ASSERT(list.front () == inserted[0]);
 
-        IZI_SUBTEST(IsEmpty<T> ());
-        IZI_SUBTEST(Size<T> ());
+        // The iterators of the index follow the order once reversed
+        list.reverse ();
+        IZI_ASSERT(list.front () == inserted.back ());
+        for (size_t i = 1; i < inserted.size (); ++i)
+            IZI_ASSERT(*++list.find (inserted[i]) == inserted[i - 1]);
+        IZI_ASSERT(++list.find (inserted[0]) == list.end ());
+    }
 
-        IZI_SUBTEST(Front<T> ());
-        IZI_SUBTEST(Back<T> ());
+    template<typename T>
+    void IndexedListErase () noexcept
+    {
+        CIndexedList<T> list;
+        CCollection<T> data = CValueProvider<T> () ();
+        CCollection<T> kept;
 
-        IZI_SUBTEST(AssignByIterator<T> ());
-        for (T x : CValueProvider<T> () (5))
-        IZI_SUBTEST(AssignByValue (x));
+        for (T x : data)
+            list.push_back (x);
 
-        IZI_SUBTEST(EmplaceFront<T> ());
-        IZI_SUBTEST(EmplaceBack<T> ());
-        IZI_SUBTEST(Emplace<T> ());
+        for (auto itr = list.cbegin (); itr != list.cend (); ++itr)
+            if (distance (list.cbegin (), itr) % 2)
+                kept.push_back (*itr);
 
-        IZI_SUBTEST(PushFront<T> ());
-        IZI_SUBTEST(PushBack<T> ());
+        CCollection<T> erased;
+        for (auto itr = list.cbegin (); itr != list.cend (); ++itr)
+            if (!(distance (list.cbegin (), itr) % 2))
+                erased.push_back (*itr);
 
-        IZI_SUBTEST(PopFront<T> ());
-        IZI_SUBTEST(PopBack<T> ());
+        for (T x : erased)
+            IZI_ASSERT(1 == list.erase (x));
 
-        IZI_SUBTEST(Insert<T> ());
-        IZI_SUBTEST(InsertByIterator<T> ());
+        IZI_ASSERT(0 == list.erase (erased[0]));
+        IZI_ASSERT(list.size () == kept.size ());
+        for (T x : erased)
+            IZI_ASSERT(!list.contains (x));
 
-        for (T x : CValueProvider<T> () (5))
-        IZI_SUBTEST(InsertByValue<T> (x));
+        for (auto itr = list.cbegin (); itr != list.cend (); ++itr)
+            IZI_ASSERT(*itr == kept[distance (list.cbegin (), itr)]);
+    }
 
-        IZI_SUBTEST(Erase<T> ());
+    template<typename T>
+    void IndexedListSpliceAndSort () noexcept
+    {
+        const int listSize = 20;
+        CIndexedList<T> list1, list2;
+        CCollection<T> data = CValueProvider<T> () (listSize);
 
-        IZI_SUBTEST(Swap<T> ());
+        for (int i = 0; i < listSize / 2; ++i)
+            list1.push_back (data[i]);
+        for (int i = listSize / 2; i < listSize; ++i)
+            list2.push_back (data[i]);
 
-        IZI_SUBTEST(Resize<T> ());
+        // The keys found in both lists are kept once
+        CCollection<T> keys (data);
+        sort (keys.begin (), keys.end ());
+        size_t keyCount = unique (keys.begin (), keys.end ()) - keys.begin ();
 
-        IZI_SUBTEST(Clear<T> ());
+        list2.splice (list2.begin (), list2, --list2.end ());
+        list1.splice (list1.begin (), list2);
 
-        IZI_SUBTEST(SpliceList<T>());
-        IZI_SUBTEST(SpliceOne<T>());
-        IZI_SUBTEST(SpliceRange<T>());
+        IZI_ASSERT(list2.empty ());
+        IZI_ASSERT(list1.size () == keyCount);
+        for (T x : data)
+            IZI_ASSERT(list1.find (x) != list1.end () && *list1.find (x) == x);
+        for (auto itr = list1.begin (); itr != list1.end (); ++itr)
+            IZI_ASSERT(list1.find (*itr) == itr);
 
-        IZI_SUBTEST(Remove<T> ());
-        IZI_SUBTEST(RemoveIf<T> ());
+        list1.sort ();
 
-        IZI_SUBTEST(Unique<T> ());
-        IZI_SUBTEST(UniqueWithPredicate<T> ());
+        IZI_ASSERT(list1.size () == keyCount);
+        for (auto itr = list1.cbegin (); itr != --list1.cend ();)
+            IZI_ASSERT(*itr <= *++itr)
+        for (T x : data)
+            IZI_ASSERT(list1.find (x) != list1.end () && *list1.find (x) == x);
+    }
 
-        IZI_SUBTEST(Merge<T> ());
+    template<typename T>
+    void SpliceRelinks () noexcept
+    {
+        const int listSize = 20;
+        CTestedList<T> list;
+        CCollection<T> data = CValueProvider<T> () (listSize);
 
-        IZI_SUBTEST(Sort<T> ());
-        IZI_SUBTEST(SortWithPredicate<T> ());
+        list.insert (list.begin (), data.cbegin (), data.cend ());
 
-        IZI_SUBTEST(Reverse<T> ());
+        auto moved = --list.end ();
+        list.splice (list.begin (), list, moved);
 
-        IZI_SUBTEST(TestCNode<T> ());
+        IZI_ASSERT(moved == list.begin ());
+        IZI_ASSERT(*moved == data[listSize - 1]);
+        IZI_ASSERT(list.size () == data.size ());
 
-        cout << endl;
+        auto itr = list.begin ();
+        for (int i = 0; i < listSize - 1; ++i)
+            IZI_ASSERT(*++itr == data[i]);
     }
-}
 
-void CTests::RunTests () noexcept
-{
-    cout << "Starting tests..." << endl << endl;
+    template<typename T>
+    void NodeHandle () noexcept
+    {
+        const int listSize = 10;
+        CCollection<T> data = CValueProvider<T> () (listSize + 1);
+        CTestedList<T> list1 (data.cbegin (), data.cbegin () + listSize), list2;
+        const T *address = &*++list1.begin ();
+
+        size_t allocations = g_allocations.load ();
+        typename CTestedList<T>::node_type node = list1.extract (++list1.begin ());
+        IZI_ASSERT(g_allocations.load () == allocations);
+        IZI_ASSERT(node && !node.empty ());
+        IZI_ASSERT(list1.size () == size_t (listSize - 1));
+        IZI_ASSERT(*++list1.begin () == data[2]);
+
+        // The value can be changed while detached
+        node.value () = data[listSize];
+        allocations = g_allocations.load ();
+        auto inserted = list2.insert (list2.end (), std::move (node));
+        IZI_ASSERT(g_allocations.load () == allocations);
+        IZI_ASSERT(node.empty ());
+        IZI_ASSERT(&*inserted == address && *inserted == data[listSize]);
+        IZI_ASSERT(list2.size () == 1);
+
+        // Into a reversed list, before its first element
+        list1.reverse ();
+        allocations = g_allocations.load ();
+        typename CTestedList<T>::node_type moved (list2.extract (list2.begin ()));
+        inserted = list1.insert (list1.begin (), std::move (moved));
+        IZI_ASSERT(g_allocations.load () == allocations);
+        IZI_ASSERT(list2.empty () && list1.size () == size_t (listSize));
+        IZI_ASSERT(inserted == list1.begin () && *inserted == data[listSize]);
+        IZI_ASSERT(*++list1.begin () == data[listSize - 1]);
+        IZI_ASSERT(list1.back () == data[0]);
+
+        typename CTestedList<T>::node_type empty;
+        IZI_ASSERT(!empty && list1.insert (list1.begin (), std::move (empty)) == list1.end ());
+        IZI_ASSERT(list1.size () == size_t (listSize));
+
+        // A handle destroyed while owning its node frees it
+        list1.extract (list1.begin ());
+        IZI_ASSERT(list1.size () == size_t (listSize - 1));
+    }
 
-    srand (time (NULL));
+    template<typename T>
+    void StaticList () noexcept
+    {
+        const size_t capacity = 8;
+        typedef CStaticList<T, capacity> CTestedStaticList;
+
+        // Constant-initialized for a literal type
+        static constexpr CStaticList<int, capacity> constant {};
+        static_assert (constant.empty () && !constant.full () && constant.capacity () == capacity, "constexpr CStaticList");
+
+        CCollection<T> data = CValueProvider<T> () (2 * capacity);
+        CTestedStaticList list (data.cbegin (), data.cend ());
+        IZI_ASSERT(list.full () && list.size () == capacity);
+        IZI_ASSERT(equal (list.cbegin (), list.cend (), data.cbegin ()));
+        IZI_ASSERT(*list.crbegin () == data[capacity - 1] && *--list.cend () == data[capacity - 1]);
+
+        // The overflows insert nothing
+        IZI_ASSERT(!list.push_back (data[capacity]) && !list.push_front (data[capacity]));
+        IZI_ASSERT(list.insert (list.cbegin (), data[capacity]) == list.end ());
+        IZI_ASSERT(list.emplace_back (data[capacity]) == list.end ());
+        IZI_ASSERT(!list.resize (capacity + 1) && list.size () == capacity);
+
+        // An erased node is taken again, without allocating
+        const T *address = &*++list.begin ();
+        size_t allocations = g_allocations.load ();
+        list.erase (++list.cbegin ());
+        auto inserted = list.insert (list.cend (), data[capacity]);
+        if (is_trivially_copyable<T>::value)
+            IZI_ASSERT(g_allocations.load () == allocations);
+        IZI_ASSERT(&*inserted == address && list.back () == data[capacity]);
 
-    IZI_CALLTEST(RunTemplatedTests<int> ());
-    IZI_CALLTEST(RunTemplatedTests<int *> ());
-    IZI_CALLTEST(RunTemplatedTests<shared_ptr<int>> ());
+        list.pop_front ();
+        list.pop_back ();
+        IZI_ASSERT(list.size () == capacity - 2 && list.front () == data[2]);
+        IZI_ASSERT(list.insert (list.cbegin (), 3, data[0]) == list.end () && list.size () == capacity - 2);
+        IZI_ASSERT(list.insert (list.cbegin (), data.cbegin (), data.cbegin () + 3) == list.end ());
+        IZI_ASSERT(list.size () == capacity - 2 && list.front () == data[2]);
+
+        // Within the list, relinked
+        list.splice (list.cbegin (), list, --list.cend ());
+        IZI_ASSERT(list.front () == data[capacity - 1] && list.back () == data[capacity - 2]);
+        list.splice (list.cend (), list, list.cbegin ());
+        IZI_ASSERT(list.front () == data[2] && list.back () == data[capacity - 1]);
+
+        // Between lists, the values are moved only if they fit
+        CTestedStaticList other (3, data[1]);
+        IZI_ASSERT(!list.splice (list.cbegin (), other) && other.size () == 3);
+        IZI_ASSERT(list.splice (list.cbegin (), other, other.cbegin (), ++++other.cbegin ()));
+        IZI_ASSERT(list.full () && other.size () == 1 && list.front () == data[1]);
+        IZI_ASSERT(other.splice (other.cend (), list, list.cbegin ()) && other.size () == 2);
+
+        list.remove (data[2]);
+        IZI_ASSERT(find (list.cbegin (), list.cend (), data[2]) == list.cend ());
+        list.unique ();
+        IZI_ASSERT(adjacent_find (list.cbegin (), list.cend ()) == list.cend ());
 
-    IZI_CALLTEST(RunTemplatedTests<TestClass> ());
-    IZI_CALLTEST(RunTemplatedTests<TestClass *> ());
-    IZI_CALLTEST(RunTemplatedTests<shared_ptr<TestClass>> ());
+        // Sorted and merged by relinking
+        list.assign (data.cbegin (), data.cbegin () + capacity / 2);
+        other.assign (data.cbegin () + capacity / 2, data.cbegin () + capacity);
+        list.sort ();
+        other.sort ();
+        IZI_ASSERT(is_sorted (list.cbegin (), list.cend ()) && is_sorted (other.cbegin (), other.cend ()));
+        IZI_ASSERT(list.merge (other) && other.empty () && list.full ());
+        IZI_ASSERT(is_sorted (list.cbegin (), list.cend ()));
+        IZI_ASSERT(is_permutation (list.cbegin (), list.cend (), data.cbegin ()));
 
-    cout << "Tests done..." << endl;
+        CCollection<T> sorted (list.cbegin (), list.cend ());
+        list.reverse ();
+        IZI_ASSERT(equal (list.crbegin (), list.crend (), sorted.cbegin ()));
+        IZI_ASSERT(!list.assign (data.cbegin (), data.cend ()) && list.empty ());
+
+        list.clear ();
+        IZI_ASSERT(list.empty () && list.cbegin () == list.cend ());
+    }
+
+    template<typename T>
+    void LruCacheEviction () noexcept
+    {
+        const int cacheSize = 5;
+        CCollection<T> data = CValueProvider<T> () (2 * cacheSize);
+        CLruCache<int, T> cache (cacheSize);
+        CCollection<int> evicted;
+
+        cache.setEvictionCallback ([&evicted] (const int &key, T &)
+        {
+            evicted.push_back (key);
+        });
+
+        for (int i = 0; i < 2 * cacheSize; ++i)
+            cache.put (i, data[i]);
+
+        IZI_ASSERT(cache.size () == cacheSize);
+        IZI_ASSERT(cache.evictions () == cacheSize);
+        for (int i = 0; i < cacheSize; ++i)
+        {
+            IZI_ASSERT(evicted[i] == i);
+            IZI_ASSERT(!cache.contains (i));
+        }
+
+        IZI_ASSERT(*cache.find (cacheSize) == data[cacheSize]);
+        IZI_ASSERT(cache.find (0) == nullptr);
+        IZI_ASSERT(cache.cbegin ()->key == cacheSize);
+
+        cache.put (2 * cacheSize, data[0]);
+        IZI_ASSERT(cache.contains (cacheSize));
+        IZI_ASSERT(!cache.contains (cacheSize + 1));
+
+        IZI_ASSERT(1 == cache.hits ());
+        IZI_ASSERT(1 == cache.misses ());
+        IZI_ASSERT(cacheSize + 1 == cache.evictions ());
+    }
+
+    template<typename T>
+    void LruCacheWeight () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (10);
+        CLruCache<int, T> cache (10, [] (const int &key, const T &)
+        {
+            return static_cast<size_t> (key);
+        });
+
+        for (int i = 1; i <= 4; ++i)
+            cache.put (i, data[i]);
+
+        IZI_ASSERT(cache.weight () == 10);
+        IZI_ASSERT(cache.evictions () == 0);
+
+        cache.find (1);
+        cache.put (5, data[5]);
+
+        IZI_ASSERT(cache.weight () <= 10);
+        IZI_ASSERT(cache.contains (1) && cache.contains (5));
+        IZI_ASSERT(!cache.contains (2) && !cache.contains (3));
+
+        cache.setCapacity (5);
+        IZI_ASSERT(cache.size () == 1);
+        IZI_ASSERT(*cache.peek (5) == data[5]);
+    }
+
+    template<typename T>
+    void LruCacheCopy () noexcept
+    {
+        const int cacheSize = 5;
+        CCollection<T> data = CValueProvider<T> () (cacheSize + 1);
+        CLruCache<int, T> cache (cacheSize);
+
+        for (int i = 0; i < cacheSize; ++i)
+            cache.put (i, data[i]);
+
+        {
+            // The copy must index its own entries: touching or erasing them leaves the source intact
+            CLruCache<int, T> copy (cache);
+            IZI_ASSERT(copy.size () == cacheSize);
+            IZI_ASSERT(*copy.find (0) == data[0]);
+            IZI_ASSERT(copy.cbegin ()->key == 0);
+            IZI_ASSERT(copy.erase (1));
+            copy.put (cacheSize, data[cacheSize]);
+            IZI_ASSERT(copy.contains (cacheSize) && !copy.contains (1));
+        }
+
+        IZI_ASSERT(cache.size () == cacheSize);
+        IZI_ASSERT(cache.cbegin ()->key == cacheSize - 1);
+        for (int i = 0; i < cacheSize; ++i)
+            IZI_ASSERT(*cache.peek (i) == data[i]);
+        IZI_ASSERT(!cache.contains (cacheSize));
+    }
+
+    /*!
+        @brief Element of the tested CIntrusiveList, threaded by its base hook or by its member hook.
+     */
+    template<typename T>
+    struct CIntrusiveTestNode : public CIntrusiveListHook
+    {
+        T value;
+        CIntrusiveListHook memberHook;
+
+        explicit CIntrusiveTestNode (const T &v = T ()) noexcept : value (v)
+        {
+        }
+
+        bool operator== (const CIntrusiveTestNode &other) const noexcept
+        {
+            return value == other.value;
+        }
+
+        bool operator< (const CIntrusiveTestNode &other) const noexcept
+        {
+            return value < other.value;
+        }
+    };
+
+    template<typename T> using CIntrusiveTestList = CIntrusiveList<CIntrusiveTestNode<T>>;
+    template<typename T> using CIntrusiveTestMemberList = CIntrusiveList<CIntrusiveTestNode<T>,
+            CMemberHook<CIntrusiveTestNode<T>, &CIntrusiveTestNode<T>::memberHook>>;
+
+    template<typename T>
+    void IntrusivePushAndUnlink () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (20);
+        CCollection<CIntrusiveTestNode<T>> nodes (data.cbegin (), data.cend ());
+        CIntrusiveTestList<T> list;
+
+        for (auto &node : nodes)
+            list.push_back (node);
+
+        IZI_ASSERT(list.size () == data.size ());
+        for (auto itr = list.cbegin (); itr != list.cend (); ++itr)
+            IZI_ASSERT(itr->value == data[distance (list.cbegin (), itr)]);
+
+        nodes[0].unlink ();
+        nodes[5].unlink ();
+        list.erase (CIntrusiveTestList<T>::iterator_to (nodes[19]));
+
+        IZI_ASSERT(!nodes[5].isLinked ());
+        IZI_ASSERT(nodes[6].isLinked ());
+        IZI_ASSERT(list.size () == data.size () - 3);
+        IZI_ASSERT(list.front ().value == data[1]);
+        IZI_ASSERT(list.back ().value == data[18]);
+
+        list.reverse ();
+        IZI_ASSERT(list.front ().value == data[18]);
+        IZI_ASSERT(list.crbegin ()->value == data[1]);
+
+        list.clear ();
+        IZI_ASSERT(list.empty ());
+        IZI_ASSERT(!nodes[1].isLinked ());
+    }
+
+    template<typename T>
+    void IntrusiveSpliceAndRemoveIf () noexcept
+    {
+        const int listSize = 20;
+        CCollection<T> data = CValueProvider<T> () (listSize);
+        CCollection<CIntrusiveTestNode<T>> nodes (data.cbegin (), data.cend ());
+        CIntrusiveTestList<T> list1, list2;
+
+        for (int i = 0; i < listSize / 2; ++i)
+            list1.push_back (nodes[i]);
+        for (int i = listSize / 2; i < listSize; ++i)
+            list2.push_back (nodes[i]);
+
+        list1.splice (list1.end (), list2);
+        IZI_ASSERT(list2.empty ());
+
+        list2.splice (list2.end (), list1, list1.begin ());
+        IZI_ASSERT(&list2.front () == &nodes[0]);
+
+        static int i = 0;
+        list1.remove_if ([] (const CIntrusiveTestNode<T> &)
+        {
+            return i++ % 2;
+        });
+
+        IZI_ASSERT(list1.size () == (listSize - 1) / 2 + 1);
+        for (auto itr = list1.cbegin (); itr != list1.cend (); ++itr)
+            IZI_ASSERT(itr->value == data[1 + 2 * distance (list1.cbegin (), itr)]);
+    }
+
+    template<typename T>
+    void IntrusiveSortAndMerge () noexcept
+    {
+        const int listSize = 40;
+        CCollection<T> data = CValueProvider<T> () (listSize);
+        CCollection<CIntrusiveTestNode<T>> nodes (data.cbegin (), data.cend ());
+        CIntrusiveTestMemberList<T> list1, list2;
+
+        for (int i = 0; i < listSize / 2; ++i)
+            list1.push_back (nodes[i]);
+        for (int i = listSize / 2; i < listSize; ++i)
+            list2.push_back (nodes[i]);
+
+        list1.sort ();
+        list2.sort ();
+        list1.merge (list2);
+
+        sort (data.begin (), data.end ());
+
+        IZI_ASSERT(list2.empty ());
+        IZI_ASSERT(list1.size () == data.size ());
+        for (auto itr = list1.cbegin (); itr != list1.cend (); ++itr)
+            IZI_ASSERT(itr->value == data[distance (list1.cbegin (), itr)]);
+
+        // The base hooks are left untouched by a list threading the member hooks.
+        for (auto &node : nodes)
+            IZI_ASSERT(!node.isLinked ());
+    }
+
+    template<typename T>
+    void IntrusiveMove () noexcept
+    {
+        const int listSize = 20;
+        CCollection<T> data = CValueProvider<T> () (listSize);
+        CCollection<CIntrusiveTestNode<T>> nodes (data.cbegin (), data.cend ());
+        CIntrusiveTestMemberList<T> list1, list2;
+
+        for (int i = 0; i < listSize / 2; ++i)
+            list1.push_back (nodes[i]);
+        for (int i = listSize / 2; i < listSize; ++i)
+            list2.push_back (nodes[i]);
+
+        // The elements are found back from their member hooks
+        CIntrusiveTestMemberList<T> moved (std::move (list1));
+        IZI_ASSERT(list1.empty ());
+        IZI_ASSERT(&moved.front () == &nodes[0] && &moved.back () == &nodes[listSize / 2 - 1]);
+
+        // The elements of the assigned list are unlinked, those of the moved one relinked
+        moved = std::move (list2);
+        IZI_ASSERT(list2.empty ());
+        IZI_ASSERT(!nodes[0].memberHook.isLinked ());
+        IZI_ASSERT(moved.size () == size_t (listSize / 2));
+        for (auto itr = moved.cbegin (); itr != moved.cend (); ++itr)
+            IZI_ASSERT(&*itr == &nodes[listSize / 2 + distance (moved.cbegin (), itr)]);
+
+        moved = std::move (moved);
+        IZI_ASSERT(moved.size () == size_t (listSize / 2));
+    }
+
+    template<typename T>
+    void MappedList (false_type /*isTriviallyCopyable*/) noexcept
+    {
+    }
+
+    template<typename T>
+    void MappedList (true_type /*isTriviallyCopyable*/) noexcept
+    {
+        const string path = "CMappedListTest.bin";
+        const string savedPath = "CMappedListTest.saved.bin";
+        CCollection<T> data = CValueProvider<T> () (1000);
+        CTestedList<T> list (data.cbegin (), data.cend ());
+
+        IZI_ASSERT(CMappedList<T>::write (list, path, 1));
+
+        {
+            CMappedList<T> mapped;
+            IZI_ASSERT(mapped.open (path));
+            IZI_ASSERT(mapped.size () == data.size ());
+            IZI_ASSERT(mapped.front () == data.front () && mapped.back () == data.back ());
+
+            for (auto itr = mapped.cbegin (); itr != mapped.cend (); ++itr)
+                IZI_ASSERT(*itr == data[distance (mapped.cbegin (), itr)]);
+
+            IZI_ASSERT(*--mapped.cend () == data.back ());
+            IZI_ASSERT(!mapped.push_back (data[0]));
+
+            // The pages are read-only: no mutable iterator is given, the const overloads still iterate.
+            IZI_ASSERT(mapped.begin () == mapped.end ());
+            const CMappedList<T> &constMapped = mapped;
+            IZI_ASSERT(static_cast<size_t> (distance (constMapped.begin (), constMapped.end ())) == data.size ());
+        }
+
+        {
+            CMappedList<T> mapped;
+            IZI_ASSERT(mapped.open (path, CMappedList<T>::CopyOnWrite));
+
+            mapped.pop_front ();
+            IZI_ASSERT(mapped.push_back (data[0]));
+            IZI_ASSERT(mapped.push_front (data[1]));
+            IZI_ASSERT(!mapped.push_front (data[2]));
+
+            list.pop_front ();
+            list.push_back (data[0]);
+            list.push_front (data[1]);
+
+            IZI_ASSERT(mapped.save (savedPath));
+        }
+
+        {
+            CMappedList<T> original, saved;
+            IZI_ASSERT(original.open (path));
+            IZI_ASSERT(saved.open (savedPath));
+
+            IZI_ASSERT(original.size () == data.size ());
+            IZI_ASSERT(*original.cbegin () == data[0]);
+
+            CTestedList<T> savedList = saved.toList ();
+            IZI_ASSERT(savedList.size () == list.size ());
+            for (auto itr1 = savedList.cbegin (), itr2 = list.cbegin (); itr1 != savedList.cend (); ++itr1, ++itr2)
+                IZI_ASSERT(*itr1 == *itr2);
+        }
+
+        {
+            // Flipping a single bit of a value must be caught by the checksum.
+            fstream file (path, ios::in | ios::out | ios::binary);
+            file.seekg (-1, ios::end);
+            char last = file.get () ^ 1;
+            file.seekp (-1, ios::end);
+            file.put (last);
+        }
+
+        CMappedList<T> corrupted;
+        IZI_ASSERT(!corrupted.open (path, CMappedList<T>::ReadOnly, true));
+        IZI_ASSERT(corrupted.open (path));
+        corrupted.close ();
+
+        {
+            // A link pointing outside of the mapping ends the traversal. The nodes follow a 64 bytes header.
+            const size_t headerSize = 64;
+            ifstream in (path, ios::binary | ios::ate);
+            const size_t nodeSize = (static_cast<size_t> (in.tellg ()) - headerSize) / (data.size () + 1);
+            in.close ();
+
+            fstream file (path, ios::in | ios::out | ios::binary);
+            const uint64_t outside = numeric_limits<uint32_t>::max ();
+            file.seekp (headerSize + nodeSize);
+            file.write (reinterpret_cast<const char *> (&outside), sizeof (outside));
+        }
+
+        IZI_ASSERT(corrupted.open (path));
+        IZI_ASSERT(distance (corrupted.cbegin (), corrupted.cend ()) == 2);
+
+        remove (path.c_str ());
+        remove (savedPath.c_str ());
+    }
+
+    template<typename T>
+    void ForwardListQueue () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (20);
+        CForwardList<T> list;
+
+        for (const T &x : data)
+            list.push_back (x);
+
+        IZI_ASSERT(list.size () == data.size ());
+        IZI_ASSERT(list.back () == data.back ());
+        IZI_ASSERT(equal (list.cbegin (), list.cend (), data.cbegin ()));
+
+        for (size_t i = 0; i < 5; ++i)
+        {
+            IZI_ASSERT(list.front () == data[i]);
+            list.pop_front ();
+        }
+        IZI_ASSERT(list.size () == data.size () - 5);
+
+        list.erase_after (list.cbegin (), list.cend ());
+        IZI_ASSERT(list.size () == 1);
+        IZI_ASSERT(list.back () == data[5]);
+
+        list.push_back (data[0]);
+        list.insert_after (list.cbefore_begin (), data[1]);
+        list.insert_after (list.cbegin (), 2, data[2]);
+        IZI_ASSERT(list.size () == 5);
+        IZI_ASSERT(list.front () == data[1]);
+        IZI_ASSERT(list.back () == data[0]);
+
+        CForwardList<T> copy (list), moved (std::move (list));
+        IZI_ASSERT(list.empty ());
+        IZI_ASSERT(moved.size () == 5);
+        IZI_ASSERT(equal (copy.cbegin (), copy.cend (), moved.cbegin ()));
+
+        // The moved-from list keeps working.
+        list.push_back (data[3]);
+        IZI_ASSERT(list.front () == data[3]);
+        IZI_ASSERT(list.back () == data[3]);
+
+        moved = std::move (list);
+        IZI_ASSERT(moved.size () == 1);
+        IZI_ASSERT(moved.back () == data[3]);
+        moved.push_back (data[4]);
+        IZI_ASSERT(moved.back () == data[4]);
+    }
+
+    template<typename T>
+    void ForwardListSplice () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (20);
+        CForwardList<T> list1 (data.cbegin (), data.cbegin () + 10), list2 (data.cbegin () + 10, data.cend ());
+
+        list1.splice_after (list1.before_end (), list2);
+        IZI_ASSERT(list2.empty ());
+        IZI_ASSERT(list1.size () == data.size ());
+        IZI_ASSERT(list1.back () == data.back ());
+        IZI_ASSERT(equal (list1.cbegin (), list1.cend (), data.cbegin ()));
+
+        // Moves the last element in front of the other list: both tails must follow.
+        list2.push_back (data[0]);
+        auto beforeLast = list1.cbegin ();
+        advance (beforeLast, data.size () - 2);
+        list2.splice_after (list2.cbefore_begin (), list1, beforeLast);
+        IZI_ASSERT(list1.size () == data.size () - 1);
+        IZI_ASSERT(list1.back () == data[data.size () - 2]);
+        IZI_ASSERT(list2.size () == 2);
+        IZI_ASSERT(list2.front () == data.back ());
+        IZI_ASSERT(list2.back () == data[0]);
+
+        // Moves the first five elements at the end of the other list.
+        auto fifth = list1.cbegin ();
+        advance (fifth, 5);
+        list2.splice_after (list2.before_end (), list1, list1.cbefore_begin (), fifth);
+        IZI_ASSERT(list1.size () == data.size () - 6);
+        IZI_ASSERT(list1.front () == data[5]);
+        IZI_ASSERT(list2.size () == 7);
+        IZI_ASSERT(list2.back () == data[4]);
+
+        list2.remove_if ([&data] (const T &x)
+        {
+            return x == data[0];
+        });
+        IZI_ASSERT(list2.front () == data.back ());
+        IZI_ASSERT(list2.back () == data[4]);
+
+        // Moves a whole list in the middle of another: the tail stays, the emptied list is usable again.
+        const size_t size1 = list1.size (), size2 = list2.size ();
+        list1.splice_after (list1.cbegin (), list2);
+        IZI_ASSERT(list2.empty () && list2.cbegin () == list2.cend ());
+        IZI_ASSERT(list1.size () == size1 + size2);
+        IZI_ASSERT(*next (list1.cbegin ()) == data.back ());
+        IZI_ASSERT(list1.back () == data[data.size () - 2]);
+        IZI_ASSERT(distance (list1.cbegin (), list1.cend ()) == static_cast<ptrdiff_t> (size1 + size2));
+
+        list2.push_back (data[0]);
+        list2.splice_after (list2.cbefore_begin (), list2);
+        list2.splice_after (list2.before_end (), list1);
+        IZI_ASSERT(list1.empty ());
+        IZI_ASSERT(list2.size () == size1 + size2 + 1);
+        IZI_ASSERT(list2.front () == data[0] && list2.back () == data[data.size () - 2]);
+    }
+
+    template<typename T>
+    void ForwardListSortAndMerge () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (100);
+        CForwardList<T> list1 (data.cbegin (), data.cbegin () + 60), list2 (data.cbegin () + 60, data.cend ());
+
+        list1.sort ();
+        list2.sort ();
+        IZI_ASSERT(is_sorted (list1.cbegin (), list1.cend ()));
+
+        list1.merge (list2);
+        sort (data.begin (), data.end ());
+        IZI_ASSERT(list2.empty ());
+        IZI_ASSERT(list1.size () == data.size ());
+        IZI_ASSERT(equal (list1.cbegin (), list1.cend (), data.cbegin ()));
+        IZI_ASSERT(list1.back () == data.back ());
+
+        list1.reverse ();
+        IZI_ASSERT(equal (list1.cbegin (), list1.cend (), data.crbegin ()));
+        IZI_ASSERT(list1.back () == data.front ());
+
+        list1.push_back (data.front ());
+        list1.unique ();
+        IZI_ASSERT(list1.back () == data.front ());
+        IZI_ASSERT(adjacent_find (list1.cbegin (), list1.cend ()) == list1.cend ());
+
+        list1.resize (3);
+        IZI_ASSERT(list1.size () == 3);
+        IZI_ASSERT(list1.back () == data[data.size () - 3]);
+    }
+
+    template<typename T>
+    void PersistentListSnapshot () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (200);
+        CPersistentList<T> list (data.cbegin (), data.cbegin () + 100);
+
+        CPersistentList<T> before = list.snapshot ();
+        for (size_t i = 100; i < data.size (); ++i)
+            list.push_back (data[i]);
+        list.erase (0);
+        list.set (10, data[0]);
+        list.insert (50, data[1]);
+
+        // The snapshot still sees the version it was taken from.
+        IZI_ASSERT(before.size () == 100);
+        IZI_ASSERT(equal (before.cbegin (), before.cend (), data.cbegin ()));
+
+        CCollection<T> expected (data.cbegin () + 1, data.cend ());
+        expected[10] = data[0];
+        expected.insert (expected.begin () + 50, data[1]);
+        IZI_ASSERT(list.size () == expected.size ());
+        IZI_ASSERT(equal (list.cbegin (), list.cend (), expected.cbegin ()));
+        for (size_t i = 0; i < expected.size (); i += 17)
+            IZI_ASSERT(list.at (i) == expected[i]);
+
+        CList<T> copy = list.toList ();
+        IZI_ASSERT(copy.size () == expected.size ());
+        IZI_ASSERT(copy.back () == expected.back ());
+
+        while (!list.empty ())
+            list.pop_front ();
+
+        // Popping an empty list does nothing
+        list.pop_front ();
+        list.pop_back ();
+        IZI_ASSERT(list.empty ());
+        IZI_ASSERT(before.front () == data.front ());
+        IZI_ASSERT(before.back () == data[99]);
+    }
+
+    template<typename T>
+    void PersistentListConcurrentReaders () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (2000);
+        CPersistentList<T> list;
+        atomic<bool> done (false);
+        atomic<int> torn (0);
+
+        // Every published version must be a prefix of data.
+        auto reader = [&list, &data, &done, &torn] ()
+        {
+            while (!done)
+            {
+                CPersistentList<T> snapshot = list.snapshot ();
+                if (!equal (snapshot.cbegin (), snapshot.cend (), data.cbegin ())
+                    || size_t (distance (snapshot.cbegin (), snapshot.cend ())) != snapshot.size ())
+                    ++torn;
+            }
+        };
+
+        thread reader1 (reader), reader2 (reader);
+        for (const T &x : data)
+            list.push_back (x);
+        done = true;
+        reader1.join ();
+        reader2.join ();
+
+        IZI_ASSERT(torn == 0);
+        IZI_ASSERT(list.size () == data.size ());
+    }
+
+    template<typename T>
+    void RcuListWriter () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (20);
+        CRcuList<T> list1, list2;
+        typename CRcuList<T>::CReader reader = list1.reader ();
+
+        IZI_ASSERT(reader.isValid ());
+        for (size_t i = 0; i < 10; ++i)
+            list1.push_back (data[i]);
+        for (size_t i = 10; i < data.size (); ++i)
+            list2.push_back (data[i]);
+
+        list1.splice (list1.end (), list2);
+        IZI_ASSERT(list2.empty ());
+        IZI_ASSERT(list1.size () == data.size ());
+        {
+            typename CRcuList<T>::CReadGuard guard (reader);
+            IZI_ASSERT(equal (list1.cbegin (), list1.cend (), data.cbegin ()));
+        }
+
+        // A reader still on an erased node keeps it alive and follows it to the rest of the list.
+        reader.lock ();
+        auto itr = list1.cbegin ();
+        list1.pop_front ();
+        list1.erase (list1.begin ());
+        list1.replace (list1.begin (), data[0]);
+        list1.reclaim ();
+        IZI_ASSERT(list1.pending () == 3);
+        IZI_ASSERT(*itr == data[0]);
+        IZI_ASSERT(*++itr == data[1]);
+        IZI_ASSERT(*++itr == data[2]);
+        IZI_ASSERT(*++itr == data[3]);
+        reader.unlock ();
+
+        list1.synchronize ();
+        IZI_ASSERT(list1.pending () == 0);
+        IZI_ASSERT(list1.size () == data.size () - 2);
+
+        CRcuList<T> empty;
+        empty.pop_front ();
+        IZI_ASSERT(empty.empty () && empty.pending () == 0);
+        IZI_ASSERT(*list1.begin () == data[0]);
+
+        auto first = list1.begin (), last = list1.begin ();
+        advance (last, 3);
+        list1.splice (list1.end (), list1, first, last);
+        CCollection<T> expected (data.cbegin () + 5, data.cend ());
+        expected.push_back (data[0]);
+        expected.push_back (data[3]);
+        expected.push_back (data[4]);
+        IZI_ASSERT(equal (list1.begin (), list1.end (), expected.cbegin ()));
+        IZI_ASSERT(list1.size () == expected.size ());
+
+        list1.clear ();
+        IZI_ASSERT(list1.empty ());
+        IZI_ASSERT(list1.begin () == list1.end ());
+    }
+
+    template<typename T>
+    void RcuListConcurrentReaders () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (16);
+        CRcuList<T> list;
+        atomic<bool> done (false);
+        atomic<int> invalid (0);
+
+        // Readers must only ever see values of data, never freed nodes.
+        auto read = [&list, &data, &done, &invalid] ()
+        {
+            typename CRcuList<T>::CReader reader = list.reader ();
+            while (!done)
+            {
+                typename CRcuList<T>::CReadGuard guard (reader);
+                for (auto itr = list.cbegin (); itr != list.cend (); ++itr)
+                    if (find (data.cbegin (), data.cend (), *itr) == data.cend ())
+                        ++invalid;
+            }
+        };
+
+        thread reader1 (read), reader2 (read), reader3 (read);
+        for (size_t i = 0; i < 20000; ++i)
+        {
+            list.push_back (data[i % data.size ()]);
+            if (list.size () > data.size ())
+                list.pop_front ();
+            if (i % 100 == 0)
+                list.replace (list.begin (), data[i % 7]);
+        }
+        done = true;
+        reader1.join ();
+        reader2.join ();
+        reader3.join ();
+
+        list.synchronize ();
+        IZI_ASSERT(invalid == 0);
+        IZI_ASSERT(list.pending () == 0);
+        IZI_ASSERT(list.size () == data.size ());
+    }
+
+    template<typename T>
+    void BlockingListBatches () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (20);
+        CBlockingList<T> queue (8);
+        CTestedList<T> batch (data.cbegin (), data.cend ()), popped;
+
+        // A batch larger than the room left is only moved in part when the queue stays full
+        IZI_ASSERT(!queue.push_batch (batch, chrono::milliseconds (1)));
+        IZI_ASSERT(queue.size () == 8 && batch.size () == 12);
+        IZI_ASSERT(queue.pop_batch (popped, 5) == 5);
+        IZI_ASSERT(queue.pop_batch (popped, 100) == 3);
+        IZI_ASSERT(equal (popped.cbegin (), popped.cend (), data.cbegin ()));
+
+        // Timeouts on an empty queue
+        IZI_ASSERT(queue.pop_batch (popped, 1, chrono::milliseconds (1)) == 0);
+        IZI_ASSERT(popped.size () == 8);
+
+        T x = T ();
+        IZI_ASSERT(queue.push (data[0]));
+        IZI_ASSERT(queue.pop (x) && x == data[0]);
+
+        // Closing fails the pushes and drains the elements left
+        IZI_ASSERT(queue.push_batch (batch, chrono::milliseconds (1)) == false);
+        queue.close ();
+        IZI_ASSERT(queue.closed ());
+        IZI_ASSERT(!queue.push (data[0]));
+        IZI_ASSERT(!queue.push_batch (batch));
+        IZI_ASSERT(batch.size () == 4);
+        IZI_ASSERT(queue.pop_batch (popped, 100) == 8);
+        IZI_ASSERT(equal (popped.cbegin (), popped.cend (), data.cbegin ()));
+        IZI_ASSERT(queue.pop_batch (popped, 100) == 0);
+        IZI_ASSERT(!queue.pop (x));
+    }
+
+    template<typename T>
+    void BlockingListHandoff () noexcept
+    {
+        const size_t batchSize = 32, batches = 100;
+        CCollection<T> data = CValueProvider<T> () (batchSize);
+        CBlockingList<T> queue (4 * batchSize);
+        CTestedList<T> received;
+
+        thread consumer ([&queue, &received] ()
+        {
+            CTestedList<T> batch;
+            while (queue.pop_batch (batch, batchSize))
+                received.splice (received.end (), batch);
+        });
+
+        for (size_t i = 0; i < batches; ++i)
+        {
+            CTestedList<T> batch (data.cbegin (), data.cend ());
+            IZI_ASSERT(queue.push_batch (batch));
+        }
+        queue.close ();
+        consumer.join ();
+
+        IZI_ASSERT(received.size () == batches * batchSize);
+        typename CTestedList<T>::const_iterator itr = received.cbegin ();
+        for (size_t i = 0; i < batches; ++i)
+            for (const T &x : data)
+                IZI_ASSERT(*itr++ == x);
+
+        // A lock and a wakeup per batch on each side, not per element
+        typename CBlockingList<T>::CStats stats = queue.stats ();
+        IZI_ASSERT(stats.locks <= 6 * batches);
+        IZI_ASSERT(stats.wakeups <= 3 * batches);
+    }
+
+    template<typename T>
+    void TimerWheelSchedule () noexcept
+    {
+        typedef CTimerWheel<T> CWheel;
+        CCollection<T> data = CValueProvider<T> () (10);
+
+        // Delays on each side of the spans of the levels and of the wheel, from a tick close to a turn of all of them
+        const typename CWheel::tick_type delays[] = { 0, 1, 255, 256, 257, 65535, 65536, 300000, 1 << 24, (1 << 24) + 70 };
+        const typename CWheel::tick_type start = (1 << 24) - 3;
+        CWheel wheel (start);
+        vector<typename CWheel::iterator> timers;
+        for (size_t i = 0; i < data.size (); ++i)
+            timers.push_back (wheel.schedule (delays[i], data[i]));
+        IZI_ASSERT(wheel.size () == data.size ());
+
+        IZI_ASSERT(wheel.cancel (timers[4]));
+        IZI_ASSERT(!wheel.cancel (timers[4]));
+        IZI_ASSERT(wheel.size () == data.size () - 1);
+
+        // Each timer expires at its deadline, once, and in order
+        typename CWheel::tick_type last = start;
+        size_t expired = 0;
+        IZI_ASSERT(wheel.advance (1 << 25, [&] (const typename CWheel::CTimer &timer)
+        {
+            IZI_ASSERT(timer.deadline >= last);
+            last = timer.deadline;
+            size_t i = find_if (timers.cbegin (), timers.cend (), [&timer] (const typename CWheel::iterator &itr)
+            {
+                return &*itr == &timer;
+            }) - timers.cbegin ();
+            IZI_ASSERT(i < data.size () && i != 4);
+            IZI_ASSERT(timer.value == data[i]);
+            IZI_ASSERT(timer.deadline == start + max<typename CWheel::tick_type> (delays[i], 1));
+            ++expired;
+        }) == data.size () - 1);
+        IZI_ASSERT(expired == data.size () - 1);
+        IZI_ASSERT(wheel.empty ());
+        IZI_ASSERT(wheel.now () == start + (1 << 25));
+
+        // An expired timer can't be cancelled anymore
+        IZI_ASSERT(!wheel.cancel (timers[0]));
+    }
+
+    template<typename T>
+    void TimerWheelBatches () noexcept
+    {
+        typedef CTimerWheel<T> CWheel;
+        CCollection<T> data = CValueProvider<T> () (1000);
+        CWheel wheel;
+
+        for (size_t i = 0; i < data.size (); ++i)
+            wheel.schedule (100 + i % 10, data[i]);
+
+        // All the timers of a tick are given at once
+        typename CWheel::timer_list expired;
+        IZI_ASSERT(wheel.advance (100, expired) == 100);
+        IZI_ASSERT(expired.size () == 100);
+        for (const typename CWheel::CTimer &timer : expired)
+            IZI_ASSERT(timer.deadline == 100 && timer.bucket == CWheel::noBucket);
+
+        IZI_ASSERT(wheel.advance (9, expired) == 900);
+        IZI_ASSERT(wheel.empty ());
+        auto itr = expired.cbegin ();
+        for (size_t tick = 0; tick < 10; ++tick)
+            for (size_t i = tick; i < data.size (); i += 10, ++itr)
+                IZI_ASSERT(itr->value == data[i] && itr->deadline == 100 + tick);
+
+        // The timers due on a turn of a level expire at their tick, from the level being cascaded
+        CWheel turns;
+        const typename CWheel::tick_type deadlines[] = { CWheel::slotCount, CWheel::slotCount * CWheel::slotCount,
+                                                         typename CWheel::tick_type (1) << 24 };
+        vector<typename CWheel::iterator> timers;
+        for (size_t i = 0; i < 3; ++i)
+            timers.push_back (turns.schedule (deadlines[i], data[i]));
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            expired.clear ();
+            IZI_ASSERT(turns.advance (deadlines[i] - 1 - turns.now (), expired) == 0);
+            IZI_ASSERT(turns.advance (1, expired) == 1);
+            IZI_ASSERT(expired.front ().value == data[i] && expired.front ().deadline == deadlines[i]);
+            IZI_ASSERT(!turns.cancel (timers[i]));
+        }
+        IZI_ASSERT(turns.empty ());
+    }
+
+    template<typename T>
+    void ViewPipeline () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (50);
+        CTestedList<T> list (data.cbegin (), data.cend ());
+        auto isKept = [&data] (const T &x)
+        {
+            return !(x == data[3]);
+        };
+        auto isFirst = [&data] (const T &x)
+        {
+            return x == data[0];
+        };
+
+        CCollection<T> kept;
+        copy_if (data.cbegin (), data.cend (), back_inserter (kept), isKept);
+
+        CTestedList<T> filtered = list | filter (isKept) | to ();
+        IZI_ASSERT(filtered.size () == kept.size ());
+        IZI_ASSERT(equal (filtered.cbegin (), filtered.cend (), kept.cbegin ()));
+
+        auto flags = list | drop (5) | filter (isKept) | transform (isFirst) | take (10);
+        IZI_ASSERT(distance (flags.begin (), flags.end ()) == 10);
+        CCollection<T> keptAfterFive;
+        copy_if (data.cbegin () + 5, data.cend (), back_inserter (keptAfterFive), isKept);
+        auto keptItr = keptAfterFive.cbegin ();
+        for (auto itr = flags.begin (); itr != flags.end (); ++itr, ++keptItr)
+            IZI_ASSERT(*itr == isFirst (*keptItr));
+
+        size_t chunks = 0, elements = 0;
+        for (auto group : list | take (45) | chunk (10))
+        {
+            IZI_ASSERT(distance (group.begin (), group.end ()) == (chunks < 4 ? 10 : 5));
+            IZI_ASSERT(*group.begin () == data[chunks * 10]);
+            elements += distance (group.begin (), group.end ());
+            ++chunks;
+        }
+        IZI_ASSERT(chunks == 5);
+        IZI_ASSERT(elements == 45);
+
+        CTestedList<T> shorter (data.cbegin (), data.cbegin () + 20);
+        size_t pairs = 0;
+        for (auto pair : list | drop (1) | zip (shorter))
+        {
+            IZI_ASSERT(pair.first == data[pairs + 1]);
+            IZI_ASSERT(pair.second == data[pairs]);
+            ++pairs;
+        }
+        IZI_ASSERT(pairs == shorter.size ());
+
+        IZI_ASSERT((list | drop (100) | to ()).empty ());
+        IZI_ASSERT((list | take (0) | to ()).empty ());
+    }
+
+    template<typename T>
+    void GeneratorPipeline () noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (30);
+        size_t produced = 0;
+
+        // An endless generator cycling through data, ended by take.
+        auto cycle = generate<T> ([&data, &produced] (T &x)
+        {
+            x = data[produced++ % data.size ()];
+            return true;
+        });
+
+        CTestedList<T> list = cycle | take (45) | to ();
+        IZI_ASSERT(list.size () == 45);
+        IZI_ASSERT(list.back () == data[14]);
+        IZI_ASSERT(produced == 45);
+
+        // The generator resumes where it stopped.
+        CTestedList<T> next = cycle | take (5) | to ();
+        IZI_ASSERT(next.front () == data[14]);
+        IZI_ASSERT(next.back () == data[18]);
+
+        size_t remaining = 3;
+        auto finite = generate<T> ([&data, &remaining] (T &x)
+        {
+            if (!remaining)
+                return false;
+            x = data[--remaining];
+            return true;
+        });
+        CTestedList<T> all = finite | to ();
+        IZI_ASSERT(all.size () == 3);
+        IZI_ASSERT(all.front () == data[2]);
+        IZI_ASSERT(all.back () == data[0]);
+    }
+
+    template<typename T>
+    void StreamRoundTrip (false_type /*isSerializable*/) noexcept
+    {
+    }
+
+    template<typename T>
+    void StreamRoundTrip (true_type /*isSerializable*/) noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (1000);
+        CTestedList<T> list (data.cbegin (), data.cend ()), readList, emptyList;
+        stringstream stream;
+
+        IZI_ASSERT(list.write_to (stream));
+        IZI_ASSERT(emptyList.write_to (stream));
+
+        IZI_ASSERT(readList.read_from (stream));
+        IZI_ASSERT(readList.size () == data.size ());
+        for (auto itr = readList.cbegin (); itr != readList.cend (); ++itr)
+            IZI_ASSERT(*itr == data[distance (readList.cbegin (), itr)]);
+
+        IZI_ASSERT(emptyList.read_from (stream));
+        IZI_ASSERT(emptyList.empty ());
+
+        // A truncated stream is reported, the elements of the complete chunks are kept.
+        stringstream truncated;
+        list.write_to (truncated);
+        string bytes = truncated.str ();
+        truncated.str (bytes.substr (0, bytes.size () - 1));
+
+        CTestedList<T> truncatedList;
+        IZI_ASSERT(!truncatedList.read_from (truncated));
+        IZI_ASSERT(truncatedList.size () == data.size ());
+
+        // A chunk claiming gigabytes is rejected before anything is allocated for it
+        const size_t streamHeaderSize = 16;
+        const uint32_t hugeChunk[2] = { 1, 0xFFFFFFFF };
+        stringstream huge (bytes.substr (0, streamHeaderSize)
+                           + string (reinterpret_cast<const char *> (hugeChunk), sizeof (hugeChunk)));
+
+        CTestedList<T> hugeList;
+        IZI_ASSERT(!hugeList.read_from (huge));
+        IZI_ASSERT(hugeList.empty ());
+    }
+
+    template<typename T>
+    void StreamThroughPipe (false_type /*isSerializable*/) noexcept
+    {
+    }
+
+    template<typename T>
+    void StreamThroughPipe (true_type /*isSerializable*/) noexcept
+    {
+        CCollection<T> data = CValueProvider<T> () (50000);
+        CTestedList<T> list (data.cbegin (), data.cend ()), readList;
+        int fds[2];
+
+        IZI_ASSERT(0 == pipe (fds));
+
+        bool written = false;
+        thread writer ([&list, &written, &fds] ()
+        {
+            written = list.write_to (fds[1]);
+            close (fds[1]);
+        });
+
+        IZI_ASSERT(readList.read_from (fds[0]));
+        writer.join ();
+        close (fds[0]);
+
+        IZI_ASSERT(written);
+        IZI_ASSERT(readList.size () == data.size ());
+        for (auto itr1 = readList.cbegin (), itr2 = list.cbegin (); itr1 != readList.cend (); ++itr1, ++itr2)
+            IZI_ASSERT(*itr1 == *itr2);
+
+        // A malformed chunk is reported at once, while the background thread waits for input that never comes:
+        // the writer sends a valid chunk then a malformed copy of it, and keeps the pipe open.
+        stringstream stream;
+        CTestedList<T> (data.cbegin (), data.cbegin () + 100).write_to (stream);
+        const size_t streamHeaderSize = 16, endOfListSize = 8;
+        string bytes = stream.str ();
+        string chunk = bytes.substr (streamHeaderSize, bytes.size () - streamHeaderSize - endOfListSize);
+        bytes.resize (bytes.size () - endOfListSize);
+        bytes += chunk;
+        ++bytes[streamHeaderSize + chunk.size ()];
+
+        IZI_ASSERT(0 == pipe (fds));
+        IZI_ASSERT(write (fds[1], bytes.data (), bytes.size ()) == static_cast<ssize_t> (bytes.size ()));
+
+        CTestedList<T> malformedList;
+        IZI_ASSERT(!malformedList.read_from (fds[0]));
+        close (fds[1]);
+        close (fds[0]);
+    }
+
+    template<typename T> using CIsSerializable = integral_constant<bool, CIsRawSerializable<T>::value || is_same<T, TestClass>::value>;
+
+    template<typename T>
+    void TraceRecorder () noexcept
+    {
+#ifndef CLIST_TRACE
+        // A traced build records the calls of the tests in its trace file, which is not replaced
+        const string path = "CListTraceTest.trace";
+        CListTrace::setPath (path);
+
+        const uint32_t list = CListTrace::open (sizeof (T)), other = CListTrace::open (sizeof (T));
+        IZI_ASSERT(other == list + 1);
+        {
+            CListTrace::CScope splice (list, CListTrace::EOperation::Splice, sizeof (T), CListTrace::EPosition::Middle,
+                                       3, other);
+
+            // Made by the splice, not recorded
+            CListTrace::CScope clear (other, CListTrace::EOperation::Clear, sizeof (T));
+        }
+        {
+            CListTrace::CScope removal (list, CListTrace::EOperation::Remove, sizeof (T));
+            removal.setCount (2);
+        }
+        CListTrace::flush ();
+
+        vector<CListTrace::CRecord> records;
+        IZI_ASSERT(CListTrace::read (path, records));
+        IZI_ASSERT(records.size () == 4);
+        IZI_ASSERT(records[0].list == list && records[1].list == other);
+        IZI_ASSERT(records[0].operation == uint8_t (CListTrace::EOperation::Construct));
+        IZI_ASSERT(records[0].valueSize == sizeof (T));
+
+        IZI_ASSERT(records[2].operation == uint8_t (CListTrace::EOperation::Splice));
+        IZI_ASSERT(records[2].list == list && records[2].other == other && records[2].count == 3);
+        IZI_ASSERT(records[2].position == uint8_t (CListTrace::EPosition::Middle));
+
+        IZI_ASSERT(records[3].operation == uint8_t (CListTrace::EOperation::Remove) && records[3].count == 2);
+        for (size_t i = 1; i < records.size (); ++i)
+            IZI_ASSERT(records[i - 1].time <= records[i].time);
+
+        IZI_ASSERT(string (CListTrace::name (CListTrace::EOperation::InsertNode)) == "insert_node");
+        IZI_ASSERT(!CListTrace::read ("CListTraceMissing.trace", records));
+
+        remove (path.c_str ());
+#endif
+    }
+
+    template<typename T>
+    void ListPolicies () noexcept
+    {
+        const int listSize = 10;
+        CCollection<T> data = CValueProvider<T> () (listSize);
+
+        // The default policies are the ones of CList<T>, an uncounted size takes no room
+        IZI_ASSERT((is_same<CList<T>, CList<T, CListPolicy<>>>::value));
+        IZI_ASSERT(sizeof (CList<T, CListPolicy<CUncountedSize>>) < sizeof (CList<T>));
+
+        CList<T, CListPolicy<CUncountedSize>> uncounted (data.cbegin (), data.cend ()), other;
+        IZI_ASSERT(uncounted.size () == size_t (listSize) && !uncounted.empty ());
+        IZI_ASSERT(other.size () == 0 && other.empty ());
+
+        auto first = uncounted.begin (), last = uncounted.begin ();
+        advance (first, 2);
+        advance (last, 7);
+        other.splice (other.end (), uncounted, first, last);
+        IZI_ASSERT(other.size () == 5 && uncounted.size () == size_t (listSize - 5));
+        IZI_ASSERT(other.front () == data[2] && other.back () == data[6]);
+
+        uncounted.pop_front ();
+        uncounted.erase (uncounted.begin ());
+        uncounted.splice (uncounted.begin (), other);
+        IZI_ASSERT(other.empty () && uncounted.size () == size_t (listSize - 2));
+        IZI_ASSERT(uncounted.front () == data[2] && uncounted.back () == data[listSize - 1]);
+
+        uncounted.clear ();
+        IZI_ASSERT(uncounted.empty () && uncounted.size () == 0);
+
+        CList<T, CListPolicy<CCountedSize, CSharedAllocation>> shared (data.cbegin (), data.cend ());
+        IZI_ASSERT(shared.size () == size_t (listSize) && shared.back () == data[listSize - 1]);
+        IZI_ASSERT(shared.memory_usage ().payload == listSize * sizeof (T));
+        shared.remove (data[0]);
+        IZI_ASSERT(shared.front () == data[1]);
+
+        // Two threads pushing in a locked list lose no element
+        const int pushes = 1000;
+        CList<T, CListPolicy<CCountedSize, CDefaultAllocation, CMutexLocking>> locked, spliced;
+        auto push = [&locked, &data] () noexcept
+        {
+            for (int i = 0; i < pushes; ++i)
+                locked.push_back (data[i % listSize]);
+        };
+
+        thread firstPusher (push), secondPusher (push);
+        firstPusher.join ();
+        secondPusher.join ();
+        IZI_ASSERT(locked.size () == 2 * pushes);
+        IZI_ASSERT(distance (locked.cbegin (), locked.cend ()) == 2 * pushes);
+
+        // Both lists are locked, and a list spliced into itself doesn't lock twice
+        spliced.splice (spliced.end (), locked);
+        spliced.splice (spliced.begin (), spliced, --spliced.end ());
+        IZI_ASSERT(locked.empty () && spliced.size () == 2 * pushes);
+    }
+
+    template<typename T>
+    void RunTemplatedTests () noexcept
+    {
+        IZI_SUBTEST(CreateEmptyList<T> ());
+        IZI_SUBTEST(CreateSizedList<T> ());
+
+        for (T x : CValueProvider<T> () (5))
+        IZI_SUBTEST(CreateSizeListWithValue<T> (x));
+
+        IZI_SUBTEST(CreateListByExplicitCopy<T> ());
+        IZI_SUBTEST(CreateListByImplicitCopy<T> ());
+        IZI_SUBTEST(AssignList<T> ());
+
+        IZI_SUBTEST(Iterate<T> ());
+        IZI_SUBTEST(ConstIterate<T> ());
+        IZI_SUBTEST(ReverseIterate<T> ());
+        IZI_SUBTEST(ReverseConstIterate<T> ());
+
+        IZI_SUBTEST(IsEmpty<T> ());
+        IZI_SUBTEST(Size<T> ());
+
+        IZI_SUBTEST(Front<T> ());
+        IZI_SUBTEST(Back<T> ());
+
+        IZI_SUBTEST(AssignByIterator<T> ());
+        for (T x : CValueProvider<T> () (5))
+        IZI_SUBTEST(AssignByValue (x));
+
+        IZI_SUBTEST(EmplaceFront<T> ());
+        IZI_SUBTEST(EmplaceBack<T> ());
+        IZI_SUBTEST(Emplace<T> ());
+
+        IZI_SUBTEST(PushFront<T> ());
+        IZI_SUBTEST(PushBack<T> ());
+
+        IZI_SUBTEST(PopFront<T> ());
+        IZI_SUBTEST(PopBack<T> ());
+
+        IZI_SUBTEST(Insert<T> ());
+        IZI_SUBTEST(InsertByIterator<T> ());
+
+        for (T x : CValueProvider<T> () (5))
+        IZI_SUBTEST(InsertByValue<T> (x));
+
+        IZI_SUBTEST(Erase<T> ());
+
+        IZI_SUBTEST(Swap<T> ());
+
+        IZI_SUBTEST(Resize<T> ());
+
+        IZI_SUBTEST(Clear<T> ());
+
+        IZI_SUBTEST(SpliceList<T>());
+        IZI_SUBTEST(SpliceOne<T>());
+        IZI_SUBTEST(SpliceRange<T>());
+        IZI_SUBTEST(SpliceRelinks<T>());
+
+        IZI_SUBTEST(NodeHandle<T> ());
+        IZI_SUBTEST(ListPolicies<T> ());
+        IZI_SUBTEST(StaticList<T> ());
+
+        IZI_SUBTEST(Remove<T> ());
+        IZI_SUBTEST(RemoveIf<T> ());
+
+        IZI_SUBTEST(Unique<T> ());
+        IZI_SUBTEST(UniqueWithPredicate<T> ());
+        IZI_SUBTEST(Dedup<T> ());
+
+        IZI_SUBTEST(Merge<T> ());
+
+        IZI_SUBTEST(Sort<T> ());
+        IZI_SUBTEST(SortWithPredicate<T> ());
+
+        IZI_SUBTEST(Partition<T> ());
+        IZI_SUBTEST(NthElement<T> ());
+        IZI_SUBTEST(PartialSort<T> ());
+
+        IZI_SUBTEST(Reverse<T> ());
+        IZI_SUBTEST(ReverseFlag<T> ());
+
+        IZI_SUBTEST(TestCNode<T> ());
+
+        IZI_SUBTEST(MemoryUsage<T> ());
+        IZI_SUBTEST(NodeCacheHandoff<T> ());
+        IZI_SUBTEST(HugePageArena<T> ());
+
+        IZI_SUBTEST(IndexedListFind<T> ());
+        IZI_SUBTEST(IndexedListErase<T> ());
+        IZI_SUBTEST(IndexedListSpliceAndSort<T> ());
+
+        IZI_SUBTEST(LruCacheEviction<T> ());
+        IZI_SUBTEST(LruCacheWeight<T> ());
+        IZI_SUBTEST(LruCacheCopy<T> ());
+
+        IZI_SUBTEST(IntrusivePushAndUnlink<T> ());
+        IZI_SUBTEST(IntrusiveSpliceAndRemoveIf<T> ());
+        IZI_SUBTEST(IntrusiveSortAndMerge<T> ());
+        IZI_SUBTEST(IntrusiveMove<T> ());
+
+        IZI_SUBTEST(MappedList<T> (is_trivially_copyable<T> ()));
+
+        IZI_SUBTEST(StreamRoundTrip<T> (CIsSerializable<T> ()));
+        IZI_SUBTEST(StreamThroughPipe<T> (CIsSerializable<T> ()));
+
+        IZI_SUBTEST(ForwardListQueue<T> ());
+        IZI_SUBTEST(ForwardListSplice<T> ());
+        IZI_SUBTEST(ForwardListSortAndMerge<T> ());
+
+        IZI_SUBTEST(PersistentListSnapshot<T> ());
+        IZI_SUBTEST(PersistentListConcurrentReaders<T> ());
+
+        IZI_SUBTEST(RcuListWriter<T> ());
+        IZI_SUBTEST(RcuListConcurrentReaders<T> ());
+
+        IZI_SUBTEST(BlockingListBatches<T> ());
+        IZI_SUBTEST(BlockingListHandoff<T> ());
+
+        IZI_SUBTEST(TimerWheelSchedule<T> ());
+        IZI_SUBTEST(TimerWheelBatches<T> ());
+
+        IZI_SUBTEST(ViewPipeline<T> ());
+        IZI_SUBTEST(GeneratorPipeline<T> ());
+
+        IZI_SUBTEST(TraceRecorder<T> ());
+
+        cout << endl;
+    }
+
+    template<typename T>
+    void ValueDistributions () noexcept
+    {
+        const int count = 1000;
+
+        for (EDistribution distribution : { EDistribution::Random, EDistribution::Sorted, EDistribution::ReverseSorted,
+                                            EDistribution::NearlySorted, EDistribution::ManyDuplicates,
+                                            EDistribution::Zipfian, EDistribution::AllEqual })
+        {
+            // The same seed gives the same values
+            uint64_t seed = valueGenerator () ();
+            seedValues (seed);
+            CCollection<T> data = CValueProvider<T> () (count, distribution);
+            seedValues (seed);
+            IZI_ASSERT(data == CValueProvider<T> () (count, distribution));
+            IZI_ASSERT(data.size () == count);
+
+            CCollection<T> distinct (data);
+            sort (distinct.begin (), distinct.end ());
+            distinct.erase (unique (distinct.begin (), distinct.end ()), distinct.end ());
+
+            switch (distribution)
+            {
+                case EDistribution::Sorted:
+                    IZI_ASSERT(is_sorted (data.cbegin (), data.cend ()));
+                    break;
+                case EDistribution::ReverseSorted:
+                    IZI_ASSERT(is_sorted (data.crbegin (), data.crend ()));
+                    break;
+                case EDistribution::NearlySorted:
+                {
+                    // Each swap breaks the order at four places at most
+                    size_t descents = 0;
+                    for (size_t i = 1; i < data.size (); ++i)
+                        descents += data[i] < data[i - 1];
+                    IZI_ASSERT(descents <= 4 * (count / 100 + 1));
+                    break;
+                }
+                case EDistribution::ManyDuplicates:
+                case EDistribution::Zipfian:
+                    IZI_ASSERT(distinct.size () <= 64);
+                    break;
+                case EDistribution::AllEqual:
+                    IZI_ASSERT(distinct.size () == 1);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // Zipfian values are dominated by the most frequent one
+        CCollection<T> zipfian = CValueProvider<T> () (count, EDistribution::Zipfian);
+        size_t firstCount = std::count (zipfian.cbegin (), zipfian.cend (), zipfian[0]);
+        IZI_ASSERT(firstCount > 1);
+    }
+
+    /*!
+        @brief The seed of the values of the perf mode, so that two runs measure the same work.
+     */
+    const unsigned g_perfSeed = 20141208;
+
+    /*!
+        @brief The number of elements of the lists measured by the perf mode.
+     */
+    const size_t g_perfSize = 100000;
+
+    /*!
+        @brief The number of runs of each operation, the fastest one is kept.
+     */
+    const int g_perfRuns = 3;
+
+    /*!
+        @brief Slowdowns below this number of nanoseconds are noise, whatever their ratio.
+     */
+    const double g_perfNoiseFloor = 100000;
+
+    /*!
+        @brief The measure of an operation, identified by its element type and its name.
+     */
+    struct CPerfResult
+    {
+        string key;
+        size_t size;
+        double nanoseconds;
+        size_t allocations;
+    };
+
+    /*!
+        @brief  Runs @p op on lists of @p size elements of @p data, @p filled or empty, and return its fastest run
+                and the allocations it made. Filled lists are @p sorted before @p op is measured, if asked.
+     */
+    template<typename T, class Operation>
+    CPerfResult MeasureOperation (const string &typeName, const string &name, const CCollection<T> &data,
+                                  size_t size, bool filled, Operation op, bool sorted = false) noexcept
+    {
+        CPerfResult result = { typeName + " " + name, size, 0, 0 };
+
+        for (int run = 0; run < g_perfRuns; ++run)
+        {
+            CTestedList<T> list, other;
+            if (filled)
+            {
+                list.assign (data.cbegin (), data.cbegin () + size);
+                other.assign (data.cbegin (), data.cbegin () + size);
+            }
+            if (filled && sorted)
+            {
+                list.sort ();
+                other.sort ();
+            }
+
+            size_t allocations = g_allocations.load ();
+            chrono::steady_clock::time_point start = chrono::steady_clock::now ();
+            op (list, other);
+            double nanoseconds = chrono::duration<double, nano> (chrono::steady_clock::now () - start).count ();
+
+            result.allocations = g_allocations.load () - allocations;
+            if (run == 0 || nanoseconds < result.nanoseconds)
+                result.nanoseconds = nanoseconds;
+        }
+
+        return result;
+    }
+
+    template<typename T>
+    void RunTemplatedPerf (const string &typeName, vector<CPerfResult> &results) noexcept
+    {
+        seedValues (g_perfSeed);
+        const CCollection<T> data = CValueProvider<T> () (g_perfSize);
+        const size_t n = g_perfSize;
+
+        results.push_back (MeasureOperation<T> (typeName, "push_back", data, n, false, [&data] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            for (const T &x : data)
+                list.push_back (x);
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "push_front", data, n, false, [&data] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            for (const T &x : data)
+                list.push_front (x);
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "insert_range", data, n, false, [&data] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            list.insert (list.end (), data.cbegin (), data.cend ());
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "iterate", data, n, true, [&data] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            IZI_ASSERT(count (list.cbegin (), list.cend (), data[0]) > 0);
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "copy", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            CTestedList<T> copy (list);
+            IZI_ASSERT(copy.size () == list.size ());
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "pop_front", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            while (!list.empty ())
+                list.pop_front ();
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "erase", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            for (auto itr = list.begin (); itr != list.end ();)
+                itr = list.erase (itr);
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "remove_if", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            bool odd = false;
+            list.remove_if ([&odd] (const T &)
+            {
+                return odd = !odd;
+            });
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "unique", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            list.unique ();
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "resize", data, n, true, [n] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            list.resize (n / 2);
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "clear", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            list.clear ();
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "splice_one", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &other)
+        {
+            while (!other.empty ())
+                list.splice (list.end (), other, other.begin ());
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "splice_list", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &other)
+        {
+            list.splice (list.begin (), other);
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "reverse", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            list.reverse ();
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "materialize_reverse", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            list.reverse ();
+            list.materialize_reverse ();
+        }));
+        results.push_back (MeasureOperation<T> (typeName, "sort", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &)
+        {
+            list.sort ();
+        }));
+        // merge takes sorted lists
+        results.push_back (MeasureOperation<T> (typeName, "merge", data, n, true, [] (CTestedList<T> &list, CTestedList<T> &other)
+        {
+            list.merge (other);
+        }, true));
+    }
+
+    /*!
+        @brief  Reads the results stored by @p WriteBaseline in @p path.
+     */
+    bool ReadBaseline (const string &path, vector<CPerfResult> &baseline) noexcept
+    {
+        ifstream in (path);
+        if (!in)
+            return false;
+
+        // One result per line: the element type, the operation, the size, the nanoseconds and the allocations.
+        string type, name;
+        CPerfResult result;
+        while (in >> type >> name >> result.size >> result.nanoseconds >> result.allocations)
+        {
+            result.key = type + " " + name;
+            baseline.push_back (result);
+        }
+
+        return true;
+    }
+
+    bool WriteBaseline (const string &path, const vector<CPerfResult> &results) noexcept
+    {
+        ofstream out (path);
+        for (const CPerfResult &result : results)
+            out << result.key << ' ' << result.size << ' ' << result.nanoseconds << ' ' << result.allocations << '\n';
+
+        return static_cast<bool> (out);
+    }
+}
+
+void *operator new (size_t size)
+{
+    g_allocations.fetch_add (1, memory_order_relaxed);
+
+    if (void *p = malloc (size ? size : 1))
+        return p;
+
+    throw bad_alloc ();
+}
+
+void operator delete (void *p) noexcept
+{
+    free (p);
+}
+
+void CTests::RunTests (uint64_t seed /*= 0*/) noexcept
+{
+    cout << "Starting tests..." << endl << endl;
+
+    if (seed == 0)
+        seed = time (NULL);
+
+    cout << "Seed: " << seed << endl << endl;
+    seedValues (seed);
+
+    IZI_CALLTEST(RunTemplatedTests<int> ());
+    IZI_CALLTEST(RunTemplatedTests<int *> ());
+    IZI_CALLTEST(RunTemplatedTests<shared_ptr<int>> ());
+
+    IZI_CALLTEST(RunTemplatedTests<TestClass> ());
+    IZI_CALLTEST(RunTemplatedTests<TestClass *> ());
+    IZI_CALLTEST(RunTemplatedTests<shared_ptr<TestClass>> ());
+
+    IZI_CALLTEST(ValueDistributions<int> ());
+    IZI_CALLTEST(ValueDistributions<TestClass> ());
+
+    cout << "Tests done..." << endl;
+}
+
+bool CTests::RunPerfTests (const string &baselinePath, bool record, double threshold) noexcept
+{
+    cout << "Starting perf tests..." << endl << endl;
+
+    vector<CPerfResult> results;
+    RunTemplatedPerf<int> ("int", results);
+    RunTemplatedPerf<shared_ptr<int>> ("shared_ptr<int>", results);
+    RunTemplatedPerf<TestClass> ("TestClass", results);
+
+    vector<CPerfResult> baseline;
+    if (record || !ReadBaseline (baselinePath, baseline))
+    {
+        for (const CPerfResult &result : results)
+            cout << left << setw (40) << result.key << right << setw (8) << result.size
+                 << setw (16) << fixed << setprecision (0) << result.nanoseconds << " ns"
+                 << setw (10) << result.allocations << " allocs" << endl;
+
+        bool written = WriteBaseline (baselinePath, results);
+        cout << endl << (written ? "Baseline recorded in " : "Could not record the baseline in ") << baselinePath << endl;
+
+        return written;
+    }
+
+    size_t regressions = 0;
+    for (const CPerfResult &result : results)
+    {
+        auto base = find_if (baseline.cbegin (), baseline.cend (), [&result] (const CPerfResult &x)
+        {
+            return x.key == result.key;
+        });
+
+        cout << left << setw (40) << result.key << right;
+        if (base == baseline.cend () || base->size != result.size)
+        {
+            cout << "  no baseline" << endl;
+            continue;
+        }
+
+        double timeRatio = result.nanoseconds / base->nanoseconds;
+        bool slower = timeRatio > 1 + threshold && result.nanoseconds - base->nanoseconds > g_perfNoiseFloor;
+        bool moreAllocations = result.allocations > base->allocations * (1 + threshold);
+
+        cout << setw (16) << fixed << setprecision (0) << base->nanoseconds << " ->" << setw (14) << result.nanoseconds
+             << " ns (x" << setprecision (2) << timeRatio << ")"
+             << setw (10) << base->allocations << " ->" << setw (10) << result.allocations << " allocs";
+
+        if (slower || moreAllocations)
+        {
+            ++regressions;
+            cout << "\033[31m  REGRESSED: " << (slower ? "time " : "") << (moreAllocations ? "allocations" : "") << "\033[0m";
+        }
+        cout << endl;
+    }
+
+    cout << endl;
+    if (regressions != 0)
+        cout << "\033[31mPERF TESTS FAILED: " << regressions << " operation(s) regressed by more than "
+             << setprecision (0) << threshold * 100 << "% against " << baselinePath << "\033[0m" << endl;
+    else
+        cout << "Perf tests done, no regression against " << baselinePath << endl;
+
+    return regressions == 0;
 }
@@ -7,7 +7,9 @@
 */
 #pragma once
 
+#include <cstdint>
 #include <list>
+#include <string>
 
 /*!
     @brief Regroups everything related to tests.
@@ -22,8 +24,19 @@ namespace nsTests
     public:
         /*!
             @brief Run all the tests....
+            @param[in] seed The seed of the values, printed to reproduce a run, from the time if 0.
          */
-        static void RunTests () noexcept;
+        static void RunTests (std::uint64_t seed = 0) noexcept;
+
+        /*!
+            @brief  Run the perf mode: each CList operation on large lists of fixed values, timed and with its
+                    allocations counted, then compared to the baseline at @p baselinePath.
+            @param[in] baselinePath The file of the baseline, recorded there if it doesn't exist.
+            @param[in] record If the baseline is recorded again instead of compared.
+            @param[in] threshold The slowdown, or the increase of allocations, from which an operation regressed.
+            @return bool False if an operation regressed, or if the baseline couldn't be recorded.
+         */
+        static bool RunPerfTests (const std::string &baselinePath, bool record, double threshold) noexcept;
 
     private:
         // Remove the default construcot (C++11 :))
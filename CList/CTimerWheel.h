@@ -0,0 +1,219 @@
+/*!
+@file CTimerWheel.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the CTimerWheel class.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CList.h"
+
+namespace nsSdD
+{
+    template<typename T>
+    /*!
+       @brief CTimerWheel schedules values to expire after a number of ticks, in a hierarchical timer wheel whose
+              buckets are CList.
+
+              The wheel has @p levelCount levels of @p slotCount buckets: a timer goes to the level whose span
+              holds its delay, in the bucket of its deadline at that level. Scheduling and cancelling are O(1),
+              a timer being cancelled through the iterator returned when it was scheduled. When a level completes
+              a turn, the timers of the next bucket of the level above are cascaded down by splicing their nodes,
+              without copying nor allocating, those due at that tick expiring at once. The timers due at a tick
+              are spliced out of their bucket at once, and handed over as a batch. Timers farther than the span
+              of the wheel wait in an overflow list, placed again at each turn of the highest level.
+              Advancing skips the ticks before the next turn of the lowest level holding timers, so that a
+              sparse wheel doesn't visit its empty buckets.
+    */
+    class CTimerWheel
+    {
+    public:
+        /*!
+            @typedef size_type
+            @brief This define a @p size_t.
+         */
+        typedef size_t size_type;
+
+        /*!
+            @typedef tick_type
+            @brief The time of the wheel, in ticks.
+         */
+        typedef std::uint64_t tick_type;
+
+        /*!
+            @brief A scheduled value and its deadline.
+         */
+        struct CTimer
+        {
+            /*!
+                @var deadline
+                @brief The tick at which the timer expires.
+             */
+            tick_type deadline;
+
+            /*!
+                @var value
+                @brief The scheduled value.
+             */
+            T value;
+
+            /*!
+                @var bucket
+                @brief The index of the bucket holding the timer, @p noBucket once expired or cancelled.
+             */
+            size_type bucket;
+
+            explicit CTimer (tick_type d = 0, const T &v = T (), size_type b = 0) noexcept
+                    : deadline (d), value (v), bucket (b)
+            {
+            }
+        };
+
+        /*!
+            @typedef timer_list
+            @brief The list of the timers of a bucket, and of the batches of expired timers.
+         */
+        typedef CList<CTimer> timer_list;
+
+        /*!
+            @typedef iterator
+            @brief The position of a scheduled timer, to cancel it.
+                    It stays valid when the timer is cascaded, and keeps the node alive once it expired.
+         */
+        typedef typename timer_list::iterator iterator;
+
+        /*!
+            @brief The number of bits of the slot index at each level.
+         */
+        static const size_type levelBits = 8;
+
+        /*!
+            @brief The number of buckets of a level.
+         */
+        static const size_type slotCount = size_type (1) << levelBits;
+
+        /*!
+            @brief The number of levels, spanning slotCount ^ levelCount ticks.
+         */
+        static const size_type levelCount = 3;
+
+        /*!
+            @brief The bucket of the timers not scheduled anymore.
+         */
+        static const size_type noBucket = size_type (-1);
+
+        /*!
+            @brief  This is the constructor of an empty CTimerWheel.
+            @param[in] now The current tick.
+         */
+        explicit CTimerWheel (tick_type now = 0) noexcept;
+
+        CTimerWheel (const CTimerWheel &) = delete;
+
+        CTimerWheel &operator= (const CTimerWheel &) = delete;
+
+        /*!
+            @brief  This function schedules @p value to expire in @p delay ticks, at the next tick at least.
+            @return iterator The position of the timer, to cancel it.
+         */
+        iterator schedule (tick_type delay, const T &value) noexcept;
+
+        /*!
+            @brief  This function removes the timer at @p position.
+            @return bool True if it was cancelled, false if it already expired or was cancelled.
+         */
+        bool cancel (iterator position) noexcept;
+
+        /*!
+            @brief  This function advances the wheel by @p ticks, and moves the expired timers at the end of
+                    @p expired, in the order of their deadlines.
+            @return size_type The number of expired timers.
+         */
+        size_type advance (tick_type ticks, timer_list &expired) noexcept;
+
+        /*!
+            @brief  This function advances the wheel by @p ticks, and calls @p onExpire with each expired timer,
+                    in the order of their deadlines. The timers of a tick are taken from the wheel at once,
+                    then given to @p onExpire.
+            @return size_type The number of expired timers.
+         */
+        template<class Function>
+        size_type advance (tick_type ticks, Function onExpire) noexcept;
+
+        /*!
+            @brief  This function return the current tick.
+         */
+        tick_type now () const noexcept;
+
+        /*!
+            @brief  This function return the number of scheduled timers.
+         */
+        size_type size () const noexcept;
+
+        /*!
+            @brief  This function return true if no timer is scheduled, false otherwise.
+         */
+        bool empty () const noexcept;
+
+    private:
+        /*!
+            @brief  The index of the overflow list, after the buckets.
+         */
+        static const size_type overflowBucket = levelCount * slotCount;
+
+        /*!
+            @brief  Return the bucket of a timer expiring at @p deadline.
+         */
+        size_type bucketOf (tick_type deadline) const noexcept;
+
+        /*!
+            @brief  Moves the timers of @p bucket to the buckets of their deadlines, and those due at the current
+                    tick at the end of @p expired.
+         */
+        void cascade (size_type bucket, timer_list &expired) noexcept;
+
+        /*!
+            @brief  Advances the wheel, by @p ticks at most, over the ticks which would neither expire nor cascade
+                    any timer.
+            @return tick_type The number of ticks skipped.
+         */
+        tick_type skipIdle (tick_type ticks) noexcept;
+
+        /*!
+            @brief  Advances the wheel by one tick, cascading the levels completing a turn, and moves the timers
+                    due at the end of @p expired.
+         */
+        size_type tick (timer_list &expired) noexcept;
+
+        /*!
+            @var m_buckets
+            @brief The buckets of each level, level after level, then the overflow list.
+         */
+        timer_list m_buckets[levelCount * slotCount + 1];
+
+        /*!
+            @var m_now
+            @brief The current tick.
+         */
+        tick_type m_now;
+
+        /*!
+            @var m_size
+            @brief The number of scheduled timers.
+         */
+        size_type m_size = 0;
+
+        /*!
+            @var m_levelSizes
+            @brief The number of timers of each level, then of the overflow list.
+         */
+        size_type m_levelSizes[levelCount + 1] = {};
+    };
+}
+
+#include "CTimerWheel.hxx"
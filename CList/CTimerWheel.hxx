@@ -0,0 +1,200 @@
+/*!
+@file CTimerWheel.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief CTimerWheel class implementation.
+*/
+#pragma once
+
+#include <algorithm>
+
+#include "CTimerWheel.h"
+
+template<typename T>
+nsSdD::CTimerWheel<T>::CTimerWheel (tick_type now /*= 0*/) noexcept : m_now (now)
+{
+}
+
+template<typename T>
+typename nsSdD::CTimerWheel<T>::iterator nsSdD::CTimerWheel<T>::schedule (tick_type delay, const T &value) noexcept
+{
+    tick_type deadline = m_now + (delay ? delay : 1);
+    size_type bucket = bucketOf (deadline);
+
+    ++m_size;
+    ++m_levelSizes[bucket / slotCount];
+    return m_buckets[bucket].insert (m_buckets[bucket].end (), CTimer (deadline, value, bucket));
+}
+
+template<typename T>
+bool nsSdD::CTimerWheel<T>::cancel (iterator position) noexcept
+{
+    size_type bucket = position->bucket;
+    if (bucket == noBucket)
+        return false;
+
+    position->bucket = noBucket;
+    m_buckets[bucket].erase (position);
+    --m_size;
+    --m_levelSizes[bucket / slotCount];
+
+    return true;
+}
+
+template<typename T>
+typename nsSdD::CTimerWheel<T>::size_type nsSdD::CTimerWheel<T>::advance (tick_type ticks, timer_list &expired) noexcept
+{
+    size_type count = 0;
+
+    for (; ticks > 0; --ticks)
+    {
+        ticks -= skipIdle (ticks);
+        if (ticks == 0)
+            break;
+
+        count += tick (expired);
+    }
+
+    return count;
+}
+
+template<typename T>
+template<class Function>
+typename nsSdD::CTimerWheel<T>::size_type nsSdD::CTimerWheel<T>::advance (tick_type ticks, Function onExpire) noexcept
+{
+    size_type count = 0;
+    timer_list expired;
+
+    for (; ticks > 0; --ticks)
+    {
+        ticks -= skipIdle (ticks);
+        if (ticks == 0)
+            break;
+
+        if (tick (expired) == 0)
+            continue;
+
+        // onExpire may schedule or cancel timers, the batch is out of the wheel
+        for (const CTimer &timer : expired)
+        {
+            onExpire (timer);
+            ++count;
+        }
+        expired.clear ();
+    }
+
+    return count;
+}
+
+template<typename T>
+typename nsSdD::CTimerWheel<T>::tick_type nsSdD::CTimerWheel<T>::now () const noexcept
+{
+    return m_now;
+}
+
+template<typename T>
+typename nsSdD::CTimerWheel<T>::size_type nsSdD::CTimerWheel<T>::size () const noexcept
+{
+    return m_size;
+}
+
+template<typename T>
+bool nsSdD::CTimerWheel<T>::empty () const noexcept
+{
+    return m_size == 0;
+}
+
+template<typename T>
+typename nsSdD::CTimerWheel<T>::size_type nsSdD::CTimerWheel<T>::bucketOf (tick_type deadline) const noexcept
+{
+    tick_type delay = deadline - m_now;
+
+    for (size_type level = 0; level < levelCount; ++level)
+        if (delay < tick_type (1) << (levelBits * (level + 1)))
+            return level * slotCount + ((deadline >> (levelBits * level)) & (slotCount - 1));
+
+    return overflowBucket;
+}
+
+template<typename T>
+void nsSdD::CTimerWheel<T>::cascade (size_type bucket, timer_list &expired) noexcept
+{
+    timer_list &source = m_buckets[bucket];
+    size_type level = bucket / slotCount;
+
+    // Each timer is visited once, those of the overflow list going back to it are spliced after the others
+    for (size_type n = source.size (); n > 0; --n)
+    {
+        iterator timer = source.begin ();
+        --m_levelSizes[level];
+
+        // Due at this tick: expired at once, rather than cascaded into the bucket taken right after
+        if (timer->deadline == m_now)
+        {
+            timer->bucket = noBucket;
+            --m_size;
+            expired.splice (expired.end (), source, timer);
+            continue;
+        }
+
+        timer->bucket = bucketOf (timer->deadline);
+        ++m_levelSizes[timer->bucket / slotCount];
+
+        timer_list &target = m_buckets[timer->bucket];
+        target.splice (target.end (), source, timer);
+    }
+}
+
+template<typename T>
+typename nsSdD::CTimerWheel<T>::tick_type nsSdD::CTimerWheel<T>::skipIdle (tick_type ticks) noexcept
+{
+    if (m_size == 0)
+    {
+        m_now += ticks;
+        return ticks;
+    }
+
+    // Until the next turn of the lowest level holding timers, the ticks neither expire nor cascade anything
+    size_type level = 0;
+    while (m_levelSizes[level] == 0)
+        ++level;
+
+    tick_type span = tick_type (1) << (levelBits * level);
+    tick_type idle = std::min (ticks, span - 1 - (m_now & (span - 1)));
+    m_now += idle;
+
+    return idle;
+}
+
+template<typename T>
+typename nsSdD::CTimerWheel<T>::size_type nsSdD::CTimerWheel<T>::tick (timer_list &expired) noexcept
+{
+    ++m_now;
+
+    size_type count = m_size;
+
+    // From the highest level, whose timers may fall in the buckets cascaded after them
+    for (size_type level = levelCount; level > 0; --level)
+    {
+        if (m_now & ((tick_type (1) << (levelBits * level)) - 1))
+            continue;
+
+        cascade (level == levelCount ? overflowBucket
+                                     : level * slotCount + ((m_now >> (levelBits * level)) & (slotCount - 1)),
+                 expired);
+    }
+
+    timer_list &due = m_buckets[m_now & (slotCount - 1)];
+    if (due.empty ())
+        return count - m_size;
+
+    for (CTimer &timer : due)
+        timer.bucket = noBucket;
+
+    m_size -= due.size ();
+    m_levelSizes[0] -= due.size ();
+    expired.splice (expired.end (), due);
+
+    return count - m_size;
+}
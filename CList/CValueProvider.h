@@ -7,18 +7,135 @@
 #pragma once
 
 #include "CTestClass.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <vector>
 #include <limits>
 
 namespace nsTests
 {
     /*!
-        @brief Generates random int between min and max.
-                Be careful to seed the random generator.
+        @brief Fast pseudo-random generator (xoshiro256**), giving the same values for the same seed on every platform.
      */
-    int rand (int min, int max)
+    class CRandom
     {
-        return min + (std::rand () % (max - min + 1));
+    public:
+        /*!
+            @brief Seeds the generator, its state being expanded from @p seed by splitmix64.
+         */
+        explicit CRandom (std::uint64_t seed = 0) noexcept
+        {
+            this->seed (seed);
+        }
+
+        void seed (std::uint64_t seed) noexcept
+        {
+            for (std::uint64_t &word : m_state)
+            {
+                std::uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                word = z ^ (z >> 31);
+            }
+        }
+
+        /*!
+            @brief  Return the next 64 random bits.
+         */
+        std::uint64_t operator() () noexcept
+        {
+            const std::uint64_t result = rotate (m_state[1] * 5, 7) * 9;
+            const std::uint64_t t = m_state[1] << 17;
+
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+            m_state[2] ^= t;
+            m_state[3] = rotate (m_state[3], 45);
+
+            return result;
+        }
+
+        /*!
+            @brief  Return a number uniformly distributed in [0, 1).
+         */
+        double uniform () noexcept
+        {
+            return ((*this) () >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+    private:
+        static std::uint64_t rotate (std::uint64_t x, int k) noexcept
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        std::uint64_t m_state[4];
+    };
+
+    /*!
+        @brief The generator of all the values of the tests. Seed it with @p seedValues to reproduce a run.
+     */
+    inline CRandom &valueGenerator () noexcept
+    {
+        static CRandom generator;
+        return generator;
+    }
+
+    /*!
+        @brief Seeds the generator of the values.
+     */
+    inline void seedValues (std::uint64_t seed) noexcept
+    {
+        valueGenerator ().seed (seed);
+    }
+
+    /*!
+        @brief Generates random int between min and max, from the generator seeded by @p seedValues.
+     */
+    inline int rand (int min, int max) noexcept
+    {
+        return min + static_cast<int> (valueGenerator () () % (static_cast<std::uint64_t> (max) - min + 1));
+    }
+
+    /*!
+        @brief The shapes of the collections given by CValueProvider.
+     */
+    enum class EDistribution
+    {
+        Random,             //!< Independent random values.
+        Sorted,             //!< The random values in increasing order.
+        ReverseSorted,      //!< The random values in decreasing order.
+        NearlySorted,       //!< Sorted, then about one value in a hundred swapped with a random other one.
+        ManyDuplicates,     //!< About the square root of the count of distinct values, equally frequent.
+        Zipfian,            //!< Few distinct values, the k-th most frequent being k times rarer than the first.
+        AllEqual            //!< A single value.
+    };
+
+    /*!
+        @brief  Return the name of @p distribution.
+     */
+    inline const char *distributionName (EDistribution distribution) noexcept
+    {
+        switch (distribution)
+        {
+            case EDistribution::Sorted:
+                return "sorted";
+            case EDistribution::ReverseSorted:
+                return "reverse-sorted";
+            case EDistribution::NearlySorted:
+                return "nearly-sorted";
+            case EDistribution::ManyDuplicates:
+                return "many-duplicates";
+            case EDistribution::Zipfian:
+                return "zipfian";
+            case EDistribution::AllEqual:
+                return "all-equal";
+            default:
+                return "random";
+        }
     }
 
     // C++11 c'est bon, mangez-en.
@@ -29,6 +146,66 @@ namespace nsTests
      */
     template<typename T> using CCollection = std::vector<T>;
 
+    /*!
+        @brief  Gives the shape of @p distribution to the random values of @p array, in place.
+                The values are compared with their operator<.
+     */
+    template<typename T>
+    void shapeValues (CCollection<T> &array, EDistribution distribution) noexcept
+    {
+        if (array.empty () || distribution == EDistribution::Random)
+            return;
+
+        CRandom &generator = valueGenerator ();
+        const size_t size = array.size ();
+
+        switch (distribution)
+        {
+            case EDistribution::NearlySorted:
+                std::sort (array.begin (), array.end ());
+                for (size_t i = 0; i < size / 100 + 1; ++i)
+                    std::swap (array[generator () % size], array[generator () % size]);
+                break;
+
+            case EDistribution::ManyDuplicates:
+            case EDistribution::Zipfian:
+            {
+                // The values are drawn from a pool of the first ones.
+                const bool zipfian = distribution == EDistribution::Zipfian;
+                const size_t poolSize = std::max<size_t> (1, zipfian ? std::min<size_t> (size, 64)
+                                                                     : static_cast<size_t> (std::sqrt (size)));
+                const CCollection<T> pool (array.begin (), array.begin () + poolSize);
+
+                std::vector<double> cumulated (poolSize);
+                double total = 0;
+                for (size_t k = 0; k < poolSize; ++k)
+                    cumulated[k] = total += zipfian ? 1.0 / (k + 1) : 1.0;
+
+                for (T &x : array)
+                {
+                    size_t k = std::upper_bound (cumulated.begin (), cumulated.end (), generator.uniform () * total) - cumulated.begin ();
+                    x = pool[std::min (k, poolSize - 1)];
+                }
+                break;
+            }
+
+            case EDistribution::AllEqual:
+                std::fill (array.begin () + 1, array.end (), array[0]);
+                break;
+
+            case EDistribution::ReverseSorted:
+                std::sort (array.begin (), array.end (), [] (const T &a, const T &b)
+                {
+                    return b < a;
+                });
+                break;
+
+            default:
+                std::sort (array.begin (), array.end ());
+                break;
+        }
+    }
+
     /*!
         @brief CValueProvider provides semi-random values for tested classes...
      */
@@ -36,7 +213,7 @@ namespace nsTests
     class CValueProvider
     {
     public:
-        CCollection<T> operator() (const int /*valueCount*/ = 0)
+        CCollection<T> operator() (const int /*valueCount*/ = 0, EDistribution = EDistribution::Random)
         {
             // typeid(T).name() only gives mangled class name, not very clear but still a good indication.
             throw std::runtime_error (std::string ("Value provider for type ") + typeid (T).name () + " does not exist.");
@@ -50,9 +227,9 @@ namespace nsTests
     class CValueProvider<T *>
     {
     public:
-        CCollection<T *> operator() (const int valueCount = 0)
+        CCollection<T *> operator() (const int valueCount = 0, EDistribution distribution = EDistribution::Random)
         {
-            CCollection<T> array = CValueProvider<T> () (valueCount);
+            CCollection<T> array = CValueProvider<T> () (valueCount, distribution);
             CCollection<T *> ptrArray;
             ptrArray.reserve (array.size ());
 
@@ -70,9 +247,9 @@ namespace nsTests
     class CValueProvider<std::shared_ptr<T>>
     {
     public:
-        CCollection<std::shared_ptr<T>> operator() (const int valueCount = 0)
+        CCollection<std::shared_ptr<T>> operator() (const int valueCount = 0, EDistribution distribution = EDistribution::Random)
         {
-            CCollection<T> array = CValueProvider<T> () (valueCount);
+            CCollection<T> array = CValueProvider<T> () (valueCount, distribution);
             CCollection<std::shared_ptr<T>> ptrArray;
             ptrArray.reserve (array.size ());
 
@@ -90,18 +267,21 @@ namespace nsTests
     class CValueProvider<int>
     {
     public:
-        CCollection<int> operator() (const int valueCount = 0) noexcept
+        CCollection<int> operator() (const int valueCount = 0, EDistribution distribution = EDistribution::Random) noexcept
         {
             int arraySize = valueCount ? valueCount : rand (10, 100);
 
             CCollection<int> array (arraySize);
+            CRandom &generator = valueGenerator ();
 
-            array[0] = 0;
-            array[1] = std::numeric_limits<int>::max ();
-            array[2] = std::numeric_limits<int>::min ();
+            for (int &x : array)
+                x = static_cast<int> (generator () >> 33);
 
-            for (int i = 3; i < arraySize; ++i)
-                array[i] = std::rand ();
+            // The limits, when there is room for them
+            const int limits[] = { 0, std::numeric_limits<int>::max (), std::numeric_limits<int>::min () };
+            std::copy (limits, limits + std::min (arraySize, 3), array.begin ());
+
+            shapeValues (array, distribution);
 
             return array;
         }
@@ -114,7 +294,7 @@ namespace nsTests
     class CValueProvider<TestClass>
     {
     public:
-        CCollection<TestClass> operator() (const int valueCount = 0) noexcept
+        CCollection<TestClass> operator() (const int valueCount = 0, EDistribution distribution = EDistribution::Random) noexcept
         {
             int arraySize = valueCount ? valueCount : rand (10, 100);
             CCollection<TestClass> array;
@@ -122,15 +302,20 @@ namespace nsTests
 
             array.push_back (TestClass (4654, "MARQUE LA PORTE"));
 
+            // Each name is written in place in a string of its final length.
+            std::string name;
+            name.reserve (20);
             for (int i = array.size (); i < arraySize; ++i)
             {
-                std::string name;
-                for (int j = 0; j < rand (10, 20); ++j)
-                    name += static_cast<char>(rand (66, 89));
+                name.resize (rand (10, 20));
+                for (char &c : name)
+                    c = static_cast<char> (rand (66, 89));
 
                 array.push_back (TestClass (rand (0, 30), name));
             }
 
+            shapeValues (array, distribution);
+
             return array;
         }
     };
@@ -0,0 +1,479 @@
+/*!
+@file CView.h
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Header to the lazy views over CList and other ranges.
+
+A view is a pair of iterators computing its elements on demand from the view, or the CList, it adapts:
+nothing is copied nor allocated when a view is built, and a pipeline of views is walked in a single pass.
+Views are composed with the operator|, from a CList or another view:
+
+@code
+CList<int> squares = list | filter (isOdd) | transform (square) | take (10) | to<CList> ();
+@endcode
+
+A view refers to the CList it adapts, which must outlive it. The functions given to @p filter and
+@p transform are kept by the view, its iterators point to them: a view must outlive its iterators.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "CList.h"
+
+namespace nsSdD
+{
+    template<class Iterator>
+    /*!
+       @brief CRange is the view of the elements from an iterator to another one.
+    */
+    class CRange
+    {
+    public:
+        /*!
+            @typedef iterator
+            @brief The iterator of the range.
+         */
+        typedef Iterator iterator;
+
+        /*!
+            @typedef value_type
+            @brief The type of the elements, without the const of the const_iterator of CList.
+         */
+        typedef typename std::remove_cv<typename std::iterator_traits<Iterator>::value_type>::type value_type;
+
+        /*!
+            @brief This is the constructor of the range from @p first to @p last.
+         */
+        CRange (Iterator first, Iterator last) noexcept : m_first (first), m_last (last)
+        {
+        }
+
+        /*!
+            @brief  This function return an iterator to the first element.
+         */
+        iterator begin () const noexcept
+        {
+            return m_first;
+        }
+
+        /*!
+            @brief  This function return an iterator following the last element.
+         */
+        iterator end () const noexcept
+        {
+            return m_last;
+        }
+
+        /*!
+            @brief  This function return true if the range has no element, false otherwise.
+         */
+        bool empty () const noexcept
+        {
+            return m_first == m_last;
+        }
+
+    private:
+        /*!
+            @var m_first
+            @brief The first element.
+         */
+        Iterator m_first;
+
+        /*!
+            @var m_last
+            @brief The element following the last one.
+         */
+        Iterator m_last;
+    };
+
+    /*!
+        @brief Tells how a type is seen as a view: a view is seen as itself, a CList as the range of its elements.
+     */
+    template<class View>
+    struct CViewOf
+    {
+        typedef View type;
+
+        static const View &get (const View &view) noexcept
+        {
+            return view;
+        }
+    };
+
+    /*!
+        @brief A CList is seen as the range of its elements, it is never copied.
+     */
+    template<typename T, class Policy>
+    struct CViewOf<CList<T, Policy>>
+    {
+        typedef CRange<typename CList<T, Policy>::const_iterator> type;
+
+        static type get (const CList<T, Policy> &list) noexcept
+        {
+            return type (list.cbegin (), list.cend ());
+        }
+    };
+
+    template<class View, class Predicate>
+    /*!
+       @brief CFilterView is the view of the elements of a view for which a predicate is true.
+    */
+    class CFilterView
+    {
+        struct CIterator;
+
+    public:
+        typedef CIterator iterator;
+
+        typedef typename View::value_type value_type;
+
+        CFilterView (const View &view, Predicate pred) noexcept : m_view (view), m_pred (pred)
+        {
+        }
+
+        iterator begin () const noexcept;
+
+        iterator end () const noexcept;
+
+    private:
+        /*!
+            @var m_view
+            @brief The view filtered.
+         */
+        View m_view;
+
+        /*!
+            @var m_pred
+            @brief The predicate selecting the elements.
+         */
+        Predicate m_pred;
+    };
+
+    template<class View, class Function>
+    /*!
+       @brief CTransformView is the view of the results of a function on the elements of a view, computed
+              each time an element is accessed.
+    */
+    class CTransformView
+    {
+        struct CIterator;
+
+    public:
+        typedef CIterator iterator;
+
+        /*!
+            @typedef reference
+            @brief The result of the function, returned as it is.
+         */
+        typedef decltype (std::declval<const Function &> () (*std::declval<typename View::iterator> ())) reference;
+
+        typedef typename std::decay<reference>::type value_type;
+
+        CTransformView (const View &view, Function f) noexcept : m_view (view), m_function (f)
+        {
+        }
+
+        iterator begin () const noexcept;
+
+        iterator end () const noexcept;
+
+    private:
+        /*!
+            @var m_view
+            @brief The view transformed.
+         */
+        View m_view;
+
+        /*!
+            @var m_function
+            @brief The function applied to the elements.
+         */
+        Function m_function;
+    };
+
+    template<class View>
+    /*!
+       @brief CTakeView is the view of the first elements of a view. It never reads past them, hence it can
+              end an infinite view.
+    */
+    class CTakeView
+    {
+        struct CIterator;
+
+    public:
+        typedef CIterator iterator;
+
+        typedef typename View::value_type value_type;
+
+        CTakeView (const View &view, size_t count) noexcept : m_view (view), m_count (count)
+        {
+        }
+
+        iterator begin () const noexcept;
+
+        iterator end () const noexcept;
+
+    private:
+        /*!
+            @var m_view
+            @brief The view taken from.
+         */
+        View m_view;
+
+        /*!
+            @var m_count
+            @brief The maximum number of elements.
+         */
+        size_t m_count;
+    };
+
+    template<class View>
+    /*!
+       @brief CDropView is the view of the elements of a view after its first ones, which are skipped by @p begin.
+    */
+    class CDropView
+    {
+    public:
+        typedef typename View::iterator iterator;
+
+        typedef typename View::value_type value_type;
+
+        CDropView (const View &view, size_t count) noexcept : m_view (view), m_count (count)
+        {
+        }
+
+        iterator begin () const noexcept;
+
+        iterator end () const noexcept;
+
+    private:
+        /*!
+            @var m_view
+            @brief The view dropped from.
+         */
+        View m_view;
+
+        /*!
+            @var m_count
+            @brief The number of elements skipped.
+         */
+        size_t m_count;
+    };
+
+    template<class View1, class View2>
+    /*!
+       @brief CZipView is the view of the pairs of elements at the same position in two views, as long as the
+              shorter one.
+    */
+    class CZipView
+    {
+        struct CIterator;
+
+    public:
+        typedef CIterator iterator;
+
+        /*!
+            @typedef reference
+            @brief A pair of the references to the elements of both views.
+         */
+        typedef std::pair<typename std::iterator_traits<typename View1::iterator>::reference,
+                          typename std::iterator_traits<typename View2::iterator>::reference> reference;
+
+        typedef std::pair<typename View1::value_type, typename View2::value_type> value_type;
+
+        CZipView (const View1 &view1, const View2 &view2) noexcept : m_view1 (view1), m_view2 (view2)
+        {
+        }
+
+        iterator begin () const noexcept;
+
+        iterator end () const noexcept;
+
+    private:
+        /*!
+            @var m_view1
+            @brief The view of the first elements of the pairs.
+         */
+        View1 m_view1;
+
+        /*!
+            @var m_view2
+            @brief The view of the second elements of the pairs.
+         */
+        View2 m_view2;
+    };
+
+    template<class View>
+    /*!
+       @brief CChunkView is the view of the consecutive ranges of a given size in a view, the last one may be shorter.
+    */
+    class CChunkView
+    {
+        struct CIterator;
+
+    public:
+        typedef CIterator iterator;
+
+        typedef CRange<typename View::iterator> value_type;
+
+        CChunkView (const View &view, size_t size) noexcept : m_view (view), m_size (size)
+        {
+        }
+
+        iterator begin () const noexcept;
+
+        iterator end () const noexcept;
+
+    private:
+        /*!
+            @var m_view
+            @brief The view cut in chunks.
+         */
+        View m_view;
+
+        /*!
+            @var m_size
+            @brief The number of elements of a chunk.
+         */
+        size_t m_size;
+    };
+
+    /*!
+        @brief The argument of the operator| building a CFilterView.
+     */
+    template<class Predicate>
+    struct CFilterAdaptor
+    {
+        Predicate pred;
+    };
+
+    /*!
+        @brief The argument of the operator| building a CTransformView.
+     */
+    template<class Function>
+    struct CTransformAdaptor
+    {
+        Function function;
+    };
+
+    /*!
+        @brief The argument of the operator| building a CTakeView.
+     */
+    struct CTakeAdaptor
+    {
+        size_t count;
+    };
+
+    /*!
+        @brief The argument of the operator| building a CDropView.
+     */
+    struct CDropAdaptor
+    {
+        size_t count;
+    };
+
+    /*!
+        @brief The argument of the operator| building a CZipView with the other view.
+     */
+    template<class View>
+    struct CZipAdaptor
+    {
+        View view;
+    };
+
+    /*!
+        @brief The argument of the operator| building a CChunkView.
+     */
+    struct CChunkAdaptor
+    {
+        size_t size;
+    };
+
+    /*!
+        @brief The argument of the operator| copying a view in a new container.
+     */
+    template<template<typename...> class Container>
+    struct CToAdaptor
+    {
+    };
+
+    /*!
+        @brief  Return the view of the elements from @p first to @p last.
+     */
+    template<class Iterator>
+    CRange<Iterator> range (Iterator first, Iterator last) noexcept;
+
+    /*!
+        @brief  Return the view of all the elements of @p list.
+     */
+    template<typename T, class Policy>
+    CRange<typename CList<T, Policy>::const_iterator> all (const CList<T, Policy> &list) noexcept;
+
+    /*!
+        @brief  Keeps the elements for which @p pred is true.
+     */
+    template<class Predicate>
+    CFilterAdaptor<Predicate> filter (Predicate pred) noexcept;
+
+    /*!
+        @brief  Replaces the elements by the result of @p f on them.
+     */
+    template<class Function>
+    CTransformAdaptor<Function> transform (Function f) noexcept;
+
+    /*!
+        @brief  Keeps the first @p count elements.
+     */
+    CTakeAdaptor take (size_t count) noexcept;
+
+    /*!
+        @brief  Skips the first @p count elements.
+     */
+    CDropAdaptor drop (size_t count) noexcept;
+
+    /*!
+        @brief  Pairs the elements with those of @p other, a view or a CList.
+     */
+    template<class Other>
+    CZipAdaptor<typename CViewOf<Other>::type> zip (const Other &other) noexcept;
+
+    /*!
+        @brief  Groups the elements in ranges of @p size elements.
+     */
+    CChunkAdaptor chunk (size_t size) noexcept;
+
+    /*!
+        @brief  Copies the elements in a new Container, a CList by default, linked into it at once.
+     */
+    template<template<typename...> class Container = CList>
+    CToAdaptor<Container> to () noexcept;
+
+    template<class Source, class Predicate>
+    CFilterView<typename CViewOf<Source>::type, Predicate> operator| (const Source &source, const CFilterAdaptor<Predicate> &adaptor) noexcept;
+
+    template<class Source, class Function>
+    CTransformView<typename CViewOf<Source>::type, Function> operator| (const Source &source, const CTransformAdaptor<Function> &adaptor) noexcept;
+
+    template<class Source>
+    CTakeView<typename CViewOf<Source>::type> operator| (const Source &source, const CTakeAdaptor &adaptor) noexcept;
+
+    template<class Source>
+    CDropView<typename CViewOf<Source>::type> operator| (const Source &source, const CDropAdaptor &adaptor) noexcept;
+
+    template<class Source, class View>
+    CZipView<typename CViewOf<Source>::type, View> operator| (const Source &source, const CZipAdaptor<View> &adaptor) noexcept;
+
+    template<class Source>
+    CChunkView<typename CViewOf<Source>::type> operator| (const Source &source, const CChunkAdaptor &adaptor) noexcept;
+
+    template<class Source, template<typename...> class Container>
+    Container<typename CViewOf<Source>::type::value_type> operator| (const Source &source, const CToAdaptor<Container> &adaptor) noexcept;
+}
+
+#include "CView.hxx"
@@ -0,0 +1,476 @@
+/*!
+@file CView.hxx
+@author agent
+@date 19/10/2026
+@version  1.0
+@brief Lazy views and iterators implementation.
+*/
+#pragma once
+
+#include "CView.h"
+
+/*!
+    @brief Iterator of CFilterView, always on an element for which the predicate is true, or at the end.
+ */
+template<class View, class Predicate>
+struct nsSdD::CFilterView<View, Predicate>::CIterator
+        : public std::iterator<std::forward_iterator_tag, value_type, std::ptrdiff_t,
+                               typename std::iterator_traits<typename View::iterator>::pointer,
+                               typename std::iterator_traits<typename View::iterator>::reference>
+{
+private:
+    typename View::iterator current;
+    typename View::iterator last;
+    const Predicate *pred;
+
+    /*!
+        @brief Moves to the first element from the current one for which the predicate is true.
+    */
+    void skip () noexcept
+    {
+        while (current != last && !(*pred) (*current))
+            ++current;
+    }
+
+public:
+    CIterator () noexcept : pred (nullptr)
+    {
+    }
+
+    CIterator (typename View::iterator first, typename View::iterator end, const Predicate *p) noexcept
+            : current (first), last (end), pred (p)
+    {
+        skip ();
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return current == other.current;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return current != other.current;
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        ++current;
+        skip ();
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    typename std::iterator_traits<typename View::iterator>::reference operator* () const noexcept
+    {
+        return *current;
+    }
+};
+
+template<class View, class Predicate>
+typename nsSdD::CFilterView<View, Predicate>::iterator nsSdD::CFilterView<View, Predicate>::begin () const noexcept
+{
+    return iterator (m_view.begin (), m_view.end (), &m_pred);
+}
+
+template<class View, class Predicate>
+typename nsSdD::CFilterView<View, Predicate>::iterator nsSdD::CFilterView<View, Predicate>::end () const noexcept
+{
+    return iterator (m_view.end (), m_view.end (), &m_pred);
+}
+
+/*!
+    @brief Iterator of CTransformView, calling the function each time it is dereferenced.
+ */
+template<class View, class Function>
+struct nsSdD::CTransformView<View, Function>::CIterator
+        : public std::iterator<std::forward_iterator_tag, value_type, std::ptrdiff_t, const value_type *, reference>
+{
+private:
+    typename View::iterator current;
+    const Function *function;
+
+public:
+    CIterator () noexcept : function (nullptr)
+    {
+    }
+
+    CIterator (typename View::iterator first, const Function *f) noexcept : current (first), function (f)
+    {
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return current == other.current;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return current != other.current;
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        ++current;
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        ++current;
+        return temp;
+    }
+
+    reference operator* () const noexcept
+    {
+        return (*function) (*current);
+    }
+};
+
+template<class View, class Function>
+typename nsSdD::CTransformView<View, Function>::iterator nsSdD::CTransformView<View, Function>::begin () const noexcept
+{
+    return iterator (m_view.begin (), &m_function);
+}
+
+template<class View, class Function>
+typename nsSdD::CTransformView<View, Function>::iterator nsSdD::CTransformView<View, Function>::end () const noexcept
+{
+    return iterator (m_view.end (), &m_function);
+}
+
+/*!
+    @brief Iterator of CTakeView, counting the elements left. Two iterators at the end are equal, whether they
+            reached the count or the end of the view.
+ */
+template<class View>
+struct nsSdD::CTakeView<View>::CIterator
+        : public std::iterator<std::forward_iterator_tag, value_type, std::ptrdiff_t,
+                               typename std::iterator_traits<typename View::iterator>::pointer,
+                               typename std::iterator_traits<typename View::iterator>::reference>
+{
+private:
+    typename View::iterator current;
+    typename View::iterator last;
+    size_t remaining;
+
+    bool atEnd () const noexcept
+    {
+        return remaining == 0 || current == last;
+    }
+
+public:
+    CIterator () noexcept : remaining (0)
+    {
+    }
+
+    CIterator (typename View::iterator first, typename View::iterator end, size_t count) noexcept
+            : current (first), last (end), remaining (count)
+    {
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return atEnd () ? other.atEnd () : !other.atEnd () && current == other.current;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        // The view is not read past the last element taken.
+        if (--remaining)
+            ++current;
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    typename std::iterator_traits<typename View::iterator>::reference operator* () const noexcept
+    {
+        return *current;
+    }
+};
+
+template<class View>
+typename nsSdD::CTakeView<View>::iterator nsSdD::CTakeView<View>::begin () const noexcept
+{
+    return iterator (m_view.begin (), m_view.end (), m_count);
+}
+
+template<class View>
+typename nsSdD::CTakeView<View>::iterator nsSdD::CTakeView<View>::end () const noexcept
+{
+    return iterator (m_view.end (), m_view.end (), 0);
+}
+
+template<class View>
+typename nsSdD::CDropView<View>::iterator nsSdD::CDropView<View>::begin () const noexcept
+{
+    iterator first = m_view.begin (), last = m_view.end ();
+    for (size_t i = 0; i < m_count && first != last; ++i)
+        ++first;
+
+    return first;
+}
+
+template<class View>
+typename nsSdD::CDropView<View>::iterator nsSdD::CDropView<View>::end () const noexcept
+{
+    return m_view.end ();
+}
+
+/*!
+    @brief Iterator of CZipView, at the end as soon as one of the views is.
+ */
+template<class View1, class View2>
+struct nsSdD::CZipView<View1, View2>::CIterator
+        : public std::iterator<std::forward_iterator_tag, value_type, std::ptrdiff_t, const value_type *, reference>
+{
+private:
+    typename View1::iterator current1;
+    typename View2::iterator current2;
+
+public:
+    CIterator () noexcept
+    {
+    }
+
+    CIterator (typename View1::iterator first1, typename View2::iterator first2) noexcept
+            : current1 (first1), current2 (first2)
+    {
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return current1 == other.current1 || current2 == other.current2;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        ++current1;
+        ++current2;
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    reference operator* () const noexcept
+    {
+        return reference (*current1, *current2);
+    }
+};
+
+template<class View1, class View2>
+typename nsSdD::CZipView<View1, View2>::iterator nsSdD::CZipView<View1, View2>::begin () const noexcept
+{
+    return iterator (m_view1.begin (), m_view2.begin ());
+}
+
+template<class View1, class View2>
+typename nsSdD::CZipView<View1, View2>::iterator nsSdD::CZipView<View1, View2>::end () const noexcept
+{
+    return iterator (m_view1.end (), m_view2.end ());
+}
+
+/*!
+    @brief Iterator of CChunkView, knowing where its chunk ends.
+ */
+template<class View>
+struct nsSdD::CChunkView<View>::CIterator
+        : public std::iterator<std::forward_iterator_tag, value_type, std::ptrdiff_t, const value_type *, value_type>
+{
+private:
+    typename View::iterator current;
+    typename View::iterator chunkEnd;
+    typename View::iterator last;
+    size_t size;
+
+    /*!
+        @brief Finds the end of the chunk starting at the current element.
+    */
+    void findChunkEnd () noexcept
+    {
+        chunkEnd = current;
+        for (size_t i = 0; i < size && chunkEnd != last; ++i)
+            ++chunkEnd;
+    }
+
+public:
+    CIterator () noexcept : size (0)
+    {
+    }
+
+    CIterator (typename View::iterator first, typename View::iterator end, size_t chunkSize) noexcept
+            : current (first), last (end), size (chunkSize)
+    {
+        findChunkEnd ();
+    }
+
+    bool operator== (const CIterator &other) const noexcept
+    {
+        return current == other.current;
+    }
+
+    bool operator!= (const CIterator &other) const noexcept
+    {
+        return current != other.current;
+    }
+
+    CIterator &operator++ () noexcept
+    {
+        current = chunkEnd;
+        findChunkEnd ();
+        return *this;
+    }
+
+    CIterator operator++ (int) noexcept
+    {
+        CIterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    value_type operator* () const noexcept
+    {
+        return value_type (current, chunkEnd);
+    }
+};
+
+template<class View>
+typename nsSdD::CChunkView<View>::iterator nsSdD::CChunkView<View>::begin () const noexcept
+{
+    return iterator (m_view.begin (), m_view.end (), m_size);
+}
+
+template<class View>
+typename nsSdD::CChunkView<View>::iterator nsSdD::CChunkView<View>::end () const noexcept
+{
+    return iterator (m_view.end (), m_view.end (), m_size);
+}
+
+template<class Iterator>
+nsSdD::CRange<Iterator> nsSdD::range (Iterator first, Iterator last) noexcept
+{
+    return CRange<Iterator> (first, last);
+}
+
+template<typename T, class Policy>
+nsSdD::CRange<typename nsSdD::CList<T, Policy>::const_iterator> nsSdD::all (const CList<T, Policy> &list) noexcept
+{
+    return CViewOf<CList<T, Policy>>::get (list);
+}
+
+template<class Predicate>
+nsSdD::CFilterAdaptor<Predicate> nsSdD::filter (Predicate pred) noexcept
+{
+    return CFilterAdaptor<Predicate> {pred};
+}
+
+template<class Function>
+nsSdD::CTransformAdaptor<Function> nsSdD::transform (Function f) noexcept
+{
+    return CTransformAdaptor<Function> {f};
+}
+
+inline nsSdD::CTakeAdaptor nsSdD::take (size_t count) noexcept
+{
+    return CTakeAdaptor {count};
+}
+
+inline nsSdD::CDropAdaptor nsSdD::drop (size_t count) noexcept
+{
+    return CDropAdaptor {count};
+}
+
+template<class Other>
+nsSdD::CZipAdaptor<typename nsSdD::CViewOf<Other>::type> nsSdD::zip (const Other &other) noexcept
+{
+    return CZipAdaptor<typename CViewOf<Other>::type> {CViewOf<Other>::get (other)};
+}
+
+inline nsSdD::CChunkAdaptor nsSdD::chunk (size_t size) noexcept
+{
+    return CChunkAdaptor {size};
+}
+
+template<template<typename...> class Container>
+nsSdD::CToAdaptor<Container> nsSdD::to () noexcept
+{
+    return CToAdaptor<Container> ();
+}
+
+template<class Source, class Predicate>
+nsSdD::CFilterView<typename nsSdD::CViewOf<Source>::type, Predicate>
+nsSdD::operator| (const Source &source, const CFilterAdaptor<Predicate> &adaptor) noexcept
+{
+    return CFilterView<typename CViewOf<Source>::type, Predicate> (CViewOf<Source>::get (source), adaptor.pred);
+}
+
+template<class Source, class Function>
+nsSdD::CTransformView<typename nsSdD::CViewOf<Source>::type, Function>
+nsSdD::operator| (const Source &source, const CTransformAdaptor<Function> &adaptor) noexcept
+{
+    return CTransformView<typename CViewOf<Source>::type, Function> (CViewOf<Source>::get (source), adaptor.function);
+}
+
+template<class Source>
+nsSdD::CTakeView<typename nsSdD::CViewOf<Source>::type> nsSdD::operator| (const Source &source, const CTakeAdaptor &adaptor) noexcept
+{
+    return CTakeView<typename CViewOf<Source>::type> (CViewOf<Source>::get (source), adaptor.count);
+}
+
+template<class Source>
+nsSdD::CDropView<typename nsSdD::CViewOf<Source>::type> nsSdD::operator| (const Source &source, const CDropAdaptor &adaptor) noexcept
+{
+    return CDropView<typename CViewOf<Source>::type> (CViewOf<Source>::get (source), adaptor.count);
+}
+
+template<class Source, class View>
+nsSdD::CZipView<typename nsSdD::CViewOf<Source>::type, View>
+nsSdD::operator| (const Source &source, const CZipAdaptor<View> &adaptor) noexcept
+{
+    return CZipView<typename CViewOf<Source>::type, View> (CViewOf<Source>::get (source), adaptor.view);
+}
+
+template<class Source>
+nsSdD::CChunkView<typename nsSdD::CViewOf<Source>::type> nsSdD::operator| (const Source &source, const CChunkAdaptor &adaptor) noexcept
+{
+    return CChunkView<typename CViewOf<Source>::type> (CViewOf<Source>::get (source), adaptor.size);
+}
+
+template<class Source, template<typename...> class Container>
+Container<typename nsSdD::CViewOf<Source>::type::value_type>
+nsSdD::operator| (const Source &source, const CToAdaptor<Container> &) noexcept
+{
+    typename CViewOf<Source>::type view = CViewOf<Source>::get (source);
+    Container<typename CViewOf<Source>::type::value_type> result;
+    result.insert (result.end (), view.begin (), view.end ());
+
+    return result;
+}
@@ -0,0 +1,14 @@
+#include "CBenchmarks.h"
+
+#include <cstdlib>
+
+
+using namespace nsBench;
+
+int main (int argc, char *argv[])
+{
+    std::size_t elementCount = argc > 1 ? std::strtoul (argv[1], nullptr, 10) : 100000;
+
+    CBenchmarks::RunBenchmarks (elementCount ? elementCount : 100000);
+    return 0;
+}
@@ -1,10 +1,40 @@
 #include "CTests.h"
 
+#include <cstdlib>
+#include <cstring>
+
 
 using namespace nsTests;
 
-int main ()
+/*!
+    @brief Runs the tests, with the seed of a previous run to reproduce it, or with --perf, the perf mode:
+           CList [--seed value]
+           CList --perf [baseline file] [--record] [--threshold ratio]
+ */
+int main (int argc, char *argv[])
 {
-    CTests::RunTests ();
+    if (argc > 1 && std::strcmp (argv[1], "--perf") == 0)
+    {
+        std::string baselinePath = "perf_baseline.txt";
+        bool record = false;
+        double threshold = 0.25;
+
+        for (int i = 2; i < argc; ++i)
+            if (std::strcmp (argv[i], "--record") == 0)
+                record = true;
+            else if (std::strcmp (argv[i], "--threshold") == 0 && i + 1 < argc)
+                threshold = std::atof (argv[++i]);
+            else
+                baselinePath = argv[i];
+
+        return CTests::RunPerfTests (baselinePath, record, threshold) ? 0 : 1;
+    }
+
+    // CList [--seed value]
+    std::uint64_t seed = 0;
+    if (argc > 2 && std::strcmp (argv[1], "--seed") == 0)
+        seed = std::strtoull (argv[2], nullptr, 10);
+
+    CTests::RunTests (seed);
     return 0;
-}
\ No newline at end of file
+}
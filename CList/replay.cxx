@@ -0,0 +1,17 @@
+#include "CReplay.h"
+
+#include <iostream>
+
+
+using namespace nsBench;
+
+int main (int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace>" << std::endl;
+        return 1;
+    }
+
+    return CReplay::RunReplay (argv[1]) ? 0 : 1;
+}